@@ -0,0 +1,338 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/Export.hpp>
+
+#include <SFML/Audio/SoundSource.hpp>
+
+#include <SFML/System/Time.hpp>
+
+#include <memory>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf
+{
+class SoundBuffer;
+
+////////////////////////////////////////////////////////////
+/// \brief Spectrum and level analysis of audio samples
+///
+////////////////////////////////////////////////////////////
+class SFML_AUDIO_API AudioAnalyzer
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Window function applied to the samples before the FFT
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class Window
+    {
+        Rectangular, //!< No windowing
+        Hann,        //!< Hann window, good general purpose choice
+        Hamming,     //!< Hamming window
+        Blackman     //!< Blackman window, lowest spectral leakage
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Result of the analysis of a block of samples
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Frame
+    {
+        ////////////////////////////////////////////////////////////
+        /// \brief Get the energy contained in a frequency band
+        ///
+        /// The energy is the sum of the squared magnitudes of
+        /// the bins whose center frequency lies in the range
+        /// [`lowFrequency`, `highFrequency`).
+        ///
+        /// \param lowFrequency  Lower bound of the band, in Hz
+        /// \param highFrequency Upper bound of the band, in Hz
+        ///
+        /// \return Energy of the band
+        ///
+        ////////////////////////////////////////////////////////////
+        [[nodiscard]] float getBandEnergy(float lowFrequency, float highFrequency) const;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Get the center frequency of a bin of the spectrum
+        ///
+        /// \param bin Index of the bin in `magnitudes`
+        ///
+        /// \return Center frequency of the bin, in Hz
+        ///
+        ////////////////////////////////////////////////////////////
+        [[nodiscard]] float getBinFrequency(std::size_t bin) const;
+
+        float              rms{};        //!< Root mean square level of the samples, in range [0, 1]
+        float              peak{};       //!< Peak absolute level of the samples, in range [0, 1]
+        std::vector<float> magnitudes;   //!< Amplitude of each frequency bin, from 0 Hz to the Nyquist frequency
+        unsigned int       sampleRate{}; //!< Sample rate of the analyzed samples
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the analyzer
+    ///
+    /// \param fftSize Number of frames analyzed at once, must be a power of two greater or equal to 4
+    /// \param window  Window function applied before the FFT
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit AudioAnalyzer(std::size_t fftSize = 1024, Window window = Window::Hann);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~AudioAnalyzer();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    AudioAnalyzer(AudioAnalyzer&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    AudioAnalyzer& operator=(AudioAnalyzer&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of frames analyzed at once
+    ///
+    /// \return FFT size
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getFftSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the window function applied before the FFT
+    ///
+    /// \return Window function
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Window getWindow() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Analyze a block of interleaved 16-bit samples
+    ///
+    /// The channels are mixed down to mono. At most `getFftSize()`
+    /// frames are analyzed; if fewer are provided, the remaining
+    /// ones are treated as silence by the FFT.
+    ///
+    /// \param samples      Pointer to the interleaved samples
+    /// \param frameCount   Number of frames (samples per channel) available
+    /// \param channelCount Number of channels
+    /// \param sampleRate   Sample rate of the samples
+    ///
+    /// \return Result of the analysis
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Frame analyze(const std::int16_t* samples,
+                                std::uint64_t       frameCount,
+                                unsigned int        channelCount,
+                                unsigned int        sampleRate);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Analyze a block of interleaved floating point samples
+    ///
+    /// \param samples      Pointer to the interleaved samples, in range [-1, 1]
+    /// \param frameCount   Number of frames (samples per channel) available
+    /// \param channelCount Number of channels
+    /// \param sampleRate   Sample rate of the samples
+    ///
+    /// \return Result of the analysis
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Frame analyze(const float* samples, std::uint64_t frameCount, unsigned int channelCount, unsigned int sampleRate);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Analyze the samples of a sound buffer at a given offset
+    ///
+    /// \param buffer Sound buffer to analyze
+    /// \param offset Position of the first analyzed frame in the buffer
+    ///
+    /// \return Result of the analysis
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Frame analyze(const SoundBuffer& buffer, Time offset = Time::Zero);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Push interleaved 16-bit samples for later analysis
+    ///
+    /// This function is lock-free and wait-free, it is meant to
+    /// be called from an audio thread, for example from
+    /// `sf::SoundRecorder::onProcessSamples`. If the internal
+    /// queue is full, the excess samples are dropped.
+    ///
+    /// Only one thread may push samples at a time.
+    ///
+    /// \param samples      Pointer to the interleaved samples
+    /// \param frameCount   Number of frames (samples per channel)
+    /// \param channelCount Number of channels
+    ///
+    /// \see `process`, `getDroppedFrameCount`
+    ///
+    ////////////////////////////////////////////////////////////
+    void push(const std::int16_t* samples, std::uint64_t frameCount, unsigned int channelCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Push interleaved floating point samples for later analysis
+    ///
+    /// \param samples      Pointer to the interleaved samples, in range [-1, 1]
+    /// \param frameCount   Number of frames (samples per channel)
+    /// \param channelCount Number of channels
+    ///
+    /// \see `process`, `getDroppedFrameCount`
+    ///
+    ////////////////////////////////////////////////////////////
+    void push(const float* samples, std::uint64_t frameCount, unsigned int channelCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create an effect processor that feeds the analyzer
+    ///
+    /// The returned processor passes the audio through unchanged
+    /// and pushes a copy of it to the analyzer. Attach it to a
+    /// `sf::Sound`, `sf::Music` or any other `sf::SoundStream`
+    /// with `sf::SoundSource::setEffectProcessor`.
+    ///
+    /// The processor shares the queue of the analyzer, it remains
+    /// safe to call after the analyzer has been destroyed.
+    ///
+    /// \return Pass-through effect processor
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] SoundSource::EffectProcessor createTap() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Analyze the next block of pushed samples
+    ///
+    /// This function must be called from a single thread, which
+    /// should not be the audio thread. Consecutive blocks do not
+    /// overlap.
+    ///
+    /// \param frame Frame to fill with the result of the analysis
+    ///
+    /// \return `true` if a full block was available and `frame` was filled, `false` otherwise
+    ///
+    /// \see `push`, `setSampleRate`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool process(Frame& frame);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the sample rate of the pushed samples
+    ///
+    /// The sample rate is only used to compute the frequencies
+    /// of the bins of the frames returned by `process`.
+    /// The default sample rate is 44100 Hz.
+    ///
+    /// \param sampleRate Sample rate of the pushed samples
+    ///
+    /// \see `getSampleRate`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setSampleRate(unsigned int sampleRate);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the sample rate of the pushed samples
+    ///
+    /// \return Sample rate of the pushed samples
+    ///
+    /// \see `setSampleRate`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getSampleRate() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of pushed frames that were dropped because the queue was full
+    ///
+    /// \return Number of dropped frames
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::uint64_t getDroppedFrameCount() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    struct Impl;
+    std::unique_ptr<Impl> m_impl; //!< Implementation details
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::AudioAnalyzer
+/// \ingroup audio
+///
+/// `sf::AudioAnalyzer` computes the spectrum of blocks of audio
+/// samples with a real FFT, as well as their RMS and peak levels.
+/// The energy of arbitrary frequency bands can then be queried on
+/// the resulting `sf::AudioAnalyzer::Frame`, which is convenient for
+/// visualizers or voice activity detection.
+///
+/// Samples can be analyzed directly, for example the ones of a
+/// `sf::SoundBuffer`, or pushed from an audio thread and analyzed
+/// later on another thread. In the latter case, the samples are
+/// handed over through a lock-free queue so that the audio thread
+/// never waits for the analysis. A tap created with `createTap`
+/// feeds the analyzer with the output of any sound source, and
+/// `push` can be called from `sf::SoundRecorder::onProcessSamples`
+/// to analyze captured audio.
+///
+/// The FFT uses SSE instructions when they are available.
+///
+/// Usage example:
+/// \code
+/// sf::Music music("music.ogg");
+/// sf::AudioAnalyzer analyzer(2048);
+///
+/// analyzer.setSampleRate(music.getSampleRate());
+/// music.setEffectProcessor(analyzer.createTap());
+/// music.play();
+///
+/// sf::AudioAnalyzer::Frame frame;
+/// while (music.getStatus() == sf::Music::Status::Playing)
+/// {
+///     // Draw the bass level of each new block
+///     while (analyzer.process(frame))
+///         drawLevel(frame.getBandEnergy(20.f, 250.f));
+/// }
+/// \endcode
+///
+/// \see `sf::SoundBuffer`, `sf::SoundStream`, `sf::SoundRecorder`
+///
+////////////////////////////////////////////////////////////
@@ -36,6 +36,7 @@
 #include <memory>
 #include <vector>
 
+#include <cstddef>
 #include <cstdint>
 
 
@@ -48,6 +49,16 @@ namespace sf
 class SFML_AUDIO_API OutputSoundFile
 {
 public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Behavior of asynchronous writes when the queue is full
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class OverflowPolicy
+    {
+        Block, //!< Wait until the writer thread made room in the queue
+        Drop   //!< Drop the samples that don't fit in the queue
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief Default constructor
     ///
@@ -55,7 +66,40 @@ public:
     /// with a file to write.
     ///
     ////////////////////////////////////////////////////////////
-    OutputSoundFile() = default;
+    OutputSoundFile();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// Pending asynchronous writes are completed before the
+    /// file is closed.
+    ///
+    ////////////////////////////////////////////////////////////
+    ~OutputSoundFile();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    OutputSoundFile(const OutputSoundFile&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    OutputSoundFile& operator=(const OutputSoundFile&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    OutputSoundFile(OutputSoundFile&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    OutputSoundFile& operator=(OutputSoundFile&& right) noexcept;
 
     ////////////////////////////////////////////////////////////
     /// \brief Construct the sound file from the disk for writing
@@ -93,9 +137,44 @@ public:
                                     unsigned int                     channelCount,
                                     const std::vector<SoundChannel>& channelMap);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Open the sound file from the disk for asynchronous writing
+    ///
+    /// In asynchronous mode, `write` only copies the samples
+    /// to a bounded lock-free queue, and the encoding and the
+    /// disk I/O happen on a dedicated writer thread. This makes
+    /// it suitable for recording from an audio callback such as
+    /// `sf::SoundRecorder::onProcessSamples`.
+    ///
+    /// When the queue is full, `write` either waits for the writer
+    /// thread or drops the samples that don't fit, depending on
+    /// `overflowPolicy`. Samples are always dropped by whole frames.
+    ///
+    /// \param filename       Path of the sound file to write
+    /// \param sampleRate     Sample rate of the sound
+    /// \param channelCount   Number of channels in the sound
+    /// \param channelMap     Map of position in sample frame to sound channel
+    /// \param queueSize      Capacity of the queue, in samples
+    /// \param overflowPolicy Behavior of `write` when the queue is full
+    ///
+    /// \return `true` if the file was successfully opened
+    ///
+    /// \see `getDroppedSampleCount`, `getQueuedSampleCount`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool openFromFileAsync(const std::filesystem::path&     filename,
+                                         unsigned int                     sampleRate,
+                                         unsigned int                     channelCount,
+                                         const std::vector<SoundChannel>& channelMap,
+                                         std::size_t                      queueSize      = 262144,
+                                         OverflowPolicy                   overflowPolicy = OverflowPolicy::Drop);
+
     ////////////////////////////////////////////////////////////
     /// \brief Write audio samples to the file
     ///
+    /// In asynchronous mode, only a single thread may write
+    /// samples at a time.
+    ///
     /// \param samples     Pointer to the sample array to write
     /// \param count       Number of samples to write
     ///
@@ -105,14 +184,54 @@ public:
     ////////////////////////////////////////////////////////////
     /// \brief Close the current file
     ///
+    /// In asynchronous mode, this function waits until all the
+    /// queued samples are written.
+    ///
     ////////////////////////////////////////////////////////////
     void close();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the file was opened for asynchronous writing
+    ///
+    /// \return `true` if samples are written by a dedicated thread
+    ///
+    /// \see `openFromFileAsync`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isAsync() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of samples waiting to be written by the writer thread
+    ///
+    /// This number is always 0 in synchronous mode.
+    ///
+    /// \return Number of queued samples
+    ///
+    /// \see `openFromFileAsync`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::uint64_t getQueuedSampleCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of samples dropped because the queue was full
+    ///
+    /// This number is always 0 in synchronous mode, or with
+    /// the `OverflowPolicy::Block` policy.
+    ///
+    /// \return Number of dropped samples since the file was opened
+    ///
+    /// \see `openFromFileAsync`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::uint64_t getDroppedSampleCount() const;
+
 private:
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    std::unique_ptr<SoundFileWriter> m_writer; //!< Writer that handles I/O on the file's format
+    struct AsyncWriter;
+    std::unique_ptr<SoundFileWriter> m_writer;      //!< Writer that handles I/O on the file's format
+    std::unique_ptr<AsyncWriter>     m_asyncWriter; //!< Queue and thread used in asynchronous mode, must be destroyed before the writer
 };
 
 } // namespace sf
@@ -142,6 +261,11 @@ private:
 /// }
 /// \endcode
 ///
+/// When samples are produced on a time-critical thread, such as
+/// the capture callback of a `sf::SoundRecorder`, open the file
+/// with `openFromFileAsync` instead: encoding then happens on a
+/// dedicated thread, and `write` only copies the samples.
+///
 /// \see `sf::SoundFileWriter`, `sf::InputSoundFile`
 ///
 ////////////////////////////////////////////////////////////
@@ -29,6 +29,8 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Audio/Export.hpp>
 
+#include <SFML/System/Time.hpp>
+
 #include <optional>
 #include <string>
 #include <vector>
@@ -79,6 +81,22 @@ namespace sf::PlaybackDevice
 ////////////////////////////////////////////////////////////
 [[nodiscard]] SFML_AUDIO_API std::optional<std::string> getDefaultDevice();
 
+////////////////////////////////////////////////////////////
+/// \brief Refresh the list of available audio playback devices
+///
+/// Enumerating the devices is slow on some systems, so the
+/// list is cached. The cache is refreshed automatically when
+/// the system reports that the default device changed, or
+/// when a device that is not in the list is requested. Call
+/// this function to force the list to be enumerated again
+/// the next time it is needed, for example after the user
+/// plugged in a new device.
+///
+/// \see `getAvailableDevices`
+///
+////////////////////////////////////////////////////////////
+SFML_AUDIO_API void refreshAvailableDevices();
+
 ////////////////////////////////////////////////////////////
 /// \brief Set the audio playback device
 ///
@@ -107,4 +125,38 @@ namespace sf::PlaybackDevice
 ////////////////////////////////////////////////////////////
 [[nodiscard]] SFML_AUDIO_API std::optional<std::string> getDevice();
 
+////////////////////////////////////////////////////////////
+/// \brief Get the current time of the audio engine clock
+///
+/// The engine clock advances by exactly one frame for each
+/// frame mixed to the playback device. It is the reference
+/// used by `sf::SoundSource::playAt` and `sf::SoundSource::stopAt`
+/// to schedule sounds with sample accuracy.
+///
+/// The clock only exists while at least one audio resource
+/// (sound, music, ...) exists, and restarts from zero when
+/// the playback device is changed.
+///
+/// \return Current engine time, or `Time::Zero` if no audio engine exists
+///
+/// \see `getOutputLatency`
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] SFML_AUDIO_API Time getEngineTime();
+
+////////////////////////////////////////////////////////////
+/// \brief Get the output latency of the audio playback device
+///
+/// This is the duration of audio buffered by the device
+/// between the moment it is mixed and the moment it is
+/// heard. Sounds should be scheduled at least this far
+/// ahead of the engine time to start exactly on time.
+///
+/// \return Output latency, or `Time::Zero` if no audio device exists
+///
+/// \see `getEngineTime`
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] SFML_AUDIO_API Time getOutputLatency();
+
 } // namespace sf::PlaybackDevice
@@ -0,0 +1,225 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/Export.hpp>
+
+#include <memory>
+#include <vector>
+
+#include <cstdint>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Sample rate converter based on a windowed-sinc filter
+///
+////////////////////////////////////////////////////////////
+class SFML_AUDIO_API Resampler
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Trade-off between CPU cost and aliasing
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class Quality
+    {
+        Fast,   //!< 8 taps, about 50 dB of stopband attenuation, suited to real-time use on many streams
+        Medium, //!< 32 taps, about 80 dB of stopband attenuation
+        Best    //!< 64 taps, about 100 dB of stopband attenuation, suited to offline conversion
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the resampler
+    ///
+    /// \param inputSampleRate  Sample rate of the input samples
+    /// \param outputSampleRate Sample rate of the output samples
+    /// \param channelCount     Number of interleaved channels
+    /// \param quality          Quality of the conversion
+    ///
+    ////////////////////////////////////////////////////////////
+    Resampler(unsigned int inputSampleRate,
+              unsigned int outputSampleRate,
+              unsigned int channelCount,
+              Quality      quality = Quality::Medium);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~Resampler();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    Resampler(const Resampler& copy);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    Resampler& operator=(const Resampler& right);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    Resampler(Resampler&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    Resampler& operator=(Resampler&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Convert a block of samples
+    ///
+    /// The resampler keeps the end of the input for the next
+    /// call, so a signal can be converted block by block, for
+    /// example in `sf::SoundStream::onGetData`. Because the
+    /// filter needs samples ahead of each output sample, the
+    /// output lags behind the input by half the filter length;
+    /// call `flush` after the last block to get the remaining
+    /// samples.
+    ///
+    /// \param samples    Pointer to the interleaved input samples
+    /// \param frameCount Number of frames (samples per channel) to convert
+    /// \param output     Vector the converted samples are appended to
+    ///
+    /// \see `flush`
+    ///
+    ////////////////////////////////////////////////////////////
+    void process(const std::int16_t* samples, std::uint64_t frameCount, std::vector<std::int16_t>& output);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Output the remaining samples at the end of a signal
+    ///
+    /// After this call, the total number of output frames is
+    /// the number of input frames scaled by the ratio of the
+    /// sample rates, rounded up. The resampler is then reset.
+    ///
+    /// \param output Vector the remaining samples are appended to
+    ///
+    /// \see `process`, `reset`
+    ///
+    ////////////////////////////////////////////////////////////
+    void flush(std::vector<std::int16_t>& output);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Discard the buffered input to start a new signal
+    ///
+    ////////////////////////////////////////////////////////////
+    void reset();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the sample rate of the input samples
+    ///
+    /// \return Input sample rate
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getInputSampleRate() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the sample rate of the output samples
+    ///
+    /// \return Output sample rate
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getOutputSampleRate() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of interleaved channels
+    ///
+    /// \return Number of channels
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getChannelCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the quality of the conversion
+    ///
+    /// \return Quality of the conversion
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Quality getQuality() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    struct Impl;
+    std::unique_ptr<Impl> m_impl; //!< Implementation details
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::Resampler
+/// \ingroup audio
+///
+/// `sf::Resampler` converts audio samples from one sample rate
+/// to another with a polyphase windowed-sinc filter. It is more
+/// expensive than the linear interpolation the audio engine
+/// applies when the sample rate of a sound differs from the one
+/// of the playback device, but it doesn't produce audible
+/// aliasing.
+///
+/// The filter length, and thus the CPU cost and the amount of
+/// aliasing, is selected with a quality tier. The filter and the
+/// sample format conversions use SSE2 instructions when they are
+/// available.
+///
+/// A whole `sf::SoundBuffer` can be converted once after loading
+/// with `sf::SoundBuffer::resample`. To convert a stream, use a
+/// resampler inside `sf::SoundStream::onGetData`.
+///
+/// Usage example:
+/// \code
+/// sf::Resampler resampler(22050, 44100, 2, sf::Resampler::Quality::Fast);
+/// std::vector<std::int16_t> output;
+///
+/// while (...)
+/// {
+///     // Get a block of 22050 Hz samples from your custom source
+///     std::vector<std::int16_t> samples = ...;
+///
+///     output.clear();
+///     resampler.process(samples.data(), samples.size() / 2, output);
+///
+///     // output now contains the 44100 Hz samples
+/// }
+/// \endcode
+///
+/// \see `sf::SoundBuffer`, `sf::SoundStream`
+///
+////////////////////////////////////////////////////////////
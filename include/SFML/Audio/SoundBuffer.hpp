@@ -29,11 +29,13 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Audio/Export.hpp>
 
+#include <SFML/Audio/Resampler.hpp>
 #include <SFML/Audio/SoundChannel.hpp>
 
 #include <SFML/System/Time.hpp>
 
 #include <filesystem>
+#include <memory>
 #include <unordered_set>
 #include <vector>
 
@@ -61,7 +63,7 @@ public:
     /// any samples.
     ///
     ////////////////////////////////////////////////////////////
-    SoundBuffer() = default;
+    SoundBuffer();
 
     ////////////////////////////////////////////////////////////
     /// \brief Copy constructor
@@ -213,6 +215,30 @@ public:
                                        unsigned int                     sampleRate,
                                        const std::vector<SoundChannel>& channelMap);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Load the sound buffer from a file, decoding it in the background
+    ///
+    /// The file is opened and the buffer is sized immediately,
+    /// but the samples are decoded on a separate thread. A
+    /// `sf::Sound` using this buffer can be played right away:
+    /// it plays the samples that are already decoded, and outputs
+    /// silence (counted as an underrun) if it ever catches up
+    /// with the decoder.
+    ///
+    /// Until the load has finished, only the first
+    /// `getDecodedSampleCount()` samples returned by `getSamples()`
+    /// are valid. Copying or saving the buffer waits for the
+    /// decoder and only keeps these samples if it failed partway.
+    ///
+    /// \param filename Path of the sound file to load
+    ///
+    /// \return `true` if the file could be opened, `false` if it failed
+    ///
+    /// \see `isLoading`, `getDecodedSampleCount`, `getUnderrunCount`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool loadFromFileProgressive(const std::filesystem::path& filename);
+
     ////////////////////////////////////////////////////////////
     /// \brief Save the sound buffer to an audio file
     ///
@@ -226,6 +252,26 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] bool saveToFile(const std::filesystem::path& filename) const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Convert the samples of the buffer to another sample rate
+    ///
+    /// The audio engine converts sounds whose sample rate differs
+    /// from the one of the playback device with a cheap linear
+    /// interpolation. Resampling the buffer once after loading
+    /// avoids the aliasing it produces. If the buffer is being
+    /// loaded progressively, this function waits until the
+    /// loading has finished.
+    ///
+    /// \param sampleRate New sample rate
+    /// \param quality    Quality of the conversion
+    ///
+    /// \return `true` if resampling succeeded, `false` if it failed
+    ///
+    /// \see `sf::Resampler`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool resample(unsigned int sampleRate, Resampler::Quality quality = Resampler::Quality::Best);
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the array of audio samples stored in the buffer
     ///
@@ -253,6 +299,44 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] std::uint64_t getSampleCount() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of samples that are ready to be played
+    ///
+    /// This is equal to `getSampleCount()`, unless the buffer
+    /// is still being loaded by `loadFromFileProgressive`.
+    ///
+    /// \return Number of decoded samples
+    ///
+    /// \see `loadFromFileProgressive`, `isLoading`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::uint64_t getDecodedSampleCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the buffer is still being decoded in the background
+    ///
+    /// \return `true` while a progressive load is in progress
+    ///
+    /// \see `loadFromFileProgressive`, `getDecodedSampleCount`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isLoading() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of times playback overtook the decoder
+    ///
+    /// Each time a sound using this buffer needs samples that
+    /// are not decoded yet, it outputs silence instead and this
+    /// counter is incremented. The counter is reset when new
+    /// samples are loaded.
+    ///
+    /// \return Number of underruns since the last load
+    ///
+    /// \see `loadFromFileProgressive`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::uint64_t getUnderrunCount() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the sample rate of the sound
     ///
@@ -315,6 +399,13 @@ public:
 
 private:
     friend class Sound;
+    friend class SoundBufferCache;
+
+    ////////////////////////////////////////////////////////////
+    // Types
+    ////////////////////////////////////////////////////////////
+    using SoundList = std::unordered_set<Sound*>; //!< Set of unique sound instances
+    struct ProgressiveLoader;
 
     ////////////////////////////////////////////////////////////
     /// \brief Initialize the internal state after loading a new sound
@@ -329,6 +420,9 @@ private:
     ////////////////////////////////////////////////////////////
     /// \brief Update the internal buffer with the cached audio samples
     ///
+    /// The sounds that use the buffer must be detached while
+    /// the samples are modified, see `detachSounds`.
+    ///
     /// \param channelCount Number of channels
     /// \param sampleRate   Sample rate (number of samples per second)
     /// \param channelMap   Map of position in sample frame to sound channel
@@ -338,6 +432,63 @@ private:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] bool update(unsigned int channelCount, unsigned int sampleRate, const std::vector<SoundChannel>& channelMap);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Detach the buffer from all the sounds that use it
+    ///
+    /// Once detached, the sounds no longer read the samples
+    /// nor the state of a progressive load from the audio thread.
+    ///
+    /// \return List of the detached sounds, to pass to `reattachSounds`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] SoundList detachSounds();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Attach the buffer back to sounds detached by `detachSounds`
+    ///
+    /// \param sounds List of sounds to attach
+    ///
+    ////////////////////////////////////////////////////////////
+    void reattachSounds(const SoundList& sounds);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Stop the background decoding of a progressive load
+    ///
+    /// The sounds must be detached first, see `detachSounds`.
+    ///
+    ////////////////////////////////////////////////////////////
+    void cancelLoading();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Wait until the background decoder of a progressive load has stopped
+    ///
+    /// The samples are left untouched: if decoding failed
+    /// partway, only the first `getDecodedSampleCount()`
+    /// samples are valid.
+    ///
+    /// \see `finishLoading`
+    ///
+    ////////////////////////////////////////////////////////////
+    void waitForDecoder() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Wait until the background decoding of a progressive load has finished
+    ///
+    /// If decoding failed partway, the buffer is truncated
+    /// to the samples that could be decoded, which stops the
+    /// sounds that use it.
+    ///
+    /// \see `waitForDecoder`
+    ///
+    ////////////////////////////////////////////////////////////
+    void finishLoading();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Record that a sound had to output silence because samples were not decoded yet
+    ///
+    ////////////////////////////////////////////////////////////
+    void notifyUnderrun() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Add a sound to the list of sounds that use this buffer
     ///
@@ -354,11 +505,6 @@ private:
     ////////////////////////////////////////////////////////////
     void detachSound(Sound* sound) const;
 
-    ////////////////////////////////////////////////////////////
-    // Types
-    ////////////////////////////////////////////////////////////
-    using SoundList = std::unordered_set<Sound*>; //!< Set of unique sound instances
-
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
@@ -367,6 +513,7 @@ private:
     std::vector<SoundChannel> m_channelMap{SoundChannel::Mono}; //!< The map of position in sample frame to sound channel
     Time              m_duration;                               //!< Sound duration
     mutable SoundList m_sounds;                                 //!< List of sounds that are using this buffer
+    std::unique_ptr<ProgressiveLoader> m_loader; //!< Background decoder of a progressive load
 };
 
 } // namespace sf
@@ -0,0 +1,267 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/Export.hpp>
+
+#include <filesystem>
+#include <future>
+#include <memory>
+
+#include <cstddef>
+
+
+namespace sf
+{
+class InputStream;
+class SoundBuffer;
+
+////////////////////////////////////////////////////////////
+/// \brief Shared cache of decoded sound buffers
+///
+////////////////////////////////////////////////////////////
+class SFML_AUDIO_API SoundBufferCache
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Handle to a sound buffer that is being loaded
+    ///
+    /// The handle becomes ready once the worker thread finished
+    /// decoding the file. Its value is a null pointer if loading
+    /// failed.
+    ///
+    ////////////////////////////////////////////////////////////
+    using Handle = std::shared_future<std::shared_ptr<const SoundBuffer>>;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the cache
+    ///
+    /// \param memoryBudget Maximum amount of memory, in bytes, that unused buffers may occupy
+    /// \param workerCount  Number of worker threads used for asynchronous loading
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit SoundBufferCache(std::size_t memoryBudget = 64 * 1024 * 1024, unsigned int workerCount = 1);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// Pending asynchronous loads that were not started yet are
+    /// cancelled, their handles become ready with a null pointer.
+    ///
+    ////////////////////////////////////////////////////////////
+    ~SoundBufferCache();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    SoundBufferCache(const SoundBufferCache&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    SoundBufferCache& operator=(const SoundBufferCache&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the sound buffer associated to a file, loading it if needed
+    ///
+    /// If the file is already being loaded asynchronously, this
+    /// function waits until the load has finished.
+    ///
+    /// \param filename Path of the sound file to load
+    ///
+    /// \return Shared sound buffer, or a null pointer if loading failed
+    ///
+    /// \see `loadAsync`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::shared_ptr<const SoundBuffer> load(const std::filesystem::path& filename);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the sound buffer associated to a stream, loading it if needed
+    ///
+    /// Streams are identified by their address: the stream
+    /// must not be destroyed or reused for other data while
+    /// it is known by the cache (see `remove`).
+    ///
+    /// \param stream Source stream to read from
+    ///
+    /// \return Shared sound buffer, or a null pointer if loading failed
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::shared_ptr<const SoundBuffer> load(InputStream& stream);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Start loading a sound file on a worker thread
+    ///
+    /// If the file is already in the cache, or being loaded,
+    /// the existing handle is returned.
+    ///
+    /// \param filename Path of the sound file to load
+    ///
+    /// \return Handle to the sound buffer
+    ///
+    /// \see `load`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Handle loadAsync(const std::filesystem::path& filename);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove the entry associated to a file from the cache
+    ///
+    /// The buffer itself stays alive as long as it is referenced
+    /// by the application.
+    ///
+    /// \param filename Path of the sound file
+    ///
+    ////////////////////////////////////////////////////////////
+    void remove(const std::filesystem::path& filename);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove the entry associated to a stream from the cache
+    ///
+    /// \param stream Source stream
+    ///
+    ////////////////////////////////////////////////////////////
+    void remove(const InputStream& stream);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Evict all unused sound buffers
+    ///
+    /// A buffer is unused when it is referenced neither by the
+    /// application nor by any `sf::Sound`.
+    ///
+    ////////////////////////////////////////////////////////////
+    void clear();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the memory budget
+    ///
+    /// When the decoded buffers known by the cache occupy more
+    /// than the budget, unused buffers are evicted in least
+    /// recently used order. Buffers that are still used are
+    /// never evicted, thus the budget may be exceeded.
+    ///
+    /// \param memoryBudget Memory budget, in bytes
+    ///
+    /// \see `getMemoryBudget`, `getMemoryUsage`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setMemoryBudget(std::size_t memoryBudget);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the memory budget
+    ///
+    /// \return Memory budget, in bytes
+    ///
+    /// \see `setMemoryBudget`, `getMemoryUsage`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getMemoryBudget() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the memory occupied by the samples of the cached buffers
+    ///
+    /// \return Memory usage, in bytes
+    ///
+    /// \see `setMemoryBudget`, `getMemoryBudget`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getMemoryUsage() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of entries known by the cache
+    ///
+    /// Entries that are still being loaded are included.
+    ///
+    /// \return Number of entries
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getBufferCount() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    struct Impl;
+    const std::unique_ptr<Impl> m_impl; //!< Implementation details
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::SoundBufferCache
+/// \ingroup audio
+///
+/// `sf::SoundBufferCache` makes sure that a sound file used by
+/// several parts of an application is only decoded once. Buffers
+/// are returned as `std::shared_ptr`, and stay in the cache after
+/// the application released them, so that loading the same file
+/// again is instantaneous.
+///
+/// The amount of memory kept by buffers that are not used anymore
+/// is bounded by a memory budget: when it is exceeded, the least
+/// recently used buffers that are neither referenced by the
+/// application nor attached to a `sf::Sound` are evicted.
+///
+/// Files can also be decoded in the background with `loadAsync`,
+/// which returns a future-like handle. The decoding happens on a
+/// small pool of worker threads owned by the cache.
+///
+/// Eviction inspects the sounds attached to the cached buffers, so
+/// the cache should be used from the thread that creates and
+/// destroys the `sf::Sound` instances.
+///
+/// Usage example:
+/// \code
+/// sf::SoundBufferCache cache(32 * 1024 * 1024);
+///
+/// // Start decoding the music of the next level in the background
+/// const auto handle = cache.loadAsync("level2.ogg");
+///
+/// // Both calls return the same buffer, the file is only decoded once
+/// const auto buffer1 = cache.load("explosion.wav");
+/// const auto buffer2 = cache.load("explosion.wav");
+///
+/// sf::Sound sound(*buffer1);
+/// sound.play();
+///
+/// // Later on, once the background load has finished
+/// if (const auto& buffer = handle.get())
+/// {
+///     sf::Sound music(*buffer);
+///     music.play();
+/// }
+/// \endcode
+///
+/// \see `sf::SoundBuffer`, `sf::Sound`
+///
+////////////////////////////////////////////////////////////
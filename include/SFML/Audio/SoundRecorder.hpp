@@ -109,6 +109,22 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] static std::vector<std::string> getAvailableDevices();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Refresh the list of available audio capture devices
+    ///
+    /// Enumerating the devices is slow on some systems, so the
+    /// list is cached and shared by all recorders. The cache is
+    /// refreshed automatically when the system reports that the
+    /// default device changed, or when a device that is not in
+    /// the list is requested. Call this function to force the
+    /// list to be enumerated again the next time it is needed,
+    /// for example after the user plugged in a new device.
+    ///
+    /// \see `getAvailableDevices`
+    ///
+    ////////////////////////////////////////////////////////////
+    static void refreshAvailableDevices();
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the name of the default audio capture device
     ///
@@ -32,9 +32,13 @@
 #include <SFML/Audio/AudioResource.hpp>
 
 #include <SFML/System/Angle.hpp>
+#include <SFML/System/Time.hpp>
 #include <SFML/System/Vector3.hpp>
 
 #include <functional>
+#include <optional>
+
+#include <cstddef>
 
 
 namespace sf
@@ -154,6 +158,34 @@ public:
     using EffectProcessor = std::function<
         void(const float* inputFrames, unsigned int& inputFrameCount, float* outputFrames, unsigned int& outputFrameCount, unsigned int frameChannelCount)>;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Changes of the spatial properties of a sound source
+    ///
+    /// \see `updateSpatial`
+    ///
+    ////////////////////////////////////////////////////////////
+    struct SpatialUpdate
+    {
+        SoundSource*            source{};  //!< Sound source to update
+        std::optional<Vector3f> position;  //!< New position of the source, if it changes
+        std::optional<Vector3f> direction; //!< New direction of the source, if it changes
+        std::optional<Vector3f> velocity;  //!< New velocity of the source, if it changes
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Changes of the spatial properties of the listener
+    ///
+    /// \see `updateSpatial`
+    ///
+    ////////////////////////////////////////////////////////////
+    struct ListenerUpdate
+    {
+        std::optional<Vector3f> position;  //!< New position of the listener, if it changes
+        std::optional<Vector3f> direction; //!< New forward vector of the listener, if it changes
+        std::optional<Vector3f> velocity;  //!< New velocity of the listener, if it changes
+        std::optional<Vector3f> upVector;  //!< New upward vector of the listener, if it changes
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief Copy constructor
     ///
@@ -638,6 +670,68 @@ public:
     ////////////////////////////////////////////////////////////
     virtual void stop() = 0;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Start or resume playing the sound source at a given engine time
+    ///
+    /// This function behaves like `play()`, except that the
+    /// source stays silent until the audio engine clock reaches
+    /// `engineTime`. The start is sample accurate, which makes it
+    /// possible to schedule rhythmic or layered sounds ahead of
+    /// time without them drifting relative to each other.
+    ///
+    /// If `engineTime` is already in the past, the source starts
+    /// with the next mixing period. A pending scheduled start is
+    /// cancelled by `pause()` and `stop()`.
+    ///
+    /// \param engineTime Time of the audio engine clock at which to start playing
+    ///
+    /// \see `stopAt`, `sf::PlaybackDevice::getEngineTime`
+    ///
+    ////////////////////////////////////////////////////////////
+    void playAt(Time engineTime);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Stop playing the sound source at a given engine time
+    ///
+    /// The source stops playing, with sample accuracy, when the
+    /// audio engine clock reaches `engineTime`. From then on,
+    /// `getStatus()` reports it as stopped and the next call to
+    /// `play()` restarts it from the beginning.
+    ///
+    /// A pending scheduled stop is cancelled by `pause()` and `stop()`.
+    ///
+    /// \param engineTime Time of the audio engine clock at which to stop playing
+    ///
+    /// \see `playAt`, `sf::PlaybackDevice::getEngineTime`
+    ///
+    ////////////////////////////////////////////////////////////
+    void stopAt(Time engineTime);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the spatial properties of many sources and of the listener at once
+    ///
+    /// Calling `setPosition`, `setDirection` and `setVelocity`
+    /// on many moving sources every frame is costly, and since
+    /// the audio engine mixes concurrently, some of the changes
+    /// of a frame may be heard before the others. This function
+    /// queues all the changes, which the audio engine applies
+    /// together right before mixing its next period.
+    ///
+    /// The changes are thus visible through the getters of the
+    /// sources only once they were applied, and they override
+    /// the values set with the individual setters in between.
+    /// The listener properties returned by `sf::Listener` are
+    /// updated immediately.
+    ///
+    /// \param updates  Pointer to the array of source changes
+    /// \param count    Number of elements in the array
+    /// \param listener Changes of the listener properties
+    ///
+    /// \see `setPosition`, `setDirection`, `setVelocity`
+    ///
+    ////////////////////////////////////////////////////////////
+    static void updateSpatial(const SpatialUpdate* updates, std::size_t count, const ListenerUpdate& listener = {});
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the current status of the sound (stopped, paused, playing)
     ///
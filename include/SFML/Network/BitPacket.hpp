@@ -0,0 +1,471 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Network/Export.hpp>
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf
+{
+class String;
+
+////////////////////////////////////////////////////////////
+/// \brief Utility class to build compact, bit-packed blocks
+///        of data to transfer over the network
+///
+////////////////////////////////////////////////////////////
+class SFML_NETWORK_API BitPacket
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Append raw bytes to the packet
+    ///
+    /// The bytes are written at the current writing position,
+    /// which doesn't need to be aligned on a byte boundary.
+    /// This is typically used to fill the packet with data
+    /// received from the network before extracting it.
+    ///
+    /// \param data        Pointer to the sequence of bytes to append
+    /// \param sizeInBytes Number of bytes to append
+    ///
+    /// \see `clear`
+    ///
+    ////////////////////////////////////////////////////////////
+    void append(const void* data, std::size_t sizeInBytes);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Clear the packet
+    ///
+    /// After calling Clear, the packet is empty.
+    ///
+    /// \see `append`
+    ///
+    ////////////////////////////////////////////////////////////
+    void clear();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a pointer to the data contained in the packet
+    ///
+    /// The last byte is padded with zero bits if the number of
+    /// bits written is not a multiple of 8.
+    /// The returned pointer may become invalid after you append
+    /// data to the packet, therefore it should never be stored.
+    /// The return pointer is a `nullptr` if the packet is empty.
+    ///
+    /// \return Pointer to the data
+    ///
+    /// \see `getDataSize`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const void* getData() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of the data contained in the packet
+    ///
+    /// \return Data size, in bytes
+    ///
+    /// \see `getData`, `getBitCount`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getDataSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of bits contained in the packet
+    ///
+    /// \return Data size, in bits
+    ///
+    /// \see `getDataSize`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getBitCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the current reading position in the packet
+    ///
+    /// The next extraction will read data from this position.
+    ///
+    /// \return The bit offset of the current read position
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getReadPosition() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell if the reading position has reached the
+    ///        end of the packet
+    ///
+    /// Data appended with `append` always ends on a byte
+    /// boundary, so up to 7 padding bits may remain after
+    /// the last value written by the sender.
+    ///
+    /// \return `true` if all data was read, `false` otherwise
+    ///
+    /// \see `operator bool`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool endOfPacket() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Test the validity of the packet, for reading
+    ///
+    /// This operator behaves exactly like `sf::Packet::operator bool`:
+    /// it becomes `false` as soon as an extraction fails, and
+    /// stays `false` afterwards.
+    ///
+    /// \return `true` if last data extraction from packet was successful
+    ///
+    /// \see `endOfPacket`
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit operator bool() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Write the lowest bits of an unsigned integer
+    ///
+    /// This is typically used for enumerations or small
+    /// integers whose range is known in advance.
+    ///
+    /// \param value    Value to write
+    /// \param bitCount Number of bits to write, from 0 to 64
+    ///
+    /// \return Reference to the packet
+    ///
+    /// \see `readBits`
+    ///
+    ////////////////////////////////////////////////////////////
+    BitPacket& writeBits(std::uint64_t value, unsigned int bitCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Read an unsigned integer written with `writeBits`
+    ///
+    /// \param value    Variable to fill
+    /// \param bitCount Number of bits to read, from 0 to 64
+    ///
+    /// \return Reference to the packet
+    ///
+    /// \see `writeBits`
+    ///
+    ////////////////////////////////////////////////////////////
+    BitPacket& readBits(std::uint64_t& value, unsigned int bitCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Write a quantized floating point number
+    ///
+    /// \a value is clamped to [\a min, \a max] and mapped
+    /// linearly to an integer of \a bitCount bits, so that the
+    /// precision is (\a max - \a min) / (2 ^ \a bitCount - 1).
+    ///
+    /// \param value    Value to write
+    /// \param min      Minimum value of the range
+    /// \param max      Maximum value of the range
+    /// \param bitCount Number of bits to write, from 1 to 32
+    ///
+    /// \return Reference to the packet
+    ///
+    /// \see `readFloat`
+    ///
+    ////////////////////////////////////////////////////////////
+    BitPacket& writeFloat(float value, float min, float max, unsigned int bitCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Read a floating point number written with `writeFloat`
+    ///
+    /// The range and number of bits must be the same as the
+    /// ones used to write the value.
+    ///
+    /// \param value    Variable to fill
+    /// \param min      Minimum value of the range
+    /// \param max      Maximum value of the range
+    /// \param bitCount Number of bits to read, from 1 to 32
+    ///
+    /// \return Reference to the packet
+    ///
+    /// \see `writeFloat`
+    ///
+    ////////////////////////////////////////////////////////////
+    BitPacket& readFloat(float& value, float min, float max, unsigned int bitCount);
+
+    ////////////////////////////////////////////////////////////
+    /// Overload of `operator>>` to read data from the packet
+    ///
+    ////////////////////////////////////////////////////////////
+    BitPacket& operator>>(bool& data);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    BitPacket& operator>>(std::int8_t& data);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    BitPacket& operator>>(std::uint8_t& data);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    BitPacket& operator>>(std::int16_t& data);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    BitPacket& operator>>(std::uint16_t& data);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    BitPacket& operator>>(std::int32_t& data);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    BitPacket& operator>>(std::uint32_t& data);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    BitPacket& operator>>(std::int64_t& data);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    BitPacket& operator>>(std::uint64_t& data);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    BitPacket& operator>>(float& data);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    BitPacket& operator>>(double& data);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    BitPacket& operator>>(std::string& data);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    BitPacket& operator>>(String& data);
+
+    ////////////////////////////////////////////////////////////
+    /// Overload of `operator<<` to write data into the packet
+    ///
+    ////////////////////////////////////////////////////////////
+    BitPacket& operator<<(bool data);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    BitPacket& operator<<(std::int8_t data);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    BitPacket& operator<<(std::uint8_t data);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    BitPacket& operator<<(std::int16_t data);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    BitPacket& operator<<(std::uint16_t data);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    BitPacket& operator<<(std::int32_t data);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    BitPacket& operator<<(std::uint32_t data);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    BitPacket& operator<<(std::int64_t data);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    BitPacket& operator<<(std::uint64_t data);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    BitPacket& operator<<(float data);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    BitPacket& operator<<(double data);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    BitPacket& operator<<(const char* data);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    BitPacket& operator<<(const std::string& data);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    BitPacket& operator<<(std::string_view data);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    BitPacket& operator<<(const String& data);
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Write an unsigned integer as a LEB128 varint
+    ///
+    /// \param value Value to write
+    ///
+    ////////////////////////////////////////////////////////////
+    void writeVarint(std::uint64_t value);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Read an unsigned integer written as a LEB128 varint
+    ///
+    /// The packet becomes invalid if the value doesn't fit
+    /// in \a maxValue.
+    ///
+    /// \param value    Variable to fill
+    /// \param maxValue Maximum value allowed
+    ///
+    /// \return `true` if a value was extracted
+    ///
+    ////////////////////////////////////////////////////////////
+    bool readVarint(std::uint64_t& value, std::uint64_t maxValue);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Check if the packet can extract a given number of bits
+    ///
+    /// This function updates accordingly the state of the packet.
+    ///
+    /// \param bitCount Number of bits to check
+    ///
+    /// \return `true` if \a bitCount bits can be read from the packet
+    ///
+    ////////////////////////////////////////////////////////////
+    bool checkSize(std::size_t bitCount);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::vector<std::byte> m_data;          //!< Data stored in the packet
+    std::size_t            m_bitCount{};    //!< Number of bits written in the packet
+    std::size_t            m_readPos{};     //!< Current reading position in the packet, in bits
+    bool                   m_isValid{true}; //!< Reading state of the packet
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::BitPacket
+/// \ingroup network
+///
+/// `sf::BitPacket` is a companion of `sf::Packet` that trades
+/// a little CPU time for much smaller payloads, which is
+/// typically interesting for game state snapshots sent many
+/// times per second.
+///
+/// Instead of fixed-width integers, the data is packed at
+/// the bit level:
+/// \li `bool` values take a single bit
+/// \li 8-bit integers take 8 bits
+/// \li wider unsigned integers are written as LEB128 varints,
+///     so small values take a single byte
+/// \li wider signed integers are zig-zag encoded before being
+///     written as varints, so small negative values stay small
+/// \li `float` and `double` are written as raw IEEE 754 bits
+/// \li strings are prefixed with their length as a varint
+/// \li `writeBits` writes enumerations and small integers with
+///     exactly the required number of bits
+/// \li `writeFloat` quantizes floating point numbers in a known range
+///
+/// Bits are packed starting from the least significant bit of
+/// each byte, so the format doesn't depend on the endianness
+/// of the machine. It is not compatible with the format of
+/// `sf::Packet`.
+///
+/// Usage example:
+/// \code
+/// enum class Weapon { Sword, Bow, Staff, Wand };
+///
+/// // Write a snapshot
+/// sf::BitPacket bits;
+/// bits << alive << std::uint32_t{entityId};
+/// bits.writeBits(static_cast<std::uint64_t>(weapon), 2);
+/// bits.writeFloat(position.x, -1000.f, 1000.f, 20);
+/// bits.writeFloat(position.y, -1000.f, 1000.f, 20);
+///
+/// // Send it over the network as the content of a regular packet
+/// sf::Packet packet;
+/// packet.append(bits.getData(), bits.getDataSize());
+/// socket.send(packet);
+///
+/// -----------------------------------------------------------------
+///
+/// // Receive the packet at the other end
+/// sf::Packet packet;
+/// socket.receive(packet);
+///
+/// sf::BitPacket bits;
+/// bits.append(packet.getData(), packet.getDataSize());
+///
+/// std::uint64_t weapon = 0;
+/// if (bits >> alive >> entityId && bits.readBits(weapon, 2) &&
+///     bits.readFloat(position.x, -1000.f, 1000.f, 20).readFloat(position.y, -1000.f, 1000.f, 20))
+/// {
+///     // Data extracted successfully...
+/// }
+/// \endcode
+///
+/// \see `sf::Packet`
+///
+////////////////////////////////////////////////////////////
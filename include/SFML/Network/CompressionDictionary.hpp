@@ -0,0 +1,144 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Network/Export.hpp>
+
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Sample data shared by both ends of a connection
+///        to compress small packets better
+///
+////////////////////////////////////////////////////////////
+class SFML_NETWORK_API CompressionDictionary
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the dictionary from sample data
+    ///
+    /// Only the last 64 KiB of the data are used, since
+    /// compressed packets cannot refer to anything further.
+    /// The data is copied and indexed once, so that using the
+    /// dictionary to compress packets costs nothing more.
+    ///
+    /// \param data        Pointer to the sample data
+    /// \param sizeInBytes Size of the sample data, in bytes
+    ///
+    ////////////////////////////////////////////////////////////
+    CompressionDictionary(const void* data, std::size_t sizeInBytes);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a pointer to the content of the dictionary
+    ///
+    /// \return Pointer to the content of the dictionary
+    ///
+    /// \see `getDataSize`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const void* getData() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of the content of the dictionary
+    ///
+    /// \return Size of the content of the dictionary, in bytes
+    ///
+    /// \see `getData`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getDataSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the identifier of the dictionary
+    ///
+    /// The identifier is a hash of the content of the dictionary.
+    /// It is sent with the packets compressed with the dictionary,
+    /// so that a receiver using a different dictionary rejects
+    /// them instead of decoding garbage.
+    ///
+    /// \return Identifier of the dictionary
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::uint32_t getId() const;
+
+private:
+    friend class Packet;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::vector<std::byte>     m_data;      //!< Content of the dictionary
+    std::vector<std::uint32_t> m_hashTable; //!< Positions of the sequences of the content, for the compressor
+    std::uint32_t              m_id{};      //!< Hash of the content
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::CompressionDictionary
+/// \ingroup network
+///
+/// Small packets don't compress well on their own, because
+/// they don't contain enough data to repeat themselves.
+/// However, packets of a game often look alike: same
+/// structure, same names, similar values.
+///
+/// A dictionary is sample data that both ends of a connection
+/// know in advance, typically a few typical packets put
+/// together. Compressed packets may refer to it as if it
+/// preceded their own data, which makes even tiny packets
+/// much smaller.
+///
+/// The same dictionary must be used by the sender and the
+/// receiver. It is immutable, and can be shared by any number
+/// of packets, from any number of threads.
+///
+/// Usage example:
+/// \code
+/// // Build the dictionary from typical packets, on both ends
+/// sf::Packet sample;
+/// sample << "player" << std::uint32_t{0} << 0.f << 0.f << "idle" << "running" << "jumping";
+/// const auto dictionary = std::make_shared<sf::CompressionDictionary>(sample.getData(), sample.getDataSize());
+///
+/// // Compress packets with it
+/// sf::Packet packet;
+/// packet.setCompression(sf::Packet::Compression::Fast, dictionary);
+/// packet << "player" << id << x << y << "running";
+/// socket.send(packet);
+/// \endcode
+///
+/// \see `sf::Packet`
+///
+////////////////////////////////////////////////////////////
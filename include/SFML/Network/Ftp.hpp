@@ -34,9 +34,13 @@
 #include <SFML/System/Time.hpp>
 
 #include <filesystem>
+#include <functional>
 #include <string>
 #include <vector>
 
+#include <cstddef>
+#include <cstdint>
+
 
 namespace sf
 {
@@ -242,6 +246,26 @@ public:
         std::vector<std::string> m_listing; //!< Directory/file names extracted from the data
     };
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Progress of a file transfer
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Progress
+    {
+        std::uint64_t transferred{}; //!< Number of bytes of the file transferred so far, including a resumed part
+        std::uint64_t total{};       //!< Size of the file, or 0 if the server didn't tell
+        Time          elapsed;       //!< Time elapsed since the start of the transfer
+        double        throughput{};  //!< Average speed of the transfer, in bytes per second
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Function called while a file is transferred
+    ///
+    /// Returning false aborts the transfer.
+    ///
+    ////////////////////////////////////////////////////////////
+    using ProgressCallback = std::function<bool(const Progress& progress)>;
+
     ////////////////////////////////////////////////////////////
     /// \brief Default constructor
     ///
@@ -466,20 +490,31 @@ public:
     /// of your application.
     /// If a file with the same file name as the distant file
     /// already exists in the local destination path, it will
-    /// be overwritten.
+    /// be overwritten, unless `resume` is true: in that case
+    /// the existing file is considered as the beginning of the
+    /// distant one, and only the rest is downloaded (the server
+    /// must support the REST command). A partial file is removed
+    /// if the download fails, unless it can be resumed later.
+    ///
+    /// If the data connection fails or writing to the local file
+    /// fails before the end of the file, the response has the
+    /// `Response::Status::TransferAborted` status, whatever the
+    /// server answered.
     ///
     /// \param remoteFile File name of the distant file to download
     /// \param localPath  The directory in which to put the file on the local computer
     /// \param mode       Transfer mode
+    /// \param resume     Pass `true` to continue a previously interrupted download
     ///
     /// \return Server response to the request
     ///
-    /// \see `upload`
+    /// \see `upload`, `setProgressCallback`
     ///
     ////////////////////////////////////////////////////////////
     [[nodiscard]] Response download(const std::filesystem::path& remoteFile,
                                     const std::filesystem::path& localPath,
-                                    TransferMode                 mode = TransferMode::Binary);
+                                    TransferMode                 mode   = TransferMode::Binary,
+                                    bool                         resume = false);
 
     ////////////////////////////////////////////////////////////
     /// \brief Upload a file to the server
@@ -492,20 +527,70 @@ public:
     /// The append parameter controls whether the remote file is
     /// appended to or overwritten if it already exists.
     ///
+    /// If `resume` is true, the remote file is considered as the
+    /// beginning of the local one, and only the rest is uploaded
+    /// (the server must support the SIZE and REST commands).
+    ///
+    /// If reading the local file or the data connection fails
+    /// before the end of the file, the response has the
+    /// `Response::Status::TransferAborted` status, whatever the
+    /// server answered.
+    ///
     /// \param localFile  Path of the local file to upload
     /// \param remotePath The directory in which to put the file on the server
     /// \param mode       Transfer mode
     /// \param append     Pass `true` to append to or `false` to overwrite the remote file if it already exists
+    /// \param resume     Pass `true` to continue a previously interrupted upload
     ///
     /// \return Server response to the request
     ///
-    /// \see `download`
+    /// \see `download`, `setProgressCallback`
     ///
     ////////////////////////////////////////////////////////////
     [[nodiscard]] Response upload(const std::filesystem::path& localFile,
                                   const std::filesystem::path& remotePath,
                                   TransferMode                 mode   = TransferMode::Binary,
-                                  bool                         append = false);
+                                  bool                         append = false,
+                                  bool                         resume = false);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the size of the buffer used to transfer files
+    ///
+    /// Larger buffers need fewer system calls and keep up with
+    /// fast networks; the default is 256 KiB. On Linux, files are
+    /// transferred directly between the socket and the file by
+    /// the kernel, and this is the size of each step.
+    ///
+    /// \param size Size of the transfer buffer, in bytes
+    ///
+    /// \see `getTransferBufferSize`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTransferBufferSize(std::size_t size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of the buffer used to transfer files
+    ///
+    /// \return Size of the transfer buffer, in bytes
+    ///
+    /// \see `setTransferBufferSize`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getTransferBufferSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the function called while files are transferred
+    ///
+    /// The function is called by `download` and `upload` after
+    /// each step of the transfer, with the number of bytes
+    /// transferred so far and the average throughput. If it
+    /// returns false, the transfer is aborted and the response
+    /// has the `Response::Status::TransferAborted` status.
+    ///
+    /// \param callback Function to call, or an empty function to disable progress reports
+    ///
+    ////////////////////////////////////////////////////////////
+    void setProgressCallback(ProgressCallback callback);
 
     ////////////////////////////////////////////////////////////
     /// \brief Send a command to the FTP server
@@ -549,8 +634,10 @@ private:
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    TcpSocket   m_commandSocket; //!< Socket holding the control connection with the server
-    std::string m_receiveBuffer; //!< Received command data that is yet to be processed
+    TcpSocket        m_commandSocket;                  //!< Socket holding the control connection with the server
+    std::string      m_receiveBuffer;                  //!< Received command data that is yet to be processed
+    std::size_t      m_transferBufferSize{256 * 1024}; //!< Size of the buffer used to transfer files
+    ProgressCallback m_progressCallback;               //!< Function called while files are transferred
 };
 
 } // namespace sf
@@ -585,7 +672,9 @@ private:
 /// All commands, especially upload and download, may take some
 /// time to complete. This is important to know if you don't want
 /// to block your application while the server is completing
-/// the task.
+/// the task. The progress of uploads and downloads can be
+/// followed with `setProgressCallback`, and an interrupted
+/// transfer can be resumed later.
 ///
 /// Usage example:
 /// \code
@@ -30,14 +30,17 @@
 #include <SFML/Network/Export.hpp>
 
 #include <SFML/Network/IpAddress.hpp>
-#include <SFML/Network/TcpSocket.hpp>
 
 #include <SFML/System/Time.hpp>
 
+#include <functional>
+#include <future>
 #include <iosfwd>
 #include <map>
-#include <optional>
 #include <string>
+#include <vector>
+
+#include <cstddef>
 
 
 namespace sf
@@ -289,6 +292,9 @@ public:
         /// \li nothing (for HEAD requests)
         /// \li an error message (in case of an error)
         ///
+        /// The body is empty if it was streamed instead (see
+        /// `Http::sendRequest`).
+        ///
         /// \return The response body
         ///
         ////////////////////////////////////////////////////////////
@@ -335,6 +341,25 @@ public:
         std::string  m_body;                             //!< Body of the response
     };
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Function called with the header of a streamed response
+    ///
+    /// The response has its status and fields, but no body yet.
+    /// Returning false stops the transfer.
+    ///
+    ////////////////////////////////////////////////////////////
+    using HeaderCallback = std::function<bool(const Response& response)>;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Function called with each piece of a streamed response body
+    ///
+    /// The pieces are decoded (chunked transfer encoding is
+    /// removed) and passed as soon as they are received.
+    /// Returning false stops the transfer.
+    ///
+    ////////////////////////////////////////////////////////////
+    using BodyCallback = std::function<bool(const char* data, std::size_t size)>;
+
     ////////////////////////////////////////////////////////////
     /// \brief Default constructor
     ///
@@ -374,6 +399,8 @@ public:
     ///
     /// This function just stores the host address and port, it
     /// doesn't actually connect to it until you send a request.
+    /// The host name is resolved in the background meanwhile (see
+    /// `IpAddress::resolveAsync`), so this function doesn't block.
     /// The port has a default value of 0, which means that the
     /// HTTP client will use the right port according to the
     /// protocol used (80 for HTTP). You should leave it like
@@ -386,6 +413,37 @@ public:
     ////////////////////////////////////////////////////////////
     void setHost(const std::string& host, unsigned short port = 0);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable persistent connections
+    ///
+    /// When enabled, which is the default, the connection to the
+    /// host is kept open after a response and reused by the next
+    /// requests to the same host, possibly from another `Http`
+    /// instance (see `setMaxIdleConnections`). This saves a
+    /// connection setup per request, which matters when sending
+    /// many small requests.
+    ///
+    /// The server can still decide to close the connection, and
+    /// a request can opt out by setting its "Connection" field
+    /// to "close".
+    ///
+    /// \param keepAlive True to reuse connections, false to close them after each response
+    ///
+    /// \see `getKeepAlive`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setKeepAlive(bool keepAlive);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether persistent connections are enabled
+    ///
+    /// \return True if connections are reused
+    ///
+    /// \see `setKeepAlive`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool getKeepAlive() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Send a HTTP request and return the server's response.
     ///
@@ -396,24 +454,150 @@ public:
     /// not return instantly; use a thread if you don't want to block your
     /// application, or use a timeout to limit the time to wait. A value
     /// of `Time::Zero` means that the client will use the system default timeout
-    /// (which is usually pretty long).
+    /// (which is usually pretty long). The timeout covers both the
+    /// resolution of the host name and the connection; if the host
+    /// has several addresses, they are tried in turn within it.
+    ///
+    /// If the request is sent over a persistent connection that
+    /// the server closes without answering, it is sent again on a
+    /// new connection, but only if its method is idempotent (GET,
+    /// HEAD, PUT, DELETE): the server may have processed a POST
+    /// request already, so its response has the status
+    /// `Response::Status::ConnectionFailed` instead.
     ///
     /// \param request Request to send
     /// \param timeout Maximum time to wait
     ///
     /// \return Server's response
     ///
+    /// \see `sendRequests`
+    ///
     ////////////////////////////////////////////////////////////
     [[nodiscard]] Response sendRequest(const Request& request, Time timeout = Time::Zero);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Send a HTTP request and stream the server's response body to a function
+    ///
+    /// Unlike the other overload, the body isn't stored in the
+    /// response: `onHeader` is called as soon as the header of the
+    /// response is received, then `onBody` with each piece of the
+    /// body as it arrives. This is the way to download large
+    /// resources without holding them in memory, or to process
+    /// them while they are being received.
+    ///
+    /// If a function returns false, the transfer is stopped and
+    /// the connection is closed.
+    ///
+    /// If the connection is closed before the end of the body, the
+    /// status of the response is `Response::Status::ConnectionFailed`,
+    /// or `Response::Status::InvalidResponse` if the chunks of the
+    /// body are malformed, so that a truncated download can't be
+    /// mistaken for a complete one.
+    ///
+    /// \param request  Request to send
+    /// \param onBody   Function called with each piece of the body
+    /// \param onHeader Function called with the response before its body, may be empty
+    /// \param timeout  Maximum time to wait for the connection to the host
+    ///
+    /// \return Server's response, without its body
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Response sendRequest(const Request&        request,
+                                       const BodyCallback&   onBody,
+                                       const HeaderCallback& onHeader = {},
+                                       Time                  timeout  = Time::Zero);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Send a HTTP request and stream the server's response body to an output stream
+    ///
+    /// The body is written to `body` as it arrives, whatever the
+    /// status of the response; check the status of the returned
+    /// response to know whether it's the requested resource.
+    /// The transfer is stopped if writing to the stream fails.
+    /// A body cut short is reported like with the other streaming
+    /// overload.
+    ///
+    /// \param request Request to send
+    /// \param body    Stream to write the body to
+    /// \param timeout Maximum time to wait for the connection to the host
+    ///
+    /// \return Server's response, without its body
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Response sendRequest(const Request& request, std::ostream& body, Time timeout = Time::Zero);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Send several HTTP requests at once and return the server's responses
+    ///
+    /// The requests are pipelined: they are all written to the
+    /// connection before waiting for the first response, so that
+    /// the server can answer them back to back. If the server
+    /// closes the connection before answering all of them, the
+    /// remaining requests are sent again on a new connection, up
+    /// to the first one that isn't idempotent (see `sendRequest`);
+    /// the responses from there on have the status
+    /// `Response::Status::ConnectionFailed`.
+    ///
+    /// Pipelining requires persistent connections: if they are
+    /// disabled, the requests are sent one after the other.
+    ///
+    /// \param requests Requests to send
+    /// \param timeout  Maximum time to wait for the connection to the host
+    ///
+    /// \return Server's responses, in the same order as the requests
+    ///
+    /// \see `sendRequest`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::vector<Response> sendRequests(const std::vector<Request>& requests, Time timeout = Time::Zero);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the maximum number of idle connections kept open per host
+    ///
+    /// Persistent connections are kept in a pool shared by all
+    /// the `Http` instances when they are not used. The default
+    /// maximum is 8 per host; 0 disables the pool entirely.
+    ///
+    /// \param count Maximum number of idle connections per host
+    ///
+    /// \see `closeIdleConnections`, `setKeepAlive`
+    ///
+    ////////////////////////////////////////////////////////////
+    static void setMaxIdleConnections(std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Close all the idle connections of the pool
+    ///
+    /// \see `setMaxIdleConnections`
+    ///
+    ////////////////////////////////////////////////////////////
+    static void closeIdleConnections();
+
 private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Send requests and receive the server's responses, storing or streaming their bodies
+    ///
+    /// \param requests Requests to send
+    /// \param timeout  Maximum time to wait for the connection to the host
+    /// \param onHeader Function called with each response before its body, may be empty
+    /// \param onBody   Function called with the pieces of the bodies, or empty to store them in the responses
+    ///
+    /// \return Server's responses, in the same order as the requests
+    ///
+    ////////////////////////////////////////////////////////////
+    std::vector<Response> sendAndReceive(const std::vector<Request>& requests,
+                                         Time                        timeout,
+                                         const HeaderCallback&       onHeader,
+                                         const BodyCallback&         onBody);
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    TcpSocket                m_connection; //!< Connection to the host
-    std::optional<IpAddress> m_host;       //!< Web host address
-    std::string              m_hostName;   //!< Web host name
-    unsigned short           m_port{};     //!< Port used for connection with host
+    std::vector<IpAddress>              m_addresses;       //!< Web host addresses, the last one connected to first
+    std::future<std::vector<IpAddress>> m_resolution;      //!< Pending resolution of the host name
+    std::string                         m_hostName;        //!< Web host name
+    unsigned short                      m_port{};          //!< Port used for connection with host
+    bool                                m_keepAlive{true}; //!< Reuse connections between requests?
 };
 
 } // namespace sf
@@ -451,6 +635,14 @@ private:
 /// `sf::Http::Request` and return the corresponding `sf::Http::Response`
 /// from the server.
 ///
+/// Connections are persistent by default: once a response has
+/// been received, the connection is kept open in a pool and
+/// reused by the next request to the same host. The end of each
+/// response is found with its "Content-Length" field or its
+/// chunked encoding, so the server doesn't need to close the
+/// connection. Several requests can also be pipelined on a
+/// single connection with `sendRequests`.
+///
 /// Usage example:
 /// \code
 /// // Create a new HTTP client
@@ -477,4 +669,12 @@ private:
 /// }
 /// \endcode
 ///
+/// Large resources don't have to be held in memory: their body
+/// can be streamed to a function or to an output stream as it
+/// is received.
+/// \code
+/// std::ofstream file("patch.zip", std::ios::binary);
+/// sf::Http::Response response = http.sendRequest(sf::Http::Request("/patch.zip"), file);
+/// \endcode
+///
 ////////////////////////////////////////////////////////////
@@ -31,10 +31,12 @@
 
 #include <SFML/System/Time.hpp>
 
+#include <future>
 #include <iosfwd>
 #include <optional>
 #include <string>
 #include <string_view>
+#include <vector>
 
 #include <cstdint>
 
@@ -58,9 +60,77 @@ public:
     ///
     /// \return Address if provided argument was valid, otherwise `std::nullopt`
     ///
+    /// \see `resolveAll`, `resolveAsync`
+    ///
     ////////////////////////////////////////////////////////////
     [[nodiscard]] static std::optional<IpAddress> resolve(std::string_view address);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get all the addresses of a network name
+    ///
+    /// A host name may resolve to several addresses, for example
+    /// a web site served by several machines; they are returned
+    /// in the order given by the system, which is the order in
+    /// which they should be tried. `resolve` returns the first one.
+    ///
+    /// Host names are looked up by the system resolver, which may
+    /// take a long time, and the results are cached for the next
+    /// resolutions (see `setResolverCacheDuration`).
+    ///
+    /// \param address IP address or network name
+    ///
+    /// \return Addresses of the host, empty if the resolution failed
+    ///
+    /// \see `resolve`, `resolveAsync`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static std::vector<IpAddress> resolveAll(std::string_view address);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Start resolving a network name in the background
+    ///
+    /// This function returns immediately; the resolution runs in
+    /// a small pool of threads, and its result is given by the
+    /// returned future: wait for it with a time limit using
+    /// `wait_for`, or poll it with a zero time limit. Decimal
+    /// addresses and cached names are ready right away.
+    ///
+    /// \param address IP address or network name
+    ///
+    /// \return Future holding the addresses of the host, empty if the resolution failed
+    ///
+    /// \see `resolveAll`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static std::future<std::vector<IpAddress>> resolveAsync(std::string_view address);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set how long resolved names are cached
+    ///
+    /// The cache is shared by all the resolutions of the network
+    /// module, including the ones of `Http`. Failed
+    /// resolutions are cached as well, usually for a shorter time,
+    /// so that a missing host doesn't cost a lookup every time.
+    /// A zero duration disables the caching. The defaults are
+    /// 60 seconds for successful resolutions and 10 seconds for
+    /// failed ones.
+    ///
+    /// \param positive How long successful resolutions are cached
+    /// \param negative How long failed resolutions are cached
+    ///
+    /// \see `clearResolverCache`
+    ///
+    ////////////////////////////////////////////////////////////
+    static void setResolverCacheDuration(Time positive, Time negative);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Forget all the cached resolutions
+    ///
+    /// \see `setResolverCacheDuration`
+    ///
+    ////////////////////////////////////////////////////////////
+    static void clearResolverCache();
+
     ////////////////////////////////////////////////////////////
     /// \brief Construct the address from 4 bytes
     ///
@@ -291,6 +361,18 @@ SFML_NETWORK_API std::ostream& operator<<(std::ostream& stream, IpAddress addres
 /// auto a9 = sf::IpAddress::getPublicAddress();        // my address on the internet
 /// \endcode
 ///
+/// Host names can also be resolved without blocking:
+/// \code
+/// auto resolution = sf::IpAddress::resolveAsync("www.sfml-dev.org");
+///
+/// // ... later, once per frame
+/// if (resolution.wait_for(sf::Time::Zero.toDuration()) == std::future_status::ready)
+/// {
+///     for (sf::IpAddress address : resolution.get())
+///         std::cout << address << std::endl;
+/// }
+/// \endcode
+///
 /// Note that `sf::IpAddress` currently doesn't support IPv6
 /// nor other types of network addresses.
 ///
@@ -0,0 +1,420 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Network/Export.hpp>
+
+#include <SFML/Network/IpAddress.hpp>
+#include <SFML/Network/Socket.hpp>
+
+#include <SFML/System/Time.hpp>
+
+#include <functional>
+#include <memory>
+#include <optional>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf
+{
+class Packet;
+class TcpListener;
+class TcpSocket;
+class UdpSocket;
+
+////////////////////////////////////////////////////////////
+/// \brief Event loop running asynchronous socket operations and timers
+///
+////////////////////////////////////////////////////////////
+class SFML_NETWORK_API NetworkReactor
+{
+public:
+    ////////////////////////////////////////////////////////////
+    // Types
+    ////////////////////////////////////////////////////////////
+    using TimerId = std::uint64_t; //!< Identifier of a timer, as returned by `addTimer`
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Handler of posted functions and timers
+    ///
+    ////////////////////////////////////////////////////////////
+    using Handler = std::function<void()>;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Handler of the operations that only report a status
+    ///
+    ////////////////////////////////////////////////////////////
+    using StatusHandler = std::function<void(Socket::Status status)>;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Handler of TCP receptions
+    ///
+    ////////////////////////////////////////////////////////////
+    using ReceiveHandler = std::function<void(Socket::Status status, std::size_t received)>;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Handler of UDP receptions
+    ///
+    ////////////////////////////////////////////////////////////
+    using ReceiveFromHandler = std::function<void(Socket::Status           status,
+                                                  std::size_t              received,
+                                                  std::optional<IpAddress> remoteAddress,
+                                                  unsigned short           remotePort)>;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    NetworkReactor();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// Pending operations and timers are discarded without
+    /// calling their handler. The reactor must not be running
+    /// when it is destroyed.
+    ///
+    ////////////////////////////////////////////////////////////
+    ~NetworkReactor();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    NetworkReactor(const NetworkReactor&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    NetworkReactor& operator=(const NetworkReactor&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Accept a new connection asynchronously
+    ///
+    /// \a handler is called once a connection has been accepted
+    /// into \a socket, or once accepting failed. Both the listener
+    /// and the socket are switched to non-blocking mode, and they
+    /// must stay alive until the handler is called.
+    ///
+    /// \param listener Listener to accept a connection from
+    /// \param socket   Socket that will hold the new connection
+    /// \param handler  Function to call with the status of the operation
+    ///
+    /// \see `sf::TcpListener::accept`
+    ///
+    ////////////////////////////////////////////////////////////
+    void asyncAccept(TcpListener& listener, TcpSocket& socket, StatusHandler handler);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Connect a TCP socket asynchronously
+    ///
+    /// The connection is started immediately in non-blocking
+    /// mode, and \a handler is called once it is established
+    /// or once it failed.
+    ///
+    /// \param socket        Socket to connect
+    /// \param remoteAddress Address of the remote peer
+    /// \param remotePort    Port of the remote peer
+    /// \param handler       Function to call with the status of the operation
+    ///
+    /// \see `sf::TcpSocket::connect`
+    ///
+    ////////////////////////////////////////////////////////////
+    void asyncConnect(TcpSocket& socket, IpAddress remoteAddress, unsigned short remotePort, StatusHandler handler);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Send raw data asynchronously over a TCP socket
+    ///
+    /// The data is copied, so the buffer can be reused as soon
+    /// as this function returns. Sends of a same socket are
+    /// queued and performed in order; partial sends are resumed
+    /// automatically when the socket becomes writable again, so
+    /// \a handler only receives `Status::Done` once every byte
+    /// has been sent, or the error that stopped the transfer.
+    ///
+    /// \param socket  Socket to send the data through
+    /// \param data    Pointer to the sequence of bytes to send
+    /// \param size    Number of bytes to send
+    /// \param handler Function to call with the status of the operation
+    ///
+    ////////////////////////////////////////////////////////////
+    void asyncSend(TcpSocket& socket, const void* data, std::size_t size, StatusHandler handler);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Send a packet asynchronously over a TCP socket
+    ///
+    /// The packet is copied, and it is sent with the same
+    /// framing as `sf::TcpSocket::send`, which means that it
+    /// can be received by a regular `sf::TcpSocket::receive`
+    /// or by the packet overload of `asyncReceive`.
+    ///
+    /// \param socket  Socket to send the packet through
+    /// \param packet  Packet to send
+    /// \param handler Function to call with the status of the operation
+    ///
+    ////////////////////////////////////////////////////////////
+    void asyncSend(TcpSocket& socket, const Packet& packet, StatusHandler handler);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Receive raw data asynchronously from a TCP socket
+    ///
+    /// \a handler is called as soon as some data has been
+    /// received, which may be less than \a size bytes. The
+    /// buffer must stay valid until the handler is called.
+    ///
+    /// \param socket  Socket to receive the data from
+    /// \param data    Pointer to the buffer to fill with the received data
+    /// \param size    Maximum number of bytes that can be received
+    /// \param handler Function to call with the status of the operation and the number of bytes received
+    ///
+    ////////////////////////////////////////////////////////////
+    void asyncReceive(TcpSocket& socket, void* data, std::size_t size, ReceiveHandler handler);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Receive a packet asynchronously from a TCP socket
+    ///
+    /// \a handler is called once a whole packet has been
+    /// received. The packet must stay alive until then.
+    ///
+    /// \param socket  Socket to receive the packet from
+    /// \param packet  Packet to fill with the received data
+    /// \param handler Function to call with the status of the operation
+    ///
+    ////////////////////////////////////////////////////////////
+    void asyncReceive(TcpSocket& socket, Packet& packet, StatusHandler handler);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Send a datagram asynchronously over a UDP socket
+    ///
+    /// The data is copied, so the buffer can be reused as soon
+    /// as this function returns.
+    ///
+    /// \param socket        Socket to send the data through
+    /// \param data          Pointer to the sequence of bytes to send
+    /// \param size          Number of bytes to send
+    /// \param remoteAddress Address of the receiver
+    /// \param remotePort    Port of the receiver to send the data to
+    /// \param handler       Function to call with the status of the operation
+    ///
+    ////////////////////////////////////////////////////////////
+    void asyncSend(UdpSocket&     socket,
+                   const void*    data,
+                   std::size_t    size,
+                   IpAddress      remoteAddress,
+                   unsigned short remotePort,
+                   StatusHandler  handler);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Receive a datagram asynchronously from a UDP socket
+    ///
+    /// The buffer must stay valid until \a handler is called.
+    ///
+    /// \param socket  Socket to receive the data from
+    /// \param data    Pointer to the buffer to fill with the received data
+    /// \param size    Maximum number of bytes that can be received
+    /// \param handler Function to call with the status of the operation and the sender of the datagram
+    ///
+    ////////////////////////////////////////////////////////////
+    void asyncReceive(UdpSocket& socket, void* data, std::size_t size, ReceiveFromHandler handler);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Cancel all the pending operations of a socket
+    ///
+    /// The handlers of the cancelled operations are not called.
+    /// A socket must not be closed or destroyed while it still
+    /// has pending operations; call this function first.
+    ///
+    /// \param socket Socket whose operations to cancel
+    ///
+    ////////////////////////////////////////////////////////////
+    void cancel(Socket& socket);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Call a function from one of the threads running the reactor
+    ///
+    /// \param handler Function to call
+    ///
+    ////////////////////////////////////////////////////////////
+    void post(Handler handler);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Call a function after a delay
+    ///
+    /// \param delay   Time to wait before calling the function
+    /// \param handler Function to call
+    ///
+    /// \return Identifier of the timer, to be passed to `cancelTimer`
+    ///
+    /// \see `cancelTimer`
+    ///
+    ////////////////////////////////////////////////////////////
+    TimerId addTimer(Time delay, Handler handler);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Cancel a timer before it expires
+    ///
+    /// \param id Identifier of the timer, as returned by `addTimer`
+    ///
+    /// \return `true` if the timer was cancelled, `false` if it already expired or doesn't exist
+    ///
+    /// \see `addTimer`
+    ///
+    ////////////////////////////////////////////////////////////
+    bool cancelTimer(TimerId id);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Run the event loop
+    ///
+    /// This function blocks until `stop` is called, or until
+    /// there are no more pending operations, posted functions
+    /// or timers. Handlers are called from the threads running
+    /// the loop: when \a threadCount is greater than 1, extra
+    /// threads are started and handlers may run concurrently.
+    /// This function can also be called from several threads
+    /// of your own to form a pool.
+    ///
+    /// \param threadCount Number of threads running the loop, including the calling one
+    ///
+    /// \see `poll`, `stop`
+    ///
+    ////////////////////////////////////////////////////////////
+    void run(unsigned int threadCount = 1);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Call the handlers that are ready, without blocking
+    ///
+    /// This is convenient to drive the reactor from the main
+    /// loop of a game instead of dedicated threads.
+    ///
+    /// \return Number of handlers that were called
+    ///
+    /// \see `run`
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t poll();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Make all the threads running the loop return
+    ///
+    /// Threads return as soon as they are done with the
+    /// handlers they are currently calling. Pending operations
+    /// are kept, and `run` can be called again once all the
+    /// threads have returned.
+    ///
+    /// \see `run`
+    ///
+    ////////////////////////////////////////////////////////////
+    void stop();
+
+private:
+    struct Impl;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::unique_ptr<Impl> m_impl; //!< Implementation details
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::NetworkReactor
+/// \ingroup network
+///
+/// `sf::NetworkReactor` is an alternative to polling
+/// non-blocking sockets or calling `sf::SocketSelector::wait`
+/// in a loop. Operations are started with the `async*`
+/// functions and complete in the background; their handler
+/// is then called from a thread running the reactor (`run`
+/// or `poll`), never from the function that started them.
+///
+/// Each socket has a queue of pending receptions and a queue
+/// of pending sends, so several operations of the same kind
+/// can be started without waiting for the previous ones; they
+/// complete in order. Sockets used with the reactor are
+/// switched to non-blocking mode, and they must not be used
+/// directly while they have pending operations.
+///
+/// On Linux the reactor is built on epoll, so it scales to a
+/// large number of sockets. Other systems use `select`.
+///
+/// Usage example:
+/// \code
+/// sf::NetworkReactor reactor;
+///
+/// sf::TcpListener listener;
+/// if (listener.listen(55001) != sf::Socket::Status::Done)
+/// {
+///     // Handle error...
+/// }
+///
+/// struct Client
+/// {
+///     sf::TcpSocket socket;
+///     sf::Packet    packet;
+/// };
+///
+/// std::list<Client> clients;
+///
+/// std::function<void(Client&)> receive = [&](Client& client)
+/// {
+///     reactor.asyncReceive(client.socket, client.packet, [&](sf::Socket::Status status)
+///     {
+///         if (status != sf::Socket::Status::Done)
+///             return; // Disconnected
+///
+///         // Echo the packet and wait for the next one
+///         reactor.asyncSend(client.socket, client.packet, nullptr);
+///         receive(client);
+///     });
+/// };
+///
+/// std::function<void()> accept = [&]
+/// {
+///     Client& client = clients.emplace_back();
+///     reactor.asyncAccept(listener, client.socket, [&](sf::Socket::Status status)
+///     {
+///         if (status == sf::Socket::Status::Done)
+///             receive(client);
+///         accept();
+///     });
+/// };
+///
+/// accept();
+///
+/// // Run the loop on 4 threads
+/// reactor.run(4);
+/// \endcode
+///
+/// \see `sf::SocketSelector`
+///
+////////////////////////////////////////////////////////////
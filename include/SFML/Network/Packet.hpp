@@ -29,6 +29,7 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Network/Export.hpp>
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -38,6 +39,7 @@
 
 namespace sf
 {
+class CompressionDictionary;
 class String;
 
 ////////////////////////////////////////////////////////////
@@ -48,6 +50,16 @@ class String;
 class SFML_NETWORK_API Packet
 {
 public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Compression applied to the data sent over the network
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class Compression
+    {
+        None, //!< The data is sent as it is
+        Fast  //!< The data is compressed with a fast LZ algorithm, when it makes it smaller
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief Default constructor
     ///
@@ -60,7 +72,7 @@ public:
     /// \brief Virtual destructor
     ///
     ////////////////////////////////////////////////////////////
-    virtual ~Packet() = default;
+    virtual ~Packet();
 
     ////////////////////////////////////////////////////////////
     /// \brief Copy constructor
@@ -148,6 +160,46 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] std::size_t getDataSize() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the compression applied to the packet when
+    ///        it is sent and received
+    ///
+    /// The sender and the receiver must use the same compression
+    /// and the same dictionary. Compression only changes what
+    /// travels over the network: the data of the packet, as
+    /// returned by `getData`, is never compressed.
+    ///
+    /// With `Compression::Fast`, data that doesn't get smaller
+    /// is sent as it is, with a single extra byte.
+    /// Packets that fail to be decompressed are left empty
+    /// and invalid.
+    ///
+    /// The compression is applied by the default implementations
+    /// of `onSend` and `onReceive`, so packets overriding them
+    /// must handle it themselves. The compression of the packets
+    /// created by `sf::TcpSocket::receive(std::vector<Packet>&)`
+    /// is passed to that function.
+    ///
+    /// By default, packets are not compressed.
+    ///
+    /// \param compression Compression to apply
+    /// \param dictionary  Dictionary shared with the remote peer, to compress small packets better
+    ///
+    /// \see `getCompression`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setCompression(Compression compression, std::shared_ptr<const CompressionDictionary> dictionary = nullptr);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the compression applied to the packet
+    ///
+    /// \return Compression applied to the packet
+    ///
+    /// \see `setCompression`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Compression getCompression() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Tell if the reading position has reached the
     ///        end of the packet
@@ -364,8 +416,138 @@ public:
     ////////////////////////////////////////////////////////////
     Packet& operator<<(const String& data);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Read an array of values from the packet
+    ///
+    /// This gives the same result as extracting the values one
+    /// by one with `operator>>`, but the size is checked once
+    /// and all the values are converted from network byte order
+    /// in a single pass.
+    /// Nothing is read if the packet doesn't contain all the values.
+    ///
+    /// \param data  Pointer to the array to fill
+    /// \param count Number of values to read
+    ///
+    /// \return Reference to the packet
+    ///
+    /// \see `write`
+    ///
+    ////////////////////////////////////////////////////////////
+    Packet& read(std::int8_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& read(std::uint8_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& read(std::int16_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& read(std::uint16_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& read(std::int32_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& read(std::uint32_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& read(std::int64_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& read(std::uint64_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& read(float* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& read(double* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Write an array of values into the packet
+    ///
+    /// This gives the same result as inserting the values one
+    /// by one with `operator<<`, but the packet grows only once
+    /// and all the values are converted to network byte order
+    /// in a single pass.
+    /// The number of values is not written, it is up to you to
+    /// send it if the receiver cannot know it in advance.
+    ///
+    /// \param data  Pointer to the array of values to write
+    /// \param count Number of values to write
+    ///
+    /// \return Reference to the packet
+    ///
+    /// \see `read`
+    ///
+    ////////////////////////////////////////////////////////////
+    Packet& write(const std::int8_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& write(const std::uint8_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& write(const std::int16_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& write(const std::uint16_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& write(const std::int32_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& write(const std::uint32_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& write(const std::int64_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& write(const std::uint64_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& write(const float* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& write(const double* data, std::size_t count);
+
 protected:
     friend class TcpSocket;
+    friend class UdpConnection;
     friend class UdpSocket;
 
     ////////////////////////////////////////////////////////////
@@ -376,8 +558,8 @@ protected:
     /// used for compression, encryption, etc.
     /// The function must return a pointer to the modified data,
     /// as well as the number of bytes pointed.
-    /// The default implementation provides the packet's data
-    /// without transforming it.
+    /// The default implementation provides the packet's data,
+    /// compressed if compression was enabled with `setCompression`.
     ///
     /// \param size Variable to fill with the size of data to send
     ///
@@ -396,8 +578,9 @@ protected:
     /// used for decompression, decryption, etc.
     /// The function receives a pointer to the received data,
     /// and must fill the packet with the transformed bytes.
-    /// The default implementation fills the packet directly
-    /// without transforming the data.
+    /// The default implementation fills the packet directly,
+    /// decompressing the data if compression was enabled with
+    /// `setCompression`.
     ///
     /// \param data Pointer to the received bytes
     /// \param size Number of bytes
@@ -409,24 +592,41 @@ protected:
 
 private:
     ////////////////////////////////////////////////////////////
-    /// \brief Check if the packet can extract a given number of bytes
+    /// \brief Extract data from the current reading position
     ///
-    /// This function updates accordingly the state of the packet.
+    /// The decoding is delegated to `sf::PacketView`, and the
+    /// reading state of the packet is updated accordingly.
     ///
-    /// \param size Size to check
+    /// \param function Function reading data from the view
     ///
-    /// \return `true` if \a size bytes can be read from the packet
+    /// \return Reference to the packet
     ///
     ////////////////////////////////////////////////////////////
-    bool checkSize(std::size_t size);
+    template <typename Function>
+    Packet& extract(Function function);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Write an array of values at the end of the packet
+    ///
+    /// \param data  Pointer to the array of values to write
+    /// \param count Number of values to write
+    ///
+    /// \return Reference to the packet
+    ///
+    ////////////////////////////////////////////////////////////
+    template <typename T>
+    Packet& writeArray(const T* data, std::size_t count);
 
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    std::vector<std::byte> m_data;          //!< Data stored in the packet
-    std::size_t            m_readPos{};     //!< Current reading position in the packet
-    std::size_t            m_sendPos{};     //!< Current send position in the packet (for handling partial sends)
-    bool                   m_isValid{true}; //!< Reading state of the packet
+    std::vector<std::byte>                       m_data;                           //!< Data stored in the packet
+    std::size_t                                  m_readPos{};                      //!< Current reading position in the packet
+    std::size_t                                  m_sendPos{};                      //!< Current send position in the packet (for handling partial sends)
+    bool                                         m_isValid{true};                  //!< Reading state of the packet
+    Compression                                  m_compression{Compression::None}; //!< Compression applied when sending and receiving
+    std::shared_ptr<const CompressionDictionary> m_dictionary;                     //!< Dictionary shared with the remote peer, if any
+    std::vector<std::byte>                       m_compressedData;                 //!< Data compressed by onSend, kept to reuse its memory
 };
 
 } // namespace sf
@@ -490,6 +690,11 @@ private:
 /// \li floating point numbers (`float`, `double`)
 /// \li string types (`char*`, `wchar_t*`, `std::string`, `std::wstring`, `sf::String`)
 ///
+/// Arrays of numbers, such as tile maps or terrain heights,
+/// can be inserted and extracted at once with `write` and
+/// `read`. This produces the same data as inserting the values
+/// one by one, but much faster.
+///
 /// Like standard streams, it is also possible to define your own
 /// overloads of operators >> and << in order to handle your
 /// custom types.
@@ -513,6 +718,15 @@ private:
 /// }
 /// \endcode
 ///
+/// Packets can compress their data when they are sent, and
+/// decompress it when they are received, with a fast built-in
+/// algorithm. The sender and the receiver only need to enable
+/// the same compression:
+/// \code
+/// sf::Packet packet;
+/// packet.setCompression(sf::Packet::Compression::Fast);
+/// \endcode
+///
 /// Packets also provide an extra feature that allows to apply
 /// custom transformations to the data before it is sent,
 /// and after it is received. This is typically used to
@@ -547,6 +761,9 @@ private:
 /// ...
 /// \endcode
 ///
-/// \see `sf::TcpSocket`, `sf::UdpSocket`
+/// To read serialized data without copying it into a packet
+/// first, use `sf::PacketView`.
+///
+/// \see `sf::TcpSocket`, `sf::UdpSocket`, `sf::PacketView`
 ///
 ////////////////////////////////////////////////////////////
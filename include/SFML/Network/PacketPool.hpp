@@ -0,0 +1,179 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Network/Export.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+
+////////////////////////////////////////////////////////////
+/// \brief Recycle the memory of packets to avoid allocating
+///        it for every message
+///
+////////////////////////////////////////////////////////////
+namespace sf::PacketPool
+{
+////////////////////////////////////////////////////////////
+/// \brief Structure holding the statistics of the pool
+///
+////////////////////////////////////////////////////////////
+struct Statistics
+{
+    std::uint64_t hits{};            //!< Number of times a packet got its storage from the pool
+    std::uint64_t misses{};          //!< Number of times a packet had to allocate its storage
+    std::uint64_t discarded{};       //!< Number of buffers freed because the pool was full or they were too large
+    std::size_t   pooledBuffers{};   //!< Number of buffers currently kept by the pools of all threads
+    std::size_t   pooledBytes{};     //!< Memory currently kept by the pools of all threads, in bytes
+    std::size_t   peakPooledBytes{}; //!< Highest value reached by `pooledBytes`
+};
+
+////////////////////////////////////////////////////////////
+/// \brief Set the maximum number of buffers kept by each thread
+///
+/// Setting it to 0 disables the pool: packets then allocate
+/// and free their memory themselves.
+/// Threads whose pool exceeds the new limit free their extra
+/// buffers as they release new ones.
+/// The default value is 64.
+///
+/// \param count Maximum number of buffers per thread
+///
+/// \see `getMaxBuffers`
+///
+////////////////////////////////////////////////////////////
+SFML_NETWORK_API void setMaxBuffers(std::size_t count);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the maximum number of buffers kept by each thread
+///
+/// \return Maximum number of buffers per thread
+///
+/// \see `setMaxBuffers`
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] SFML_NETWORK_API std::size_t getMaxBuffers();
+
+////////////////////////////////////////////////////////////
+/// \brief Set the capacity above which buffers are not kept
+///
+/// This prevents the occasional huge packet from holding
+/// its memory forever.
+/// The default value is 64 KiB.
+///
+/// \param size Maximum capacity of a pooled buffer, in bytes
+///
+/// \see `getMaxBufferSize`
+///
+////////////////////////////////////////////////////////////
+SFML_NETWORK_API void setMaxBufferSize(std::size_t size);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the capacity above which buffers are not kept
+///
+/// \return Maximum capacity of a pooled buffer, in bytes
+///
+/// \see `setMaxBufferSize`
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] SFML_NETWORK_API std::size_t getMaxBufferSize();
+
+////////////////////////////////////////////////////////////
+/// \brief Get the statistics of the pool
+///
+/// The statistics are accumulated over all threads.
+///
+/// \return Current statistics
+///
+/// \see `resetStatistics`
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] SFML_NETWORK_API Statistics getStatistics();
+
+////////////////////////////////////////////////////////////
+/// \brief Reset the counters of the statistics
+///
+/// The hits, misses and discarded buffers are set to 0,
+/// and the peak memory is set to the current memory.
+///
+/// \see `getStatistics`
+///
+////////////////////////////////////////////////////////////
+SFML_NETWORK_API void resetStatistics();
+
+////////////////////////////////////////////////////////////
+/// \brief Free all the buffers kept by the calling thread
+///
+/// The pool of a thread is automatically freed when the
+/// thread exits.
+///
+////////////////////////////////////////////////////////////
+SFML_NETWORK_API void trim();
+} // namespace sf::PacketPool
+
+
+////////////////////////////////////////////////////////////
+/// \namespace sf::PacketPool
+/// \ingroup network
+///
+/// Every `sf::Packet` stores its data in its own memory.
+/// Without pooling, creating, filling and destroying a packet
+/// for every message means an allocation and a deallocation
+/// for every message.
+///
+/// `sf::PacketPool` avoids that by recycling this memory
+/// automatically: when a packet is destroyed, its memory is
+/// kept by the pool of the current thread, and the next packet
+/// that needs memory in this thread takes it back, in constant
+/// time and without any lock. `sf::TcpSocket` also takes the
+/// memory of the packets that it receives from the pool.
+///
+/// There is nothing to do to benefit from it. The functions
+/// of this namespace only tune the amount of memory kept
+/// by the pool, and report how well it works.
+///
+/// Usage example:
+/// \code
+/// // Keep more buffers, for a server handling many clients per thread
+/// sf::PacketPool::setMaxBuffers(1024);
+///
+/// while (running)
+/// {
+///     sf::Packet packet;
+///     if (socket.receive(packet) == sf::Socket::Status::Done)
+///         handle(packet);
+/// }
+///
+/// const sf::PacketPool::Statistics statistics = sf::PacketPool::getStatistics();
+/// std::cout << "Packets allocated: " << statistics.misses << ", reused: " << statistics.hits << std::endl;
+/// \endcode
+///
+/// \see `sf::Packet`
+///
+////////////////////////////////////////////////////////////
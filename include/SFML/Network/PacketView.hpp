@@ -0,0 +1,378 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Network/Export.hpp>
+
+#include <string>
+#include <string_view>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf
+{
+class Packet;
+class String;
+
+////////////////////////////////////////////////////////////
+/// \brief Read-only view over serialized packet data
+///
+////////////////////////////////////////////////////////////
+class SFML_NETWORK_API PacketView
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Creates an empty view.
+    ///
+    ////////////////////////////////////////////////////////////
+    PacketView() = default;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the view from a range of bytes
+    ///
+    /// The bytes are not copied: they must remain valid and
+    /// unchanged as long as the view is used.
+    ///
+    /// \param data        Pointer to the sequence of bytes to read
+    /// \param sizeInBytes Number of bytes to read
+    ///
+    ////////////////////////////////////////////////////////////
+    PacketView(const void* data, std::size_t sizeInBytes);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the view from the data of a packet
+    ///
+    /// The view reads the packet data from the beginning,
+    /// regardless of the packet's own reading position.
+    /// The packet must not be modified nor destroyed as long
+    /// as the view is used.
+    ///
+    /// \param packet Packet to read
+    ///
+    ////////////////////////////////////////////////////////////
+    PacketView(const Packet& packet);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a pointer to the data viewed
+    ///
+    /// \return Pointer to the data
+    ///
+    /// \see `getDataSize`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const void* getData() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of the data viewed
+    ///
+    /// \return Data size, in bytes
+    ///
+    /// \see `getData`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getDataSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the current reading position in the view
+    ///
+    /// The next `operator>>` call will read data from this position.
+    ///
+    /// \return The byte offset of the current read position
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getReadPosition() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell if the reading position has reached the
+    ///        end of the data
+    ///
+    /// \return `true` if all data was read, `false` otherwise
+    ///
+    /// \see `operator bool`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool endOfPacket() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Test the validity of the view, for reading
+    ///
+    /// This operator behaves exactly like `sf::Packet::operator bool`:
+    /// it becomes `false` as soon as an extraction fails, and
+    /// stays `false` afterwards.
+    ///
+    /// \return `true` if last data extraction from the view was successful
+    ///
+    /// \see `endOfPacket`
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit operator bool() const;
+
+    ////////////////////////////////////////////////////////////
+    /// Overload of `operator>>` to read data from the view
+    ///
+    ////////////////////////////////////////////////////////////
+    PacketView& operator>>(bool& data);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    PacketView& operator>>(std::int8_t& data);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    PacketView& operator>>(std::uint8_t& data);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    PacketView& operator>>(std::int16_t& data);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    PacketView& operator>>(std::uint16_t& data);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    PacketView& operator>>(std::int32_t& data);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    PacketView& operator>>(std::uint32_t& data);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    PacketView& operator>>(std::int64_t& data);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    PacketView& operator>>(std::uint64_t& data);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    PacketView& operator>>(float& data);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    PacketView& operator>>(double& data);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    PacketView& operator>>(char* data);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    PacketView& operator>>(std::string& data);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Extract a string without copying its characters
+    ///
+    /// The resulting string view points directly into the
+    /// viewed data, and is therefore only valid as long as
+    /// this data is.
+    ///
+    /// \param data String view to fill
+    ///
+    /// \return Reference to the view
+    ///
+    ////////////////////////////////////////////////////////////
+    PacketView& operator>>(std::string_view& data);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    PacketView& operator>>(wchar_t* data);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    PacketView& operator>>(std::wstring& data);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    PacketView& operator>>(String& data);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Read an array of values from the view
+    ///
+    /// This gives the same result as extracting the values one
+    /// by one with `operator>>`, but the size is checked once
+    /// and all the values are converted from network byte order
+    /// in a single pass.
+    /// Nothing is read if the view doesn't contain all the values.
+    ///
+    /// \param data  Pointer to the array to fill
+    /// \param count Number of values to read
+    ///
+    /// \return Reference to the view
+    ///
+    ////////////////////////////////////////////////////////////
+    PacketView& read(std::int8_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    PacketView& read(std::uint8_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    PacketView& read(std::int16_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    PacketView& read(std::uint16_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    PacketView& read(std::int32_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    PacketView& read(std::uint32_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    PacketView& read(std::int64_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    PacketView& read(std::uint64_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    PacketView& read(float* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    PacketView& read(double* data, std::size_t count);
+
+private:
+    friend class Packet;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Check if the view can extract a given number of bytes
+    ///
+    /// This function updates accordingly the state of the view.
+    ///
+    /// \param size Size to check
+    ///
+    /// \return `true` if \a size bytes can be read from the view
+    ///
+    ////////////////////////////////////////////////////////////
+    bool checkSize(std::size_t size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Read an array of values from the current reading position
+    ///
+    /// \param data  Pointer to the array to fill
+    /// \param count Number of values to read
+    ///
+    /// \return Reference to the view
+    ///
+    ////////////////////////////////////////////////////////////
+    template <typename T>
+    PacketView& readArray(T* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    const std::byte* m_data{};        //!< Data viewed, not owned
+    std::size_t      m_size{};        //!< Number of bytes viewed
+    std::size_t      m_readPos{};     //!< Current reading position in the data
+    bool             m_isValid{true}; //!< Reading state of the view
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::PacketView
+/// \ingroup network
+///
+/// `sf::PacketView` reads data serialized with `sf::Packet`
+/// directly from memory that it doesn't own, such as a receive
+/// buffer, a memory-mapped file or an existing packet. Nothing
+/// is copied until values are actually extracted, and strings
+/// can even be extracted as `std::string_view` pointing into
+/// the viewed bytes.
+///
+/// The extraction operators, the validity state and the
+/// end-of-data test behave exactly like those of `sf::Packet`,
+/// so the same wire format is read in the same way.
+///
+/// Since the view only stores a pointer to the data, it is
+/// cheap to copy, and the data must outlive it.
+///
+/// Usage example:
+/// \code
+/// std::array<std::byte, 1024> buffer;
+/// std::size_t received = 0;
+/// std::optional<sf::IpAddress> sender;
+/// unsigned short port = 0;
+/// if (socket.receive(buffer.data(), buffer.size(), received, sender, port) == sf::Socket::Status::Done)
+/// {
+///     sf::PacketView view(buffer.data(), received);
+///
+///     std::uint32_t id = 0;
+///     std::string_view name;
+///     if (view >> id >> name)
+///     {
+///         // name points into buffer, no allocation was made
+///     }
+/// }
+/// \endcode
+///
+/// Custom types can be extracted from a view by defining
+/// the corresponding `operator>>` overload, just like with
+/// `sf::Packet`.
+///
+/// \see `sf::Packet`
+///
+////////////////////////////////////////////////////////////
@@ -181,6 +181,8 @@ protected:
     void close();
 
 private:
+    friend class Ftp;
+    friend class NetworkReactor;
     friend class SocketSelector;
 
     ////////////////////////////////////////////////////////////
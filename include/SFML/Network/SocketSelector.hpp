@@ -32,6 +32,7 @@
 #include <SFML/System/Time.hpp>
 
 #include <memory>
+#include <vector>
 
 
 namespace sf
@@ -39,12 +40,23 @@ namespace sf
 class Socket;
 
 ////////////////////////////////////////////////////////////
-/// \brief Multiplexer that allows to read from multiple sockets
+/// \brief Multiplexer that allows to read from and write to multiple sockets
 ///
 ////////////////////////////////////////////////////////////
 class SFML_NETWORK_API SocketSelector
 {
 public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Kinds of readiness a socket can be watched for
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class Readiness
+    {
+        Read      = 1 << 0,       //!< The socket is ready to receive data (or to accept a connection)
+        Write     = 1 << 1,       //!< The socket is ready to send data
+        ReadWrite = Read | Write, //!< Both of the above
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief Default constructor
     ///
@@ -95,6 +107,10 @@ public:
     /// while it is stored in the selector.
     /// This function does nothing if the socket is not valid.
     ///
+    /// The socket is only watched for read readiness, use the
+    /// overload taking a `Readiness` to also watch it for write
+    /// readiness.
+    ///
     /// \param socket Reference to the socket to add
     ///
     /// \see `remove`, `clear`
@@ -102,6 +118,24 @@ public:
     ////////////////////////////////////////////////////////////
     void add(Socket& socket);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Add a new socket to the selector, watching the given readiness
+    ///
+    /// This function keeps a weak reference to the socket,
+    /// so you have to make sure that the socket is not destroyed
+    /// nor moved while it is stored in the selector.
+    /// If the socket is already in the selector, the kinds of
+    /// readiness it is watched for are replaced by \a readiness.
+    /// This function does nothing if the socket is not valid.
+    ///
+    /// \param socket    Reference to the socket to add
+    /// \param readiness Kinds of readiness to watch the socket for
+    ///
+    /// \see `remove`, `clear`
+    ///
+    ////////////////////////////////////////////////////////////
+    void add(Socket& socket, Readiness readiness);
+
     ////////////////////////////////////////////////////////////
     /// \brief Remove a socket from the selector
     ///
@@ -128,19 +162,25 @@ public:
     void clear();
 
     ////////////////////////////////////////////////////////////
-    /// \brief Wait until one or more sockets are ready to receive
+    /// \brief Wait until one or more sockets are ready
     ///
     /// This function returns as soon as at least one socket has
-    /// some data available to be received. To know which sockets are
-    /// ready, use the `isReady` function.
+    /// some data available to be received, or as soon as one
+    /// of the sockets watched for write readiness can send data.
+    /// To know which sockets are ready, use `getReadySockets` or
+    /// the `isReady` and `isReadyToWrite` functions.
     /// If you use a timeout and no socket is ready before the timeout
     /// is over, the function returns `false`.
     ///
+    /// On Linux the selector is backed by epoll and has no limit
+    /// on the number or value of the socket handles it watches.
+    /// Other systems use `select`, which is bounded by FD_SETSIZE.
+    ///
     /// \param timeout Maximum time to wait, (use Time::Zero for infinity)
     ///
     /// \return `true` if there are sockets ready, `false` otherwise
     ///
-    /// \see `isReady`
+    /// \see `getReadySockets`, `isReady`, `isReadyToWrite`
     ///
     ////////////////////////////////////////////////////////////
     [[nodiscard]] bool wait(Time timeout = Time::Zero);
@@ -164,6 +204,38 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] bool isReady(Socket& socket) const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Test a socket to know if it is ready to send data
+    ///
+    /// This function must be used after a call to `wait`, to know
+    /// which sockets are ready to send data. It can only return
+    /// `true` for sockets that were added with `Readiness::Write`.
+    ///
+    /// \param socket Socket to test
+    ///
+    /// \return `true` if the socket is ready to write, `false` otherwise
+    ///
+    /// \see `isReady`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isReadyToWrite(Socket& socket) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the sockets that were found ready by the last call to `wait`
+    ///
+    /// Each socket appears once, whether it is ready to read,
+    /// to write or both; use `isReady` and `isReadyToWrite` to
+    /// tell them apart. The pointers are the addresses that were
+    /// given to `add`. This avoids testing every socket of the
+    /// selector after each `wait`.
+    ///
+    /// \return Sockets that are ready
+    ///
+    /// \see `wait`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const std::vector<Socket*>& getReadySockets() const;
+
 private:
     struct SocketSelectorImpl;
 
@@ -203,7 +275,11 @@ private:
 /// Using a selector is simple:
 /// \li populate the selector with all the sockets that you want to observe
 /// \li make it wait until there is data available on any of the sockets
-/// \li test each socket to find out which ones are ready
+/// \li iterate over the ready sockets (or test each socket to find out which ones are ready)
+///
+/// Sockets can also be watched for write readiness, which is
+/// useful to know when a non-blocking socket that returned
+/// `sf::Socket::Status::Partial` can send the rest of its data.
 ///
 /// Usage example:
 /// \code
@@ -215,7 +291,8 @@ private:
 /// }
 ///
 /// // Create a list to store the future clients
-/// std::vector<sf::TcpSocket> clients;
+/// // (the selector references the sockets, so their address must not change)
+/// std::list<sf::TcpSocket> clients;
 ///
 /// // Create a selector
 /// sf::SocketSelector selector;
@@ -229,38 +306,33 @@ private:
 ///     // Make the selector wait for data on any socket
 ///     if (selector.wait())
 ///     {
-///         // Test the listener
-///         if (selector.isReady(listener))
+///         // Only visit the sockets that are ready
+///         for (sf::Socket* socket : selector.getReadySockets())
 ///         {
-///             // The listener is ready: there is a pending connection
-///             sf::TcpSocket client;
-///             if (listener.accept(client) == sf::Socket::Status::Done)
+///             if (socket == &listener)
 ///             {
-///                 // Add the new client to the selector so that we will
-///                 // be notified when they send something
-///                 selector.add(client);
-///
-///                 // Add the new client to the clients list
-///                 clients.push_back(std::move(client));
+///                 // The listener is ready: there is a pending connection
+///                 sf::TcpSocket& client = clients.emplace_back();
+///                 if (listener.accept(client) == sf::Socket::Status::Done)
+///                 {
+///                     // Add the new client to the selector so that we will
+///                     // be notified when they send something
+///                     selector.add(client);
+///                 }
+///                 else
+///                 {
+///                     // Handle error...
+///                     clients.pop_back();
+///                 }
 ///             }
 ///             else
 ///             {
-///                 // Handle error...
-///             }
-///         }
-///         else
-///         {
-///             // The listener socket is not ready, test all other sockets (the clients)
-///             for (sf::TcpSocket& client : clients)
-///             {
-///                 if (selector.isReady(client))
+///                 // A client has sent some data, we can receive it
+///                 auto& client = static_cast<sf::TcpSocket&>(*socket);
+///                 sf::Packet packet;
+///                 if (client.receive(packet) == sf::Socket::Status::Done)
 ///                 {
-///                     // The client has sent some data, we can receive it
-///                     sf::Packet packet;
-///                     if (client.receive(packet) == sf::Socket::Status::Done)
-///                     {
-///                         ...
-///                     }
+///                     ...
 ///                 }
 ///             }
 ///         }
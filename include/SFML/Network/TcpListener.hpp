@@ -32,6 +32,13 @@
 #include <SFML/Network/IpAddress.hpp>
 #include <SFML/Network/Socket.hpp>
 
+#include <SFML/System/Time.hpp>
+
+#include <limits>
+#include <vector>
+
+#include <cstddef>
+
 
 namespace sf
 {
@@ -63,6 +70,124 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] unsigned short getLocalPort() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Allow several listeners to listen on the same port
+    ///
+    /// When enabled, several listeners (usually one per thread
+    /// or process) can listen on the same port and address, as
+    /// long as all of them enable this option (SO_REUSEPORT).
+    /// The system then distributes the incoming connections among
+    /// them, which scales better than having several threads
+    /// accept connections from a single listener.
+    ///
+    /// The option is applied by the next call to `listen`. It is
+    /// not available on all systems (Windows notably lacks it),
+    /// in which case `listen` fails when it is enabled.
+    /// This option is disabled by default.
+    ///
+    /// \param reusePort `true` to share the port with other listeners, `false` otherwise
+    ///
+    /// \see `getReusePort`, `listen`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setReusePort(bool reusePort);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the listener shares its port with other listeners
+    ///
+    /// \return `true` if the port is shared, `false` otherwise
+    ///
+    /// \see `setReusePort`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool getReusePort() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Delay accepting connections until they have sent data
+    ///
+    /// When enabled, the system only reports a new connection
+    /// once the client has sent its first data, or when the delay
+    /// expires (TCP_DEFER_ACCEPT). Servers whose clients always
+    /// speak first (HTTP for instance) are then not woken up for
+    /// idle connections. The delay is rounded to whole seconds.
+    ///
+    /// The option is applied by the next call to `listen`. It is
+    /// only available on Linux; on other systems it is ignored.
+    /// Pass `sf::Time::Zero` to disable it, which is the default.
+    ///
+    /// \param delay Maximum time to wait for the first data of a connection
+    ///
+    /// \see `getDeferAccept`, `listen`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setDeferAccept(Time delay);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the delay to wait for the first data of a connection
+    ///
+    /// \return Maximum time to wait for the first data of a connection
+    ///
+    /// \see `setDeferAccept`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Time getDeferAccept() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the size of the system buffer holding outgoing data of accepted connections
+    ///
+    /// The sockets accepted by the listener inherit the buffer
+    /// sizes of the listening socket, see `TcpSocket::setSendBufferSize`.
+    ///
+    /// The option is applied by the next call to `listen`.
+    /// Pass 0 to keep the system default, which is the default.
+    ///
+    /// \param size Size of the buffer, in bytes
+    ///
+    /// \see `getSendBufferSize`, `setReceiveBufferSize`, `listen`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setSendBufferSize(std::size_t size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of the send buffer requested for accepted connections
+    ///
+    /// \return Requested size of the buffer in bytes, or 0 for the system default
+    ///
+    /// \see `setSendBufferSize`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getSendBufferSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the size of the system buffer holding incoming data of accepted connections
+    ///
+    /// The sockets accepted by the listener inherit the buffer
+    /// sizes of the listening socket. Unlike a size set on an
+    /// accepted socket, the receive buffer size of the listener
+    /// is in place during the handshake, which negotiates the
+    /// window scaling of the connection: on some systems (Linux),
+    /// this is needed to make use of a buffer larger than 64 KiB.
+    ///
+    /// The option is applied by the next call to `listen`.
+    /// Pass 0 to keep the system default, which is the default.
+    ///
+    /// \param size Size of the buffer, in bytes
+    ///
+    /// \see `getReceiveBufferSize`, `setSendBufferSize`, `listen`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setReceiveBufferSize(std::size_t size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of the receive buffer requested for accepted connections
+    ///
+    /// \return Requested size of the buffer in bytes, or 0 for the system default
+    ///
+    /// \see `setReceiveBufferSize`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getReceiveBufferSize() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Start listening for incoming connection attempts
     ///
@@ -112,6 +237,39 @@ public:
     ///
     ////////////////////////////////////////////////////////////
     [[nodiscard]] Status accept(TcpSocket& socket);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Accept all the pending connections at once
+    ///
+    /// The first connection is accepted according to the blocking
+    /// mode of the listener: in blocking mode, this function waits
+    /// until a connection is received. Then all the connections
+    /// that are already pending are accepted as well, without
+    /// waiting, up to \a maxCount connections in total. This saves
+    /// a trip through the selector for each connection when many
+    /// clients connect at the same time.
+    ///
+    /// The new connections are appended to \a sockets.
+    ///
+    /// \param sockets  Sockets that will hold the new connections
+    /// \param maxCount Maximum number of connections to accept
+    ///
+    /// \return `sf::Socket::Status::Done` if at least one connection was accepted, another status code otherwise
+    ///
+    /// \see `listen`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Status accept(std::vector<TcpSocket>& sockets,
+                                std::size_t             maxCount = std::numeric_limits<std::size_t>::max());
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    bool        m_reusePort{};         //!< Share the port with other listeners?
+    Time        m_deferAccept{};       //!< Maximum time to wait for the first data of a connection
+    std::size_t m_sendBufferSize{};    //!< Size of the send buffer of accepted connections, 0 for the default
+    std::size_t m_receiveBufferSize{}; //!< Size of the receive buffer of accepted connections, 0 for the default
 };
 
 
@@ -161,6 +319,31 @@ public:
 /// }
 /// \endcode
 ///
+/// To accept connections from several threads, each thread can
+/// own a listener sharing the same port with `setReusePort`;
+/// the system then balances the new connections among them:
+/// \code
+/// void serve()
+/// {
+///     sf::TcpListener listener;
+///     listener.setReusePort(true);
+///     if (listener.listen(55001) != sf::Socket::Status::Done)
+///         return;
+///
+///     std::vector<sf::TcpSocket> clients;
+///     while (running)
+///     {
+///         // Accept all the clients that are waiting at once
+///         if (listener.accept(clients) == sf::Socket::Status::Done)
+///             doSomethingWith(clients);
+///     }
+/// }
+///
+/// std::vector<std::thread> threads;
+/// for (unsigned int i = 0; i < std::thread::hardware_concurrency(); ++i)
+///     threads.emplace_back(serve);
+/// \endcode
+///
 /// \see `sf::TcpSocket`, `sf::Socket`
 ///
 ////////////////////////////////////////////////////////////
@@ -29,11 +29,14 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Network/Export.hpp>
 
+#include <SFML/Network/Packet.hpp>
 #include <SFML/Network/Socket.hpp>
 
 #include <SFML/System/Time.hpp>
 
+#include <memory>
 #include <optional>
+#include <utility>
 #include <vector>
 
 #include <cstddef>
@@ -44,7 +47,6 @@ namespace sf
 {
 class TcpListener;
 class IpAddress;
-class Packet;
 
 ////////////////////////////////////////////////////////////
 /// \brief Specialized socket using the TCP protocol
@@ -128,6 +130,110 @@ public:
     ////////////////////////////////////////////////////////////
     void disconnect();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable sending small pieces of data immediately
+    ///
+    /// By default, TCP sockets send data as soon as possible
+    /// (the Nagle algorithm is disabled with TCP_NODELAY), which
+    /// is best for latency. Disabling this option lets the system
+    /// coalesce small sends into fewer segments, which saves
+    /// bandwidth when a lot of tiny messages are sent.
+    ///
+    /// The socket must be connected.
+    ///
+    /// \param noDelay `true` to send data immediately, `false` to let the system coalesce it
+    ///
+    /// \return `true` if the option was applied
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool setNoDelay(bool noDelay);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the size of the system buffer holding outgoing data
+    ///
+    /// A larger buffer keeps fast connections with a long round
+    /// trip busy. The system may adjust the requested size (Linux
+    /// doubles it for its own bookkeeping); use `getSendBufferSize`
+    /// to get the actual value.
+    ///
+    /// The size can be set before `connect`, and is applied again
+    /// to each new connection of the socket. To configure the
+    /// sockets accepted by a listener, see `TcpListener::setSendBufferSize`.
+    ///
+    /// \param size Size of the buffer, in bytes
+    ///
+    /// \return `true` if the option was applied
+    ///
+    /// \see `getSendBufferSize`, `setReceiveBufferSize`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool setSendBufferSize(std::size_t size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of the system buffer holding outgoing data
+    ///
+    /// \return Size of the buffer in bytes, or 0 if the socket is neither connected nor configured
+    ///
+    /// \see `setSendBufferSize`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getSendBufferSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the size of the system buffer holding incoming data
+    ///
+    /// The system may adjust the requested size; use
+    /// `getReceiveBufferSize` to get the actual value.
+    ///
+    /// The size should be set before `connect`: it also determines
+    /// the window scaling negotiated when connecting, which some
+    /// systems (Linux) don't change afterwards, so a larger buffer
+    /// set on a connected socket may not be used entirely. The
+    /// size is applied again to each new connection of the socket.
+    /// To configure the sockets accepted by a listener, see
+    /// `TcpListener::setReceiveBufferSize`.
+    ///
+    /// \param size Size of the buffer, in bytes
+    ///
+    /// \return `true` if the option was applied
+    ///
+    /// \see `getReceiveBufferSize`, `setSendBufferSize`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool setReceiveBufferSize(std::size_t size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of the system buffer holding incoming data
+    ///
+    /// \return Size of the buffer in bytes, or 0 if the socket is neither connected nor configured
+    ///
+    /// \see `setReceiveBufferSize`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getReceiveBufferSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable acknowledging received data immediately
+    ///
+    /// When enabled, the system acknowledges received data right
+    /// away instead of delaying the acknowledgment in the hope of
+    /// piggybacking it on a response (TCP_QUICKACK). This lowers
+    /// the latency of request/response protocols where the peer
+    /// waits for the acknowledgment. The system may leave this
+    /// mode by itself later, so it is usually set again after
+    /// receiving data.
+    ///
+    /// This option is only available on Linux; on other systems
+    /// this function has no effect and returns `false`. The
+    /// socket must be connected.
+    ///
+    /// \param quickAck `true` to acknowledge immediately, `false` to let the system delay it
+    ///
+    /// \return `true` if the option was applied
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool setQuickAck(bool quickAck);
+
     ////////////////////////////////////////////////////////////
     /// \brief Send raw data to the remote peer
     ///
@@ -198,6 +304,30 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] Status send(Packet& packet);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Send several formatted packets of data to the remote peer
+    ///
+    /// The packets are sent in order, and gathered into as few
+    /// system calls as possible, which greatly reduces the
+    /// overhead of sending many small packets. They are received
+    /// exactly as if they had been sent one by one.
+    ///
+    /// In non-blocking mode, if this function returns `sf::Socket::Status::Partial`,
+    /// you \em must retry sending the same unmodified packets before sending
+    /// anything else in order to guarantee the packets arrive at the remote
+    /// peer uncorrupted.
+    /// This function will fail if the socket is not connected.
+    ///
+    /// \param packets Pointer to the array of packets to send
+    /// \param count   Number of packets in the array
+    ///
+    /// \return Status code
+    ///
+    /// \see `receive`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Status send(Packet* packets, std::size_t count);
+
     ////////////////////////////////////////////////////////////
     /// \brief Receive a formatted packet of data from the remote peer
     ///
@@ -214,6 +344,37 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] Status receive(Packet& packet);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Receive all the formatted packets that are available from the remote peer
+    ///
+    /// This function reads as much data as is available with a
+    /// single system call and extracts every complete packet it
+    /// holds, which is much cheaper than receiving the packets
+    /// one by one when many small packets arrive at once. The
+    /// bytes of an incomplete packet are kept until the rest of
+    /// the packet is received by a following call.
+    ///
+    /// \a packets is cleared first. In blocking mode, this function
+    /// will wait until at least one packet has been received.
+    /// This function will fail if the socket is not connected.
+    ///
+    /// The received packets are decompressed with \a compression
+    /// and \a dictionary, which must match the ones used by the
+    /// sender, see `sf::Packet::setCompression`.
+    ///
+    /// \param packets     Vector to fill with the received packets
+    /// \param compression Compression used by the remote peer
+    /// \param dictionary  Dictionary shared with the remote peer, if any
+    ///
+    /// \return Status code, `sf::Socket::Status::Done` if at least one packet was received
+    ///
+    /// \see `send`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Status receive(std::vector<Packet>&                         packets,
+                                 Packet::Compression                          compression = Packet::Compression::None,
+                                 std::shared_ptr<const CompressionDictionary> dictionary  = nullptr);
+
 private:
     friend class TcpListener;
 
@@ -226,13 +387,60 @@ private:
         std::uint32_t          size{};         //!< Data of packet size
         std::size_t            sizeReceived{}; //!< Number of size bytes received so far
         std::vector<std::byte> data;           //!< Data of the packet
+        std::size_t            dataReceived{}; //!< Number of data bytes received so far
     };
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get where the next received bytes of the pending packet go
+    ///
+    /// This is the rest of the packet size until it is complete,
+    /// then the rest of the packet data. The data is allocated
+    /// as it arrives, up to the announced size of the packet.
+    ///
+    /// \return Pointer to the destination and number of bytes still expected there
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::pair<std::byte*, std::size_t> getPendingSpace();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Apply the requested buffer sizes to a new connection
+    ///
+    /// \see `setSendBufferSize`, `setReceiveBufferSize`
+    ///
+    ////////////////////////////////////////////////////////////
+    void applyBufferSizes();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Account for bytes written to the space returned by `getPendingSpace`
+    ///
+    /// \param size Number of bytes received
+    ///
+    ////////////////////////////////////////////////////////////
+    void commitPendingData(std::size_t size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the pending packet has been completely received
+    ///
+    /// \return `true` if the whole packet has been received
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isPendingPacketComplete() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Hand the complete pending packet to a user packet
+    ///
+    /// \param packet Packet to fill with the received data
+    ///
+    ////////////////////////////////////////////////////////////
+    void takePendingPacket(Packet& packet);
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    PendingPacket          m_pendingPacket;     //!< Temporary data of the packet currently being received
-    std::vector<std::byte> m_blockToSendBuffer; //!< Buffer used to prepare data being sent from the socket
+    PendingPacket              m_pendingPacket;     //!< Temporary data of the packet currently being received
+    std::vector<std::byte>     m_receiveBuffer;     //!< Buffer receiving many packets at once, allocated on first use
+    std::optional<std::size_t> m_sendBufferSize;    //!< Size requested for the send buffer of each connection
+    std::optional<std::size_t> m_receiveBufferSize; //!< Size requested for the receive buffer of each connection
 };
 
 } // namespace sf
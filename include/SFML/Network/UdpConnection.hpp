@@ -0,0 +1,447 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Network/Export.hpp>
+
+#include <SFML/Network/IpAddress.hpp>
+#include <SFML/Network/Socket.hpp>
+
+#include <SFML/System/Time.hpp>
+
+#include <memory>
+#include <optional>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf
+{
+class Packet;
+
+////////////////////////////////////////////////////////////
+/// \brief Connection with a single peer over UDP, with
+///        optional reliability and ordering per channel
+///
+////////////////////////////////////////////////////////////
+class SFML_NETWORK_API UdpConnection
+{
+public:
+    ////////////////////////////////////////////////////////////
+    // Constants
+    ////////////////////////////////////////////////////////////
+    // NOLINTBEGIN(readability-identifier-naming)
+    static constexpr std::size_t ChannelCount{8};             //!< Number of channels of a connection
+    static constexpr std::size_t MaxMessageSize{1024 * 1024}; //!< Maximum number of bytes of a single message
+    // NOLINTEND(readability-identifier-naming)
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Delivery guarantees of a channel
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class Delivery
+    {
+        Unreliable,          //!< Messages may be lost, duplicated or reordered
+        UnreliableSequenced, //!< Messages may be lost, and older messages are dropped if a newer one arrived first
+        ReliableOrdered      //!< Messages are all received, in the order they were sent
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief State of the connection
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class State
+    {
+        Disconnected, //!< No peer, or the connection was lost
+        Listening,    //!< Waiting for a peer to connect
+        Connecting,   //!< Waiting for the peer to accept the connection
+        Connected     //!< Messages can be exchanged with the peer
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Degradation applied to outgoing datagrams, to
+    ///        test how an application copes with bad networks
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Simulator
+    {
+        float         packetLoss{};  //!< Probability for a datagram to be dropped, in [0, 1]
+        float         duplication{}; //!< Probability for a datagram to be sent twice, in [0, 1]
+        Time          latency;       //!< Delay added to every datagram
+        Time          jitter;        //!< Maximum random variation of the delay (which may reorder datagrams)
+        std::uint32_t seed{};        //!< Seed of the random generator, for reproducible runs
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Measurements of the connection
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Statistics
+    {
+        Time          roundTripTime;         //!< Smoothed round-trip time
+        Time          roundTripTimeVariance; //!< Mean deviation of the round-trip time
+        std::size_t   congestionWindow{};    //!< Number of bytes that may be sent without being acknowledged
+        std::size_t   bytesInFlight{};       //!< Number of bytes sent and not acknowledged yet
+        std::uint64_t datagramsSent{};       //!< Number of datagrams sent (including the ones dropped by the simulator)
+        std::uint64_t datagramsReceived{};   //!< Number of datagrams received from the peer
+        std::uint64_t datagramsLost{};       //!< Number of datagrams that were not acknowledged in time
+        std::uint64_t messagesResent{};      //!< Number of reliable messages (or fragments) that were sent again
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// All the channels use `Delivery::ReliableOrdered`.
+    ///
+    ////////////////////////////////////////////////////////////
+    UdpConnection();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// The connection is closed without notifying the peer,
+    /// call `disconnect` first to do so.
+    ///
+    ////////////////////////////////////////////////////////////
+    ~UdpConnection();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    UdpConnection(const UdpConnection&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    UdpConnection& operator=(const UdpConnection&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    UdpConnection(UdpConnection&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    UdpConnection& operator=(UdpConnection&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Bind the underlying socket to a specific port
+    ///
+    /// This is required before calling `listen`. `connect`
+    /// binds the socket to any available port if it isn't
+    /// bound yet.
+    ///
+    /// \param port    Port to bind the socket to, or `sf::Socket::AnyPort`
+    /// \param address Address of the interface to bind to
+    ///
+    /// \return Status code
+    ///
+    /// \see `getLocalPort`, `sf::UdpSocket::bind`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Socket::Status bind(unsigned short port, IpAddress address = IpAddress::Any);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the port to which the underlying socket is bound locally
+    ///
+    /// \return Port to which the socket is bound, or 0 if it isn't bound
+    ///
+    /// \see `bind`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned short getLocalPort() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Wait for a peer to connect
+    ///
+    /// The first peer that connects to the bound port becomes
+    /// the peer of this connection; the state switches to
+    /// `State::Connected` during the `update` that handles
+    /// its request.
+    ///
+    /// \see `connect`, `getState`
+    ///
+    ////////////////////////////////////////////////////////////
+    void listen();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Start connecting to a listening peer
+    ///
+    /// The handshake runs in `update`; the state switches to
+    /// `State::Connected` once the peer has accepted, or to
+    /// `State::Disconnected` if it didn't answer before the
+    /// timeout.
+    ///
+    /// \param remoteAddress Address of the peer
+    /// \param remotePort    Port of the peer
+    ///
+    /// \see `listen`, `disconnect`, `setTimeout`
+    ///
+    ////////////////////////////////////////////////////////////
+    void connect(IpAddress remoteAddress, unsigned short remotePort);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Close the connection
+    ///
+    /// The peer is notified, and all the messages that were not
+    /// sent or received yet are discarded. The socket stays
+    /// bound, so that the connection can be reused.
+    ///
+    /// \see `connect`
+    ///
+    ////////////////////////////////////////////////////////////
+    void disconnect();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the state of the connection
+    ///
+    /// \return Current state
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] State getState() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the address of the peer
+    ///
+    /// \return Address of the peer, or `std::nullopt` if there is none
+    ///
+    /// \see `getRemotePort`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<IpAddress> getRemoteAddress() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the port of the peer
+    ///
+    /// \return Port of the peer, or 0 if there is none
+    ///
+    /// \see `getRemoteAddress`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned short getRemotePort() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the delivery guarantees of a channel
+    ///
+    /// Both peers must use the same settings, and they must be
+    /// chosen before connecting.
+    ///
+    /// \param channel  Index of the channel, lower than `ChannelCount`
+    /// \param delivery Delivery guarantees of the channel
+    ///
+    /// \see `getDelivery`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setDelivery(std::uint8_t channel, Delivery delivery);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the delivery guarantees of a channel
+    ///
+    /// \param channel Index of the channel, lower than `ChannelCount`
+    ///
+    /// \return Delivery guarantees of the channel
+    ///
+    /// \see `setDelivery`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Delivery getDelivery(std::uint8_t channel) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the time after which a silent peer is considered gone
+    ///
+    /// The default timeout is 10 seconds.
+    ///
+    /// \param timeout Maximum time without receiving anything from the peer
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTimeout(Time timeout);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Degrade the outgoing datagrams of this connection
+    ///
+    /// This is meant for testing only; a default-constructed
+    /// `Simulator` disables it.
+    ///
+    /// \param simulator Loss, duplication and latency to apply to outgoing datagrams
+    ///
+    ////////////////////////////////////////////////////////////
+    void setSimulator(const Simulator& simulator);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Queue a message for the peer
+    ///
+    /// The message is sent by the next calls to `update`, as
+    /// soon as congestion control allows it. Messages bigger
+    /// than a datagram are split into fragments, and reassembled
+    /// by the peer.
+    ///
+    /// \param channel Index of the channel to send the message on
+    /// \param data    Pointer to the bytes of the message
+    /// \param size    Number of bytes of the message, at most `MaxMessageSize`
+    ///
+    /// \return True if the message was queued, false if the connection is not
+    ///         established, the arguments are invalid or too many reliable
+    ///         messages are waiting for an acknowledgement on the channel
+    ///
+    /// \see `receive`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool send(std::uint8_t channel, const void* data, std::size_t size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Queue a packet for the peer
+    ///
+    /// \param channel Index of the channel to send the packet on
+    /// \param packet  Packet to send
+    ///
+    /// \return True if the packet was queued
+    ///
+    /// \see `receive`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool send(std::uint8_t channel, Packet& packet);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Take the next message received from the peer
+    ///
+    /// Messages are received by `update`. This function doesn't
+    /// wait: it returns false if no message is available.
+    ///
+    /// \param packet  Packet to fill with the message
+    /// \param channel Index of the channel the message was sent on
+    ///
+    /// \return True if a message was taken
+    ///
+    /// \see `send`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool receive(Packet& packet, std::uint8_t& channel);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Exchange datagrams with the peer
+    ///
+    /// This function receives the pending datagrams, then sends
+    /// queued messages, acknowledgements and retransmissions.
+    /// It never blocks, and it must be called regularly (every
+    /// frame, for example) for the connection to make progress.
+    ///
+    ////////////////////////////////////////////////////////////
+    void update();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get measurements of the connection
+    ///
+    /// \return Current statistics
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Statistics getStatistics() const;
+
+private:
+    struct Impl;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::unique_ptr<Impl> m_impl; //!< Implementation details
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::UdpConnection
+/// \ingroup network
+///
+/// `sf::UdpConnection` adds the parts of TCP that real-time
+/// applications need on top of `sf::UdpSocket`, without its
+/// head-of-line blocking: messages are sent on one of
+/// `ChannelCount` channels, and each channel has its own
+/// delivery guarantees. A lost reliable message delays the
+/// next messages of its channel only, so that time-critical
+/// data can flow on an unreliable channel meanwhile.
+///
+/// Every datagram acknowledges the last 33 datagrams received
+/// from the peer, which gives round-trip time estimates and
+/// lets lost reliable messages be sent again. The amount of
+/// unacknowledged data is bounded by a congestion window that
+/// shrinks when datagrams are lost, and sends are paced over
+/// the round-trip time. Messages are split into fragments
+/// that fit in a typical MTU and reassembled by the peer.
+///
+/// A connection has a single peer, and a socket of its own.
+/// Everything happens in `update`, which never blocks: call it
+/// regularly, then take the messages with `receive`.
+///
+/// `setSimulator` drops, duplicates and delays outgoing
+/// datagrams, to test an application in bad network conditions
+/// on a local machine.
+///
+/// Usage example:
+/// \code
+/// // ----- The server -----
+/// sf::UdpConnection server;
+/// server.setDelivery(1, sf::UdpConnection::Delivery::UnreliableSequenced);
+/// if (server.bind(55001) != sf::Socket::Status::Done)
+/// {
+///     // Handle error...
+/// }
+/// server.listen();
+///
+/// // ----- The client -----
+/// sf::UdpConnection client;
+/// client.setDelivery(1, sf::UdpConnection::Delivery::UnreliableSequenced);
+/// client.connect(serverAddress, 55001);
+///
+/// // ----- Both, every frame -----
+/// connection.update();
+///
+/// sf::Packet   packet;
+/// std::uint8_t channel = 0;
+/// while (connection.receive(packet, channel))
+/// {
+///     // Handle the message...
+/// }
+///
+/// // Chat messages on the reliable channel 0, positions on the sequenced channel 1
+/// sf::Packet position;
+/// position << x << y;
+/// if (!connection.send(1, position))
+/// {
+///     // Not connected yet...
+/// }
+/// \endcode
+///
+/// \see `sf::UdpSocket`, `sf::Packet`
+///
+////////////////////////////////////////////////////////////
@@ -55,6 +55,34 @@ public:
     // NOLINTNEXTLINE(readability-identifier-naming)
     static constexpr std::size_t MaxDatagramSize{65507}; //!< The maximum number of bytes that can be sent in a single UDP datagram
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Datagram to send with `sendBatch`
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Datagram
+    {
+        const void*    data{};                        //!< Pointer to the sequence of bytes to send
+        std::size_t    size{};                        //!< Number of bytes to send
+        IpAddress      remoteAddress{IpAddress::Any}; //!< Address of the receiver
+        unsigned short remotePort{};                  //!< Port of the receiver to send the data to
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destination of a datagram received with `receiveBatch`
+    ///
+    /// `data` and `size` describe the buffer provided by the
+    /// caller, the other members are filled by `receiveBatch`.
+    ///
+    ////////////////////////////////////////////////////////////
+    struct DatagramBuffer
+    {
+        void*                    data{};        //!< Pointer to the array to fill with the received bytes
+        std::size_t              size{};        //!< Maximum number of bytes that can be received
+        std::size_t              received{};    //!< Actual number of bytes received
+        std::optional<IpAddress> remoteAddress; //!< Address of the peer that sent the data
+        unsigned short           remotePort{};  //!< Port of the peer that sent the data
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief Default constructor
     ///
@@ -194,11 +222,93 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] Status receive(Packet& packet, std::optional<IpAddress>& remoteAddress, unsigned short& remotePort);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Send several datagrams, possibly to different peers
+    ///
+    /// The datagrams are sent in order. On Linux, they are
+    /// handed to the system in batches with a single system call
+    /// per batch (`sendmmsg`), which is much cheaper than calling
+    /// `send` for each of them.
+    ///
+    /// If any datagram is bigger than `UdpSocket::MaxDatagramSize`,
+    /// this function fails and nothing is sent. If an error occurs
+    /// after some of the datagrams were sent, `Status::Partial` is
+    /// returned and `sent` tells how many went through; the
+    /// remaining ones can be sent with another call.
+    ///
+    /// \param datagrams Pointer to the array of datagrams to send
+    /// \param count     Number of datagrams in the array
+    /// \param sent      This variable is filled with the number of datagrams sent
+    ///
+    /// \return Status code
+    ///
+    /// \see `receiveBatch`, `sendSegmented`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Status sendBatch(const Datagram* datagrams, std::size_t count, std::size_t& sent);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Receive several datagrams at once
+    ///
+    /// In blocking mode, this function waits until at least one
+    /// datagram is available, then fills as many buffers as
+    /// there are datagrams already queued, without waiting for
+    /// more. On Linux, this is done with a single system call
+    /// per batch (`recvmmsg`). On Windows, a single datagram is
+    /// received per call.
+    ///
+    /// Each buffer is filled like with `receive`; a datagram
+    /// bigger than its buffer is truncated.
+    ///
+    /// \param buffers  Pointer to the array of buffers to fill
+    /// \param count    Number of buffers in the array
+    /// \param received This variable is filled with the number of buffers filled
+    ///
+    /// \return Status code
+    ///
+    /// \see `sendBatch`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Status receiveBatch(DatagramBuffer* buffers, std::size_t count, std::size_t& received);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Send a large buffer to a single peer as a sequence of datagrams
+    ///
+    /// `data` is split into datagrams of `segmentSize` bytes
+    /// (the last one may be shorter), which are received by the
+    /// peer as independent datagrams. On Linux, when the system
+    /// supports UDP segmentation offload (GSO), the whole buffer
+    /// is handed to the system at once and split as late as
+    /// possible, often by the network card itself; otherwise the
+    /// datagrams are sent with `sendBatch`.
+    ///
+    /// Make sure that `segmentSize` is not greater than
+    /// `UdpSocket::MaxDatagramSize`, otherwise this function will
+    /// fail and no data will be sent.
+    ///
+    /// \param data          Pointer to the sequence of bytes to send
+    /// \param size          Number of bytes to send
+    /// \param segmentSize   Size of each datagram
+    /// \param remoteAddress Address of the receiver
+    /// \param remotePort    Port of the receiver to send the data to
+    ///
+    /// \return Status code
+    ///
+    /// \see `sendBatch`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Status sendSegmented(const void*    data,
+                                       std::size_t    size,
+                                       std::size_t    segmentSize,
+                                       IpAddress      remoteAddress,
+                                       unsigned short remotePort);
+
 private:
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    std::vector<std::byte> m_buffer{MaxDatagramSize}; //!< Temporary buffer holding the received data in Receive(Packet)
+    std::vector<std::byte> m_buffer{MaxDatagramSize};   //!< Temporary buffer holding the received data in Receive(Packet)
+    bool                   m_segmentationOffload{true}; //!< Whether the system may support UDP segmentation offload for this socket
 };
 
 } // namespace sf
@@ -288,6 +398,23 @@ private:
 /// socket.send(message.c_str(), message.size() + 1, sender, port);
 /// \endcode
 ///
+/// Servers exchanging many small datagrams can reduce the
+/// number of system calls with `sendBatch` and `receiveBatch`:
+/// \code
+/// std::array<std::array<char, 1500>, 32>        storage;
+/// std::array<sf::UdpSocket::DatagramBuffer, 32> buffers;
+/// for (std::size_t i = 0; i < buffers.size(); ++i)
+/// {
+///     buffers[i].data = storage[i].data();
+///     buffers[i].size = storage[i].size();
+/// }
+///
+/// std::size_t count = 0;
+/// if (socket.receiveBatch(buffers.data(), buffers.size(), count) == sf::Socket::Status::Done)
+///     for (std::size_t i = 0; i < count; ++i)
+///         handleMessage(buffers[i].data, buffers[i].received, *buffers[i].remoteAddress, buffers[i].remotePort);
+/// \endcode
+///
 /// \see `sf::Socket`, `sf::TcpSocket`, `sf::Packet`
 ///
 ////////////////////////////////////////////////////////////
@@ -0,0 +1,557 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/AudioAnalyzer.hpp>
+#include <SFML/Audio/SoundBuffer.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <utility>
+
+#include <cassert>
+#include <cmath>
+#include <cstring>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))
+#define SFML_AUDIO_ANALYZER_SSE
+#include <xmmintrin.h>
+#endif
+
+
+namespace
+{
+////////////////////////////////////////////////////////////
+constexpr float pi = 3.14159265358979323846f;
+
+
+////////////////////////////////////////////////////////////
+float toFloat(std::int16_t sample)
+{
+    return static_cast<float>(sample) / 32768.f;
+}
+
+
+////////////////////////////////////////////////////////////
+float toFloat(float sample)
+{
+    return sample;
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+float mixFrame(const T* frame, unsigned int channelCount)
+{
+    if (channelCount == 1)
+        return toFloat(*frame);
+
+    float sum = 0.f;
+    for (unsigned int channel = 0; channel < channelCount; ++channel)
+        sum += toFloat(frame[channel]);
+
+    return sum / static_cast<float>(channelCount);
+}
+
+
+////////////////////////////////////////////////////////////
+float getWindowCoefficient(sf::AudioAnalyzer::Window window, std::size_t index, std::size_t size)
+{
+    // Periodic windows, which are the ones suited to spectral analysis
+    const float phase = 2.f * pi * static_cast<float>(index) / static_cast<float>(size);
+
+    switch (window)
+    {
+        case sf::AudioAnalyzer::Window::Rectangular:
+            return 1.f;
+        case sf::AudioAnalyzer::Window::Hann:
+            return 0.5f - 0.5f * std::cos(phase);
+        case sf::AudioAnalyzer::Window::Hamming:
+            return 0.54f - 0.46f * std::cos(phase);
+        case sf::AudioAnalyzer::Window::Blackman:
+            return 0.42f - 0.5f * std::cos(phase) + 0.08f * std::cos(2.f * phase);
+    }
+
+    return 1.f;
+}
+
+
+////////////////////////////////////////////////////////////
+// In-place radix-2 complex FFT on split real/imaginary arrays.
+// Splitting the components keeps every butterfly of a stage
+// contiguous in memory, which is what makes it vectorizable.
+////////////////////////////////////////////////////////////
+void fft(float* real, float* imag, std::size_t size, const float* twiddleReal, const float* twiddleImag)
+{
+    for (std::size_t half = 1; half < size; half *= 2)
+    {
+        for (std::size_t start = 0; start < size; start += 2 * half)
+        {
+            float* const aReal = real + start;
+            float* const aImag = imag + start;
+            float* const bReal = aReal + half;
+            float* const bImag = aImag + half;
+
+            std::size_t k = 0;
+
+#ifdef SFML_AUDIO_ANALYZER_SSE
+            for (; k + 4 <= half; k += 4)
+            {
+                const __m128 wReal = _mm_loadu_ps(twiddleReal + k);
+                const __m128 wImag = _mm_loadu_ps(twiddleImag + k);
+                const __m128 xReal = _mm_loadu_ps(bReal + k);
+                const __m128 xImag = _mm_loadu_ps(bImag + k);
+                const __m128 tReal = _mm_sub_ps(_mm_mul_ps(wReal, xReal), _mm_mul_ps(wImag, xImag));
+                const __m128 tImag = _mm_add_ps(_mm_mul_ps(wReal, xImag), _mm_mul_ps(wImag, xReal));
+                const __m128 yReal = _mm_loadu_ps(aReal + k);
+                const __m128 yImag = _mm_loadu_ps(aImag + k);
+
+                _mm_storeu_ps(bReal + k, _mm_sub_ps(yReal, tReal));
+                _mm_storeu_ps(bImag + k, _mm_sub_ps(yImag, tImag));
+                _mm_storeu_ps(aReal + k, _mm_add_ps(yReal, tReal));
+                _mm_storeu_ps(aImag + k, _mm_add_ps(yImag, tImag));
+            }
+#endif
+
+            for (; k < half; ++k)
+            {
+                const float tReal = twiddleReal[k] * bReal[k] - twiddleImag[k] * bImag[k];
+                const float tImag = twiddleReal[k] * bImag[k] + twiddleImag[k] * bReal[k];
+
+                bReal[k] = aReal[k] - tReal;
+                bImag[k] = aImag[k] - tImag;
+                aReal[k] += tReal;
+                aImag[k] += tImag;
+            }
+        }
+
+        // The twiddle factors of the next stage follow the ones of this stage
+        twiddleReal += half;
+        twiddleImag += half;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+// Compute the RMS and peak levels of a block, then apply the window to it
+////////////////////////////////////////////////////////////
+void measureAndWindow(float* samples, const float* window, std::size_t size, std::size_t validCount, float& rms, float& peak)
+{
+    float       sumOfSquares = 0.f;
+    float       maximum      = 0.f;
+    std::size_t i            = 0;
+
+#ifdef SFML_AUDIO_ANALYZER_SSE
+    const __m128 signMask  = _mm_set1_ps(-0.f);
+    __m128       sumVector = _mm_setzero_ps();
+    __m128       maxVector = _mm_setzero_ps();
+
+    for (; i + 4 <= size; i += 4)
+    {
+        const __m128 value = _mm_loadu_ps(samples + i);
+        sumVector          = _mm_add_ps(sumVector, _mm_mul_ps(value, value));
+        maxVector          = _mm_max_ps(maxVector, _mm_andnot_ps(signMask, value));
+        _mm_storeu_ps(samples + i, _mm_mul_ps(value, _mm_loadu_ps(window + i)));
+    }
+
+    float sums[4];
+    float maximums[4];
+    _mm_storeu_ps(sums, sumVector);
+    _mm_storeu_ps(maximums, maxVector);
+
+    sumOfSquares = (sums[0] + sums[1]) + (sums[2] + sums[3]);
+    maximum      = std::max(std::max(maximums[0], maximums[1]), std::max(maximums[2], maximums[3]));
+#endif
+
+    for (; i < size; ++i)
+    {
+        sumOfSquares += samples[i] * samples[i];
+        maximum = std::max(maximum, std::abs(samples[i]));
+        samples[i] *= window[i];
+    }
+
+    // Samples past the valid ones are zero, they only count in the FFT
+    rms  = validCount > 0 ? std::sqrt(sumOfSquares / static_cast<float>(validCount)) : 0.f;
+    peak = maximum;
+}
+
+
+////////////////////////////////////////////////////////////
+struct Queue
+{
+    explicit Queue(std::size_t capacity) : samples(capacity)
+    {
+    }
+
+    template <typename T>
+    void push(const T* data, std::uint64_t frameCount, unsigned int channelCount)
+    {
+        if (!data || channelCount == 0)
+            return;
+
+        const std::uint64_t write = writeIndex.load(std::memory_order_relaxed);
+        const std::uint64_t read  = readIndex.load(std::memory_order_acquire);
+        const std::uint64_t count = std::min<std::uint64_t>(frameCount, samples.size() - (write - read));
+        const std::uint64_t mask  = samples.size() - 1;
+
+        for (std::uint64_t i = 0; i < count; ++i)
+            samples[static_cast<std::size_t>((write + i) & mask)] = mixFrame(data + i * channelCount, channelCount);
+
+        writeIndex.store(write + count, std::memory_order_release);
+
+        if (count < frameCount)
+            droppedFrameCount.fetch_add(frameCount - count, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] bool pop(float* destination, std::size_t count)
+    {
+        const std::uint64_t read  = readIndex.load(std::memory_order_relaxed);
+        const std::uint64_t write = writeIndex.load(std::memory_order_acquire);
+
+        if (write - read < count)
+            return false;
+
+        const std::uint64_t mask = samples.size() - 1;
+        for (std::size_t i = 0; i < count; ++i)
+            destination[i] = samples[static_cast<std::size_t>((read + i) & mask)];
+
+        readIndex.store(read + count, std::memory_order_release);
+        return true;
+    }
+
+    std::vector<float>         samples;             //!< Ring buffer of mono samples, its size is a power of two
+    std::atomic<std::uint64_t> writeIndex{};        //!< Total number of samples written, only modified by the producer
+    std::atomic<std::uint64_t> readIndex{};         //!< Total number of samples read, only modified by the consumer
+    std::atomic<std::uint64_t> droppedFrameCount{}; //!< Number of frames dropped because the queue was full
+};
+} // namespace
+
+
+namespace sf
+{
+struct AudioAnalyzer::Impl
+{
+    Impl(std::size_t size, Window windowFunction) :
+    fftSize(size),
+    window(windowFunction),
+    queue(std::make_shared<Queue>(size * 8))
+    {
+        const std::size_t half = fftSize / 2;
+
+        // Window coefficients and their sum, which normalizes the magnitudes
+        windowCoefficients.resize(fftSize);
+        for (std::size_t i = 0; i < fftSize; ++i)
+        {
+            windowCoefficients[i] = getWindowCoefficient(window, i, fftSize);
+            windowSum += windowCoefficients[i];
+        }
+
+        // Bit reversal permutation of the half size complex FFT
+        std::size_t bits = 0;
+        while ((std::size_t{1} << bits) < half)
+            ++bits;
+
+        bitReversal.resize(half);
+        for (std::size_t i = 0; i < half; ++i)
+        {
+            std::size_t reversed = 0;
+            for (std::size_t bit = 0; bit < bits; ++bit)
+                reversed |= ((i >> bit) & 1) << (bits - 1 - bit);
+
+            bitReversal[i] = reversed;
+        }
+
+        // Twiddle factors of each stage of the complex FFT, stored one stage after the other
+        for (std::size_t stageHalf = 1; stageHalf < half; stageHalf *= 2)
+        {
+            for (std::size_t k = 0; k < stageHalf; ++k)
+            {
+                const float angle = -pi * static_cast<float>(k) / static_cast<float>(stageHalf);
+                twiddleReal.push_back(std::cos(angle));
+                twiddleImag.push_back(std::sin(angle));
+            }
+        }
+
+        // Twiddle factors used to split the complex spectrum into the real one
+        splitReal.resize(half + 1);
+        splitImag.resize(half + 1);
+        for (std::size_t k = 0; k <= half; ++k)
+        {
+            const float angle = -2.f * pi * static_cast<float>(k) / static_cast<float>(fftSize);
+            splitReal[k]      = std::cos(angle);
+            splitImag[k]      = std::sin(angle);
+        }
+
+        block.resize(fftSize);
+        real.resize(half);
+        imag.resize(half);
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Analyze the mono samples stored in the block
+    ////////////////////////////////////////////////////////////
+    void analyzeBlock(Frame& frame, std::size_t validCount, unsigned int rate)
+    {
+        const std::size_t half = fftSize / 2;
+
+        frame.sampleRate = rate;
+        measureAndWindow(block.data(), windowCoefficients.data(), fftSize, validCount, frame.rms, frame.peak);
+
+        // Pack the even samples in the real part and the odd ones in the imaginary part,
+        // so that a real FFT of size N is computed with a complex FFT of size N / 2
+        for (std::size_t i = 0; i < half; ++i)
+        {
+            real[bitReversal[i]] = block[2 * i];
+            imag[bitReversal[i]] = block[2 * i + 1];
+        }
+
+        fft(real.data(), imag.data(), half, twiddleReal.data(), twiddleImag.data());
+
+        // Separate the spectra of the even and odd samples, and combine them
+        const float scale = windowSum > 0.f ? 2.f / windowSum : 0.f;
+        frame.magnitudes.resize(half + 1);
+
+        for (std::size_t k = 0; k <= half; ++k)
+        {
+            const std::size_t i = k % half;
+            const std::size_t j = (half - k) % half;
+
+            const float evenReal = 0.5f * (real[i] + real[j]);
+            const float evenImag = 0.5f * (imag[i] - imag[j]);
+            const float oddReal  = 0.5f * (imag[i] + imag[j]);
+            const float oddImag  = -0.5f * (real[i] - real[j]);
+
+            const float valueReal = evenReal + splitReal[k] * oddReal - splitImag[k] * oddImag;
+            const float valueImag = evenImag + splitReal[k] * oddImag + splitImag[k] * oddReal;
+            const float magnitude = std::sqrt(valueReal * valueReal + valueImag * valueImag) * scale;
+
+            // The DC and Nyquist bins are not mirrored in the negative frequencies
+            frame.magnitudes[k] = (k == 0 || k == half) ? magnitude * 0.5f : magnitude;
+        }
+    }
+
+    template <typename T>
+    [[nodiscard]] Frame analyze(const T* samples, std::uint64_t frameCount, unsigned int channelCount, unsigned int rate)
+    {
+        const std::size_t count = (samples && channelCount > 0)
+                                      ? static_cast<std::size_t>(std::min<std::uint64_t>(frameCount, fftSize))
+                                      : 0;
+
+        for (std::size_t i = 0; i < count; ++i)
+            block[i] = mixFrame(samples + i * channelCount, channelCount);
+
+        std::fill(block.begin() + static_cast<std::ptrdiff_t>(count), block.end(), 0.f);
+
+        Frame frame;
+        analyzeBlock(frame, count, rate);
+        return frame;
+    }
+
+    std::size_t              fftSize;            //!< Number of frames analyzed at once
+    Window                   window;             //!< Window function
+    std::vector<float>       windowCoefficients; //!< Precomputed window function
+    float                    windowSum{};        //!< Sum of the window coefficients
+    std::vector<std::size_t> bitReversal;        //!< Bit reversal permutation of the complex FFT input
+    std::vector<float>       twiddleReal;        //!< Real part of the twiddle factors of the complex FFT
+    std::vector<float>       twiddleImag;        //!< Imaginary part of the twiddle factors of the complex FFT
+    std::vector<float>       splitReal;          //!< Real part of the twiddle factors of the real FFT post-processing
+    std::vector<float>       splitImag;          //!< Imaginary part of the twiddle factors of the real FFT post-processing
+    std::vector<float>       block;              //!< Mono samples being analyzed
+    std::vector<float>       real;               //!< Real part of the complex FFT data
+    std::vector<float>       imag;               //!< Imaginary part of the complex FFT data
+    std::shared_ptr<Queue>   queue;              //!< Queue of samples pushed from the audio thread
+    unsigned int             sampleRate{44100};  //!< Sample rate of the pushed samples
+};
+
+
+////////////////////////////////////////////////////////////
+float AudioAnalyzer::Frame::getBandEnergy(float lowFrequency, float highFrequency) const
+{
+    float energy = 0.f;
+
+    for (std::size_t bin = 0; bin < magnitudes.size(); ++bin)
+    {
+        const float frequency = getBinFrequency(bin);
+
+        if ((frequency >= lowFrequency) && (frequency < highFrequency))
+            energy += magnitudes[bin] * magnitudes[bin];
+    }
+
+    return energy;
+}
+
+
+////////////////////////////////////////////////////////////
+float AudioAnalyzer::Frame::getBinFrequency(std::size_t bin) const
+{
+    if (magnitudes.size() < 2)
+        return 0.f;
+
+    const auto fftSize = static_cast<float>((magnitudes.size() - 1) * 2);
+    return static_cast<float>(bin) * static_cast<float>(sampleRate) / fftSize;
+}
+
+
+////////////////////////////////////////////////////////////
+AudioAnalyzer::AudioAnalyzer(std::size_t fftSize, Window window)
+{
+    assert(fftSize >= 4 && (fftSize & (fftSize - 1)) == 0 && "FFT size must be a power of two greater or equal to 4");
+
+    m_impl = std::make_unique<Impl>(fftSize, window);
+}
+
+
+////////////////////////////////////////////////////////////
+AudioAnalyzer::~AudioAnalyzer() = default;
+
+
+////////////////////////////////////////////////////////////
+AudioAnalyzer::AudioAnalyzer(AudioAnalyzer&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+AudioAnalyzer& AudioAnalyzer::operator=(AudioAnalyzer&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+std::size_t AudioAnalyzer::getFftSize() const
+{
+    return m_impl->fftSize;
+}
+
+
+////////////////////////////////////////////////////////////
+AudioAnalyzer::Window AudioAnalyzer::getWindow() const
+{
+    return m_impl->window;
+}
+
+
+////////////////////////////////////////////////////////////
+AudioAnalyzer::Frame AudioAnalyzer::analyze(const std::int16_t* samples,
+                                            std::uint64_t       frameCount,
+                                            unsigned int        channelCount,
+                                            unsigned int        sampleRate)
+{
+    return m_impl->analyze(samples, frameCount, channelCount, sampleRate);
+}
+
+
+////////////////////////////////////////////////////////////
+AudioAnalyzer::Frame AudioAnalyzer::analyze(const float* samples, std::uint64_t frameCount, unsigned int channelCount, unsigned int sampleRate)
+{
+    return m_impl->analyze(samples, frameCount, channelCount, sampleRate);
+}
+
+
+////////////////////////////////////////////////////////////
+AudioAnalyzer::Frame AudioAnalyzer::analyze(const SoundBuffer& buffer, Time offset)
+{
+    const unsigned int channelCount = buffer.getChannelCount();
+    const unsigned int sampleRate   = buffer.getSampleRate();
+
+    if (channelCount == 0 || sampleRate == 0)
+        return m_impl->analyze(static_cast<const std::int16_t*>(nullptr), 0, 1, sampleRate);
+
+    // Only consider the samples that are already decoded if the buffer is being loaded progressively
+    const std::uint64_t frameCount = buffer.getDecodedSampleCount() / channelCount;
+    const std::uint64_t firstFrame = std::min<std::uint64_t>(
+        static_cast<std::uint64_t>(std::max<std::int64_t>(offset.asMicroseconds(), 0)) * sampleRate / 1000000,
+        frameCount);
+
+    return m_impl->analyze(buffer.getSamples() + firstFrame * channelCount, frameCount - firstFrame, channelCount, sampleRate);
+}
+
+
+////////////////////////////////////////////////////////////
+void AudioAnalyzer::push(const std::int16_t* samples, std::uint64_t frameCount, unsigned int channelCount)
+{
+    m_impl->queue->push(samples, frameCount, channelCount);
+}
+
+
+////////////////////////////////////////////////////////////
+void AudioAnalyzer::push(const float* samples, std::uint64_t frameCount, unsigned int channelCount)
+{
+    m_impl->queue->push(samples, frameCount, channelCount);
+}
+
+
+////////////////////////////////////////////////////////////
+SoundSource::EffectProcessor AudioAnalyzer::createTap() const
+{
+    return [queue = m_impl->queue](const float*  inputFrames,
+                                   unsigned int& inputFrameCount,
+                                   float*        outputFrames,
+                                   unsigned int& outputFrameCount,
+                                   unsigned int  frameChannelCount)
+    {
+        const unsigned int frameCount = std::min(inputFrameCount, outputFrameCount);
+
+        if (inputFrames && outputFrames)
+            std::memcpy(outputFrames, inputFrames, sizeof(float) * frameCount * frameChannelCount);
+
+        queue->push(inputFrames, frameCount, frameChannelCount);
+
+        inputFrameCount  = frameCount;
+        outputFrameCount = frameCount;
+    };
+}
+
+
+////////////////////////////////////////////////////////////
+bool AudioAnalyzer::process(Frame& frame)
+{
+    if (!m_impl->queue->pop(m_impl->block.data(), m_impl->fftSize))
+        return false;
+
+    m_impl->analyzeBlock(frame, m_impl->fftSize, m_impl->sampleRate);
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void AudioAnalyzer::setSampleRate(unsigned int sampleRate)
+{
+    m_impl->sampleRate = sampleRate;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int AudioAnalyzer::getSampleRate() const
+{
+    return m_impl->sampleRate;
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint64_t AudioAnalyzer::getDroppedFrameCount() const
+{
+    return m_impl->queue->droppedFrameCount.load(std::memory_order_relaxed);
+}
+
+} // namespace sf
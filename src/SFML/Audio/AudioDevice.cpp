@@ -26,6 +26,7 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <SFML/Audio/AudioDevice.hpp>
+#include <SFML/Audio/DeviceCache.hpp>
 #include <SFML/Audio/PlaybackDevice.hpp>
 
 #include <SFML/System/Err.hpp>
@@ -53,6 +54,37 @@ std::optional<std::string>& getCurrentDevice()
     static std::optional<std::string> currentDevice;
     return currentDevice;
 }
+
+
+////////////////////////////////////////////////////////////
+void applySpatialUpdate(const AudioDevice::SpatialUpdate& update)
+{
+    if (update.position)
+        ma_sound_set_position(update.sound, update.position->x, update.position->y, update.position->z);
+
+    if (update.direction)
+        ma_sound_set_direction(update.sound, update.direction->x, update.direction->y, update.direction->z);
+
+    if (update.velocity)
+        ma_sound_set_velocity(update.sound, update.velocity->x, update.velocity->y, update.velocity->z);
+}
+
+
+////////////////////////////////////////////////////////////
+void applyListenerUpdate(ma_engine& engine, const SoundSource::ListenerUpdate& update)
+{
+    if (update.position)
+        ma_engine_listener_set_position(&engine, 0, update.position->x, update.position->y, update.position->z);
+
+    if (update.direction)
+        ma_engine_listener_set_direction(&engine, 0, update.direction->x, update.direction->y, update.direction->z);
+
+    if (update.velocity)
+        ma_engine_listener_set_velocity(&engine, 0, update.velocity->x, update.velocity->y, update.velocity->z);
+
+    if (update.upVector)
+        ma_engine_listener_set_world_up(&engine, 0, update.upVector->x, update.upVector->y, update.upVector->z);
+}
 } // namespace
 
 
@@ -177,6 +209,35 @@ ma_engine* AudioDevice::getEngine()
 }
 
 
+////////////////////////////////////////////////////////////
+Time AudioDevice::getEngineTime()
+{
+    const auto* engine = getEngine();
+
+    if (!engine || ma_engine_get_sample_rate(engine) == 0)
+        return Time::Zero;
+
+    const auto frames = ma_engine_get_time_in_pcm_frames(engine);
+    return microseconds(static_cast<std::int64_t>(frames * 1'000'000 / ma_engine_get_sample_rate(engine)));
+}
+
+
+////////////////////////////////////////////////////////////
+Time AudioDevice::getOutputLatency()
+{
+    const auto* instance = getInstance();
+
+    if (!instance || !instance->m_playbackDevice || instance->m_playbackDevice->playback.internalSampleRate == 0)
+        return Time::Zero;
+
+    // The device buffers this many frames between the engine and the speakers
+    const auto& playback = instance->m_playbackDevice->playback;
+    const auto  frames   = std::uint64_t{playback.internalPeriodSizeInFrames} * playback.internalPeriods;
+
+    return microseconds(static_cast<std::int64_t>(frames * 1'000'000 / playback.internalSampleRate));
+}
+
+
 ////////////////////////////////////////////////////////////
 bool AudioDevice::reinitialize()
 {
@@ -214,63 +275,35 @@ bool AudioDevice::reinitialize()
 ////////////////////////////////////////////////////////////
 std::vector<AudioDevice::DeviceEntry> AudioDevice::getAvailableDevices()
 {
-    const auto getDevices = [](auto& context)
-    {
-        ma_device_info* deviceInfos{};
-        std::uint32_t   deviceCount{};
-
-        // Get the playback devices
-        if (const auto result = ma_context_get_devices(&context, &deviceInfos, &deviceCount, nullptr, nullptr);
-            result != MA_SUCCESS)
-        {
-            err() << "Failed to get audio playback devices: " << ma_result_description(result) << std::endl;
-            return std::vector<DeviceEntry>{};
-        }
-
-        std::vector<DeviceEntry> deviceList;
-        deviceList.reserve(deviceCount);
+    // Use an existing instance's context if one exists, so that the device IDs are valid for it
+    auto*      instance    = getInstance();
+    const auto deviceInfos = DeviceCache::getDevices(ma_device_type_playback,
+                                                     instance && instance->m_context ? &*instance->m_context : nullptr);
 
-        // In order to report devices with identical names and still allow
-        // the user to differentiate between them when selecting, we append
-        // an index (number) to their name starting from the second entry
-        std::unordered_map<std::string, int> deviceIndices;
-        deviceIndices.reserve(deviceCount);
+    std::vector<DeviceEntry> deviceList;
+    deviceList.reserve(deviceInfos.size());
 
-        for (auto i = 0u; i < deviceCount; ++i)
-        {
-            auto  name  = std::string(deviceInfos[i].name);
-            auto& index = deviceIndices[name];
-
-            ++index;
-
-            if (index > 1)
-                name += ' ' + std::to_string(index);
-
-            // Make sure the default device is always placed at the front
-            deviceList.emplace(deviceInfos[i].isDefault ? deviceList.begin() : deviceList.end(),
-                               DeviceEntry{name, deviceInfos[i].id, deviceInfos[i].isDefault == MA_TRUE});
-        }
-
-        return deviceList;
-    };
+    // In order to report devices with identical names and still allow
+    // the user to differentiate between them when selecting, we append
+    // an index (number) to their name starting from the second entry
+    std::unordered_map<std::string, int> deviceIndices;
+    deviceIndices.reserve(deviceInfos.size());
 
-    // Use an existing instance's context if one exists
-    auto* instance = getInstance();
+    for (const auto& deviceInfo : deviceInfos)
+    {
+        auto  name  = std::string(deviceInfo.name);
+        auto& index = deviceIndices[name];
 
-    if (instance && instance->m_context)
-        return getDevices(*instance->m_context);
+        ++index;
 
-    // Otherwise, construct a temporary context
-    ma_context context{};
+        if (index > 1)
+            name += ' ' + std::to_string(index);
 
-    if (const auto result = ma_context_init(nullptr, 0, nullptr, &context); result != MA_SUCCESS)
-    {
-        err() << "Failed to initialize the audio playback context: " << ma_result_description(result) << std::endl;
-        return {};
+        // Make sure the default device is always placed at the front
+        deviceList.emplace(deviceInfo.isDefault ? deviceList.begin() : deviceList.end(),
+                           DeviceEntry{name, deviceInfo.id, deviceInfo.isDefault == MA_TRUE});
     }
 
-    auto deviceList = getDevices(context);
-    ma_context_uninit(&context);
     return deviceList;
 }
 
@@ -452,6 +485,101 @@ Vector3f AudioDevice::getUpVector()
 }
 
 
+////////////////////////////////////////////////////////////
+void AudioDevice::queueSpatialUpdates(const std::vector<SpatialUpdate>& updates, const SoundSource::ListenerUpdate& listener)
+{
+    // Store the listener properties so that they can be queried right away
+    auto& properties = getListenerProperties();
+
+    if (listener.position)
+        properties.position = *listener.position;
+
+    if (listener.direction)
+        properties.direction = *listener.direction;
+
+    if (listener.velocity)
+        properties.velocity = *listener.velocity;
+
+    if (listener.upVector)
+        properties.upVector = *listener.upVector;
+
+    auto* instance = getInstance();
+
+    // Without an engine nothing is being mixed, so the changes can be applied right away
+    if (!instance || !instance->m_engine)
+    {
+        for (const auto& update : updates)
+            applySpatialUpdate(update);
+
+        return;
+    }
+
+    const std::lock_guard lock(instance->m_spatialMutex);
+
+    // Changes queued later override the earlier ones since they are applied in order
+    instance->m_spatialUpdates.insert(instance->m_spatialUpdates.end(), updates.begin(), updates.end());
+
+    auto& pending = instance->m_listenerUpdate;
+
+    if (listener.position)
+        pending.position = listener.position;
+
+    if (listener.direction)
+        pending.direction = listener.direction;
+
+    if (listener.velocity)
+        pending.velocity = listener.velocity;
+
+    if (listener.upVector)
+        pending.upVector = listener.upVector;
+}
+
+
+////////////////////////////////////////////////////////////
+void AudioDevice::flushSpatialUpdates(ma_sound& sound)
+{
+    auto* instance = getInstance();
+
+    if (!instance)
+        return;
+
+    const std::lock_guard lock(instance->m_spatialMutex);
+
+    auto& updates = instance->m_spatialUpdates;
+
+    for (const auto& update : updates)
+    {
+        if (update.sound == &sound)
+            applySpatialUpdate(update);
+    }
+
+    updates.erase(std::remove_if(updates.begin(),
+                                 updates.end(),
+                                 [&sound](const SpatialUpdate& update) { return update.sound == &sound; }),
+                  updates.end());
+}
+
+
+////////////////////////////////////////////////////////////
+void AudioDevice::applySpatialUpdates()
+{
+    const std::unique_lock lock(m_spatialMutex, std::try_to_lock);
+
+    // Don't wait for the thread queueing changes, they will be applied with the next period
+    if (!lock.owns_lock())
+        return;
+
+    for (const auto& update : m_spatialUpdates)
+        applySpatialUpdate(update);
+
+    applyListenerUpdate(*m_engine, m_listenerUpdate);
+
+    // Keep the capacity, the queue is typically refilled every frame
+    m_spatialUpdates.clear();
+    m_listenerUpdate = {};
+}
+
+
 ////////////////////////////////////////////////////////////
 std::optional<ma_device_id> AudioDevice::getSelectedDeviceId() const
 {
@@ -488,14 +616,18 @@ bool AudioDevice::initialize()
 
         if (audioDevice.m_engine)
         {
+            // Apply the batched spatial changes at once, before mixing the period
+            audioDevice.applySpatialUpdates();
+
             if (const auto result = ma_engine_read_pcm_frames(&*audioDevice.m_engine, output, frameCount, nullptr);
                 result != MA_SUCCESS)
                 err() << "Failed to read PCM frames from audio engine: " << ma_result_description(result) << std::endl;
         }
     };
-    playbackDeviceConfig.pUserData          = this;
-    playbackDeviceConfig.playback.format    = ma_format_f32;
-    playbackDeviceConfig.playback.pDeviceID = deviceId ? &*deviceId : nullptr;
+    playbackDeviceConfig.notificationCallback = &DeviceCache::onDeviceNotification;
+    playbackDeviceConfig.pUserData            = this;
+    playbackDeviceConfig.playback.format      = ma_format_f32;
+    playbackDeviceConfig.playback.pDeviceID   = deviceId ? &*deviceId : nullptr;
 
     if (const auto result = ma_device_init(&*m_context, &playbackDeviceConfig, &*m_playbackDevice); result != MA_SUCCESS)
     {
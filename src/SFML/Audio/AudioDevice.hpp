@@ -28,7 +28,9 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <SFML/Audio/Listener.hpp>
+#include <SFML/Audio/SoundSource.hpp>
 
+#include <SFML/System/Time.hpp>
 #include <SFML/System/Vector3.hpp>
 
 #include <miniaudio.h>
@@ -75,6 +77,22 @@ public:
     ////////////////////////////////////////////////////////////
     static ma_engine* getEngine();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the current time of the audio engine clock
+    ///
+    /// \return Engine time, or `Time::Zero` if there is no engine
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static Time getEngineTime();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the buffering latency of the playback device
+    ///
+    /// \return Output latency, or `Time::Zero` if there is no device
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static Time getOutputLatency();
+
     ////////////////////////////////////////////////////////////
     /// \brief Reinitialize the audio engine and device
     ///
@@ -324,7 +342,53 @@ public:
     ////////////////////////////////////////////////////////////
     static Vector3f getUpVector();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Changes of the spatial properties of a sound
+    ///
+    /// \see queueSpatialUpdates
+    ///
+    ////////////////////////////////////////////////////////////
+    struct SpatialUpdate
+    {
+        ma_sound*               sound{};   //!< Sound to update
+        std::optional<Vector3f> position;  //!< New position of the sound, if it changes
+        std::optional<Vector3f> direction; //!< New direction of the sound, if it changes
+        std::optional<Vector3f> velocity;  //!< New velocity of the sound, if it changes
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Queue spatial changes to be applied before the next mixing period
+    ///
+    /// If no engine exists, the changes are applied immediately.
+    ///
+    /// \param updates  Changes of the sounds
+    /// \param listener Changes of the listener
+    ///
+    ////////////////////////////////////////////////////////////
+    static void queueSpatialUpdates(const std::vector<SpatialUpdate>& updates, const SoundSource::ListenerUpdate& listener);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Apply the queued spatial changes of a sound immediately
+    ///
+    /// This function must be called before a sound is uninitialized
+    /// so that the engine doesn't access it afterwards.
+    ///
+    /// \param sound The sound whose pending changes should be applied
+    ///
+    ////////////////////////////////////////////////////////////
+    static void flushSpatialUpdates(ma_sound& sound);
+
 private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Apply the queued spatial changes, called by the audio thread
+    ///
+    /// The changes are skipped until the next period if the queue
+    /// is currently being modified, so that the audio thread never
+    /// waits.
+    ///
+    ////////////////////////////////////////////////////////////
+    void applySpatialUpdates();
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the device ID of the currently selected device
     ///
@@ -370,12 +434,15 @@ private:
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    std::optional<ma_log>     m_log;            //!< The miniaudio log
-    std::optional<ma_context> m_context;        //!< The miniaudio context
-    std::optional<ma_device>  m_playbackDevice; //!< The miniaudio playback device
-    std::optional<ma_engine>  m_engine;         //!< The miniaudio engine (used for effects and spatialization)
-    ResourceEntryList         m_resources;      //!< Registered resources
-    std::mutex                m_resourcesMutex; //!< The mutex guarding the registered resources
+    std::optional<ma_log>       m_log;            //!< The miniaudio log
+    std::optional<ma_context>   m_context;        //!< The miniaudio context
+    std::optional<ma_device>    m_playbackDevice; //!< The miniaudio playback device
+    std::optional<ma_engine>    m_engine;         //!< The miniaudio engine (used for effects and spatialization)
+    ResourceEntryList           m_resources;      //!< Registered resources
+    std::mutex                  m_resourcesMutex; //!< The mutex guarding the registered resources
+    std::vector<SpatialUpdate>  m_spatialUpdates; //!< Spatial changes of sounds waiting for the next mixing period
+    SoundSource::ListenerUpdate m_listenerUpdate; //!< Spatial changes of the listener waiting for the next mixing period
+    std::mutex                  m_spatialMutex;   //!< The mutex guarding the pending spatial changes
 };
 
 } // namespace sf::priv
@@ -0,0 +1,164 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/DeviceCache.hpp>
+
+#include <SFML/System/Err.hpp>
+
+#include <atomic>
+#include <mutex>
+#include <optional>
+#include <ostream>
+
+#include <cstdint>
+
+
+namespace
+{
+////////////////////////////////////////////////////////////
+struct DeviceList
+{
+    std::vector<ma_device_info> devices; //!< Devices enumerated the last time
+    std::optional<ma_backend>   backend; //!< Backend the devices were enumerated with, unset if never enumerated
+    std::atomic<bool>           stale{}; //!< Whether the list must be enumerated again
+};
+
+
+////////////////////////////////////////////////////////////
+struct Cache
+{
+    ~Cache()
+    {
+        if (context)
+            ma_context_uninit(&*context);
+    }
+
+    [[nodiscard]] ma_context* getContext()
+    {
+        if (context)
+            return &*context;
+
+        context.emplace();
+
+        if (const auto result = ma_context_init(nullptr, 0, nullptr, &*context); result != MA_SUCCESS)
+        {
+            context.reset();
+            sf::err() << "Failed to initialize the audio context: " << ma_result_description(result) << std::endl;
+            return nullptr;
+        }
+
+        return &*context;
+    }
+
+    std::mutex                mutex;    //!< Mutex protecting the lists and the context
+    std::optional<ma_context> context;  //!< Context used to enumerate devices when the caller doesn't provide one
+    DeviceList                playback; //!< Cached playback devices
+    DeviceList                capture;  //!< Cached capture devices
+};
+
+
+////////////////////////////////////////////////////////////
+Cache& getCache()
+{
+    static Cache cache;
+    return cache;
+}
+
+
+////////////////////////////////////////////////////////////
+DeviceList& getList(Cache& cache, ma_device_type type)
+{
+    return type == ma_device_type_capture ? cache.capture : cache.playback;
+}
+} // namespace
+
+
+namespace sf::priv::DeviceCache
+{
+////////////////////////////////////////////////////////////
+std::vector<ma_device_info> getDevices(ma_device_type type, ma_context* context)
+{
+    auto&                 cache = getCache();
+    auto&                 list  = getList(cache, type);
+    const std::lock_guard lock(cache.mutex);
+
+    if (!context)
+        context = cache.getContext();
+
+    if (!context)
+        return {};
+
+    if (!list.stale && list.backend == context->backend)
+        return list.devices;
+
+    // Clear the flags before enumerating, so that a notification received meanwhile isn't lost
+    cache.playback.stale = false;
+    cache.capture.stale  = false;
+
+    ma_device_info* playbackInfos = nullptr;
+    std::uint32_t   playbackCount = 0;
+    ma_device_info* captureInfos  = nullptr;
+    std::uint32_t   captureCount  = 0;
+
+    if (const auto result = ma_context_get_devices(context, &playbackInfos, &playbackCount, &captureInfos, &captureCount);
+        result != MA_SUCCESS)
+    {
+        err() << "Failed to get audio " << (type == ma_device_type_capture ? "capture" : "playback")
+              << " devices: " << ma_result_description(result) << std::endl;
+        list.stale = true;
+        return {};
+    }
+
+    // The enumeration returns both types of devices, update both lists at once
+    cache.playback.devices.assign(playbackInfos, playbackInfos + playbackCount);
+    cache.playback.backend = context->backend;
+    cache.capture.devices.assign(captureInfos, captureInfos + captureCount);
+    cache.capture.backend = context->backend;
+
+    return list.devices;
+}
+
+
+////////////////////////////////////////////////////////////
+void invalidate(ma_device_type type)
+{
+    getList(getCache(), type).stale = true;
+}
+
+
+////////////////////////////////////////////////////////////
+void onDeviceNotification(const ma_device_notification* notification)
+{
+    if (notification->type == ma_device_notification_type_rerouted)
+    {
+        invalidate(ma_device_type_playback);
+        invalidate(ma_device_type_capture);
+    }
+}
+
+} // namespace sf::priv::DeviceCache
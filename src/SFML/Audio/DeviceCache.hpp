@@ -0,0 +1,83 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <miniaudio.h>
+
+#include <vector>
+
+
+namespace sf::priv::DeviceCache
+{
+////////////////////////////////////////////////////////////
+/// \brief Get the list of the available devices of a given type
+///
+/// Enumerating devices is slow on some backends, so the list
+/// is enumerated once and then shared by all callers until it
+/// is invalidated.
+///
+/// If a context is provided, the devices are enumerated with
+/// it so that their IDs are valid for this context, otherwise
+/// a context owned by the cache is used. The list is enumerated
+/// again if the backend of the context differs from the one the
+/// cached list was enumerated with.
+///
+/// \param type    Type of the devices, either playback or capture
+/// \param context Context to enumerate devices with, or `nullptr` to use the cache's own context
+///
+/// \return List of available devices
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] std::vector<ma_device_info> getDevices(ma_device_type type, ma_context* context = nullptr);
+
+////////////////////////////////////////////////////////////
+/// \brief Invalidate the list of devices of a given type
+///
+/// The list will be enumerated again on the next call to
+/// `getDevices`. This function is lock-free so that it can
+/// be called from device notification callbacks.
+///
+/// \param type Type of the devices, either playback or capture
+///
+////////////////////////////////////////////////////////////
+void invalidate(ma_device_type type);
+
+////////////////////////////////////////////////////////////
+/// \brief Invalidate the device lists when a device is rerouted
+///
+/// This function is meant to be set as the notification
+/// callback of miniaudio devices, the default device may have
+/// changed when a device is rerouted.
+///
+/// \param notification Notification sent by miniaudio
+///
+////////////////////////////////////////////////////////////
+void onDeviceNotification(const ma_device_notification* notification);
+
+} // namespace sf::priv::DeviceCache
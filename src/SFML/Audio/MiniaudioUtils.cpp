@@ -34,6 +34,8 @@
 
 #include <miniaudio.h>
 
+#include <algorithm>
+#include <limits>
 #include <ostream>
 
 #include <cassert>
@@ -132,6 +134,7 @@ MiniaudioUtils::SoundBase::SoundBase(const ma_data_source_vtable&     dataSource
 MiniaudioUtils::SoundBase::~SoundBase()
 {
     AudioDevice::unregisterResource(resourceEntryIter);
+    AudioDevice::flushSpatialUpdates(sound);
     ma_sound_uninit(&sound);
     ma_node_uninit(&effectNode, nullptr);
     ma_data_source_uninit(&dataSourceBase);
@@ -198,6 +201,8 @@ void MiniaudioUtils::SoundBase::initialize(ma_sound_end_proc endCallback)
 ////////////////////////////////////////////////////////////
 void MiniaudioUtils::SoundBase::deinitialize()
 {
+    // Apply the pending spatial changes so that they are part of the saved settings
+    AudioDevice::flushSpatialUpdates(sound);
     savedSettings = saveSettings(sound);
     ma_sound_uninit(&sound);
     ma_node_uninit(&effectNode, nullptr);
@@ -408,4 +413,34 @@ std::uint64_t MiniaudioUtils::getFrameIndex(ma_sound& sound, Time timeOffset)
     return frameIndex;
 }
 
+
+////////////////////////////////////////////////////////////
+std::uint64_t MiniaudioUtils::getEngineFrame(const ma_engine& engine, Time engineTime)
+{
+    const auto microseconds = static_cast<std::uint64_t>(std::max(engineTime.asMicroseconds(), std::int64_t{0}));
+
+    return microseconds * ma_engine_get_sample_rate(&engine) / 1'000'000;
+}
+
+
+////////////////////////////////////////////////////////////
+bool MiniaudioUtils::isScheduledStopReached(const ma_sound& sound)
+{
+    const auto* engine = ma_sound_get_engine(&sound);
+
+    if (engine == nullptr)
+        return false;
+
+    // Without a scheduled stop the stop time is the largest representable time
+    return ma_node_get_state_time(&sound, ma_node_state_stopped) <= ma_engine_get_time_in_pcm_frames(engine);
+}
+
+
+////////////////////////////////////////////////////////////
+void MiniaudioUtils::clearSchedule(ma_sound& sound)
+{
+    ma_node_set_state_time(&sound, ma_node_state_started, 0);
+    ma_node_set_state_time(&sound, ma_node_state_stopped, std::numeric_limits<std::uint64_t>::max());
+}
+
 } // namespace sf::priv
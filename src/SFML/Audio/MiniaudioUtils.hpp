@@ -106,6 +106,9 @@ struct SoundBase
 [[nodiscard]] SoundChannel  miniaudioChannelToSoundChannel(ma_channel soundChannel);
 [[nodiscard]] Time          getPlayingOffset(ma_sound& sound);
 [[nodiscard]] std::uint64_t getFrameIndex(ma_sound& sound, Time timeOffset);
+[[nodiscard]] std::uint64_t getEngineFrame(const ma_engine& engine, Time engineTime);
+[[nodiscard]] bool          isScheduledStopReached(const ma_sound& sound);
+void                        clearSchedule(ma_sound& sound);
 
 } // namespace priv::MiniaudioUtils
 } // namespace sf
@@ -31,12 +31,146 @@
 
 #include <SFML/System/Err.hpp>
 #include <SFML/System/Exception.hpp>
+#include <SFML/System/Sleep.hpp>
+#include <SFML/System/Time.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <ostream>
+#include <thread>
+#include <utility>
 
 #include <cassert>
+#include <cstring>
 
 
 namespace sf
 {
+////////////////////////////////////////////////////////////
+struct OutputSoundFile::AsyncWriter
+{
+    AsyncWriter(SoundFileWriter& fileWriter, std::size_t queueSize, unsigned int frameChannelCount, OverflowPolicy policy) :
+    writer(fileWriter),
+    // Keep whole frames in the queue so that neither side ever splits one
+    samples(std::max<std::size_t>(queueSize - queueSize % frameChannelCount, frameChannelCount)),
+    overflowPolicy(policy),
+    thread(&AsyncWriter::run, this)
+    {
+    }
+
+    ~AsyncWriter()
+    {
+        stopping.store(true, std::memory_order_release);
+        thread.join();
+    }
+
+    void push(const std::int16_t* data, std::uint64_t count)
+    {
+        const std::uint64_t capacity = samples.size();
+
+        while (count > 0)
+        {
+            const std::uint64_t write     = writeIndex.load(std::memory_order_relaxed);
+            const std::uint64_t read      = readIndex.load(std::memory_order_acquire);
+            const std::uint64_t available = capacity - (write - read);
+            const std::uint64_t pushed    = std::min(count, available);
+
+            if (pushed == 0)
+            {
+                if (overflowPolicy == OverflowPolicy::Drop)
+                {
+                    droppedSampleCount.fetch_add(count, std::memory_order_relaxed);
+                    return;
+                }
+
+                // Let the writer thread catch up
+                sleep(milliseconds(1));
+                continue;
+            }
+
+            // Copy the samples, in two parts if they wrap around the end of the queue
+            const auto          start = static_cast<std::size_t>(write % capacity);
+            const std::uint64_t first = std::min<std::uint64_t>(pushed, capacity - start);
+            std::memcpy(samples.data() + start, data, static_cast<std::size_t>(first) * sizeof(std::int16_t));
+            std::memcpy(samples.data(), data + first, static_cast<std::size_t>(pushed - first) * sizeof(std::int16_t));
+
+            writeIndex.store(write + pushed, std::memory_order_release);
+
+            data += pushed;
+            count -= pushed;
+        }
+    }
+
+    void run()
+    {
+        const std::uint64_t capacity = samples.size();
+
+        for (;;)
+        {
+            // Check the flag before the queue, so that samples pushed before stopping are still written
+            const bool          stop  = stopping.load(std::memory_order_acquire);
+            const std::uint64_t read  = readIndex.load(std::memory_order_relaxed);
+            const std::uint64_t write = writeIndex.load(std::memory_order_acquire);
+
+            if (read == write)
+            {
+                if (stop)
+                    return;
+
+                sleep(milliseconds(5));
+                continue;
+            }
+
+            // Write the contiguous part of the queued samples directly from the queue
+            const auto          start = static_cast<std::size_t>(read % capacity);
+            const std::uint64_t count = std::min<std::uint64_t>(write - read, capacity - start);
+            writer.write(samples.data() + start, count);
+
+            readIndex.store(read + count, std::memory_order_release);
+        }
+    }
+
+    SoundFileWriter&           writer;               //!< Writer that encodes the samples, owned by the output sound file
+    std::vector<std::int16_t>  samples;              //!< Ring buffer of queued samples, its size is a multiple of the channel count
+    OverflowPolicy             overflowPolicy;       //!< Behavior of push when the queue is full
+    std::atomic<std::uint64_t> writeIndex{};         //!< Total number of samples pushed, only modified by the producer
+    std::atomic<std::uint64_t> readIndex{};          //!< Total number of samples written, only modified by the writer thread
+    std::atomic<std::uint64_t> droppedSampleCount{}; //!< Number of samples dropped because the queue was full
+    std::atomic<bool>          stopping{};           //!< Tell the writer thread to exit once the queue is empty
+    std::thread                thread;               //!< Writer thread, started last
+};
+
+
+////////////////////////////////////////////////////////////
+OutputSoundFile::OutputSoundFile() = default;
+
+
+////////////////////////////////////////////////////////////
+OutputSoundFile::~OutputSoundFile()
+{
+    close();
+}
+
+
+////////////////////////////////////////////////////////////
+OutputSoundFile::OutputSoundFile(OutputSoundFile&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+OutputSoundFile& OutputSoundFile::operator=(OutputSoundFile&& right) noexcept
+{
+    if (this != &right)
+    {
+        // The writer thread must be stopped before the writer it uses is destroyed
+        close();
+        m_writer      = std::move(right.m_writer);
+        m_asyncWriter = std::move(right.m_asyncWriter);
+    }
+
+    return *this;
+}
+
+
 ////////////////////////////////////////////////////////////
 OutputSoundFile::OutputSoundFile(const std::filesystem::path&     filename,
                                  unsigned int                     sampleRate,
@@ -77,21 +211,75 @@ bool OutputSoundFile::openFromFile(const std::filesystem::path&     filename,
 }
 
 
+////////////////////////////////////////////////////////////
+bool OutputSoundFile::openFromFileAsync(const std::filesystem::path&     filename,
+                                        unsigned int                     sampleRate,
+                                        unsigned int                     channelCount,
+                                        const std::vector<SoundChannel>& channelMap,
+                                        std::size_t                      queueSize,
+                                        OverflowPolicy                   overflowPolicy)
+{
+    if (!openFromFile(filename, sampleRate, channelCount, channelMap))
+        return false;
+
+    if (channelCount == 0)
+    {
+        err() << "Failed to open output sound file asynchronously (invalid channel count)" << std::endl;
+        close();
+        return false;
+    }
+
+    m_asyncWriter = std::make_unique<AsyncWriter>(*m_writer, queueSize, channelCount, overflowPolicy);
+    return true;
+}
+
+
 ////////////////////////////////////////////////////////////
 void OutputSoundFile::write(const std::int16_t* samples, std::uint64_t count)
 {
     assert(m_writer);
 
     if (samples && count)
-        m_writer->write(samples, count);
+    {
+        if (m_asyncWriter)
+            m_asyncWriter->push(samples, count);
+        else
+            m_writer->write(samples, count);
+    }
 }
 
 
 ////////////////////////////////////////////////////////////
 void OutputSoundFile::close()
 {
-    // Destroy the reader
+    // Wait for the pending asynchronous writes, then destroy the writer
+    m_asyncWriter.reset();
     m_writer.reset();
 }
 
+
+////////////////////////////////////////////////////////////
+bool OutputSoundFile::isAsync() const
+{
+    return m_asyncWriter != nullptr;
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint64_t OutputSoundFile::getQueuedSampleCount() const
+{
+    if (!m_asyncWriter)
+        return 0;
+
+    const std::uint64_t read = m_asyncWriter->readIndex.load(std::memory_order_acquire);
+    return m_asyncWriter->writeIndex.load(std::memory_order_acquire) - read;
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint64_t OutputSoundFile::getDroppedSampleCount() const
+{
+    return m_asyncWriter ? m_asyncWriter->droppedSampleCount.load(std::memory_order_relaxed) : 0;
+}
+
 } // namespace sf
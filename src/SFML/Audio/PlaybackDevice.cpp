@@ -26,6 +26,7 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <SFML/Audio/AudioDevice.hpp>
+#include <SFML/Audio/DeviceCache.hpp>
 #include <SFML/Audio/PlaybackDevice.hpp>
 
 #include <algorithm>
@@ -61,14 +62,32 @@ std::optional<std::string> getDefaultDevice()
 }
 
 
+////////////////////////////////////////////////////////////
+void refreshAvailableDevices()
+{
+    priv::DeviceCache::invalidate(ma_device_type_playback);
+}
+
+
 ////////////////////////////////////////////////////////////
 bool setDevice(const std::string& name)
 {
-    // Perform a sanity check to make sure the user isn't passing us a non-existent device name
-    const auto devices = priv::AudioDevice::getAvailableDevices();
-    if (std::find_if(devices.begin(), devices.end(), [&name](const auto& device) { return device.name == name; }) ==
-        devices.end())
-        return false;
+    const auto hasDevice = [&name]
+    {
+        const auto devices = priv::AudioDevice::getAvailableDevices();
+        return std::find_if(devices.begin(), devices.end(), [&name](const auto& device) { return device.name == name; }) !=
+               devices.end();
+    };
+
+    // Perform a sanity check to make sure the user isn't passing us a non-existent device name,
+    // refreshing the cached list first in case the device was connected after it was enumerated
+    if (!hasDevice())
+    {
+        refreshAvailableDevices();
+
+        if (!hasDevice())
+            return false;
+    }
 
     return priv::AudioDevice::setDevice(name);
 }
@@ -80,4 +99,18 @@ std::optional<std::string> getDevice()
     return priv::AudioDevice::getDevice();
 }
 
+
+////////////////////////////////////////////////////////////
+Time getEngineTime()
+{
+    return priv::AudioDevice::getEngineTime();
+}
+
+
+////////////////////////////////////////////////////////////
+Time getOutputLatency()
+{
+    return priv::AudioDevice::getOutputLatency();
+}
+
 } // namespace sf::PlaybackDevice
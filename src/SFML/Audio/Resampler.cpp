@@ -0,0 +1,345 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/Resampler.hpp>
+#include <SFML/Audio/SampleConversion.hpp>
+
+#include <algorithm>
+#include <limits>
+
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+
+
+namespace
+{
+////////////////////////////////////////////////////////////
+struct QualitySettings
+{
+    std::size_t taps;    //!< Number of taps of the filter when upsampling
+    std::size_t phases;  //!< Number of precomputed fractional positions
+    double      beta;    //!< Shape parameter of the Kaiser window
+    double      rolloff; //!< Cutoff frequency relative to the Nyquist frequency
+};
+
+
+////////////////////////////////////////////////////////////
+QualitySettings getQualitySettings(sf::Resampler::Quality quality)
+{
+    switch (quality)
+    {
+        case sf::Resampler::Quality::Fast:
+            return {8, 64, 5., 0.85};
+        case sf::Resampler::Quality::Medium:
+            return {32, 256, 8., 0.92};
+        case sf::Resampler::Quality::Best:
+            return {64, 512, 10., 0.95};
+    }
+
+    return {32, 256, 8., 0.92};
+}
+
+
+////////////////////////////////////////////////////////////
+double besselI0(double x)
+{
+    // Power series of the modified Bessel function of the first kind, converges quickly for the values used here
+    double sum  = 1.;
+    double term = 1.;
+
+    for (int k = 1; k < 50 && term > sum * 1e-12; ++k)
+    {
+        const double factor = x / (2. * k);
+        term *= factor * factor;
+        sum += term;
+    }
+
+    return sum;
+}
+} // namespace
+
+
+namespace sf
+{
+struct Resampler::Impl
+{
+    Impl(unsigned int inputRate, unsigned int outputRate, unsigned int channels, Quality filterQuality) :
+    inputSampleRate(inputRate),
+    outputSampleRate(outputRate),
+    channelCount(channels),
+    quality(filterQuality)
+    {
+        const auto settings = getQualitySettings(quality);
+
+        // When downsampling, the filter gets narrower in frequency so it needs proportionally more taps
+        const std::size_t ratio = std::max<std::size_t>((inputSampleRate + outputSampleRate - 1) / outputSampleRate, 1);
+
+        taps   = settings.taps * ratio;
+        phases = settings.phases;
+
+        const double pi        = 3.14159265358979323846;
+        const double cutoff    = settings.rolloff * std::min(1., static_cast<double>(outputSampleRate) / inputSampleRate);
+        const double halfWidth = static_cast<double>(taps / 2);
+        const double norm      = besselI0(settings.beta);
+
+        // One filter per fractional position, plus one to interpolate the last phase towards the next sample
+        coefficients.resize((phases + 1) * taps);
+
+        for (std::size_t phase = 0; phase <= phases; ++phase)
+        {
+            const double fraction = static_cast<double>(phase) / static_cast<double>(phases);
+            double       sum      = 0.;
+
+            for (std::size_t tap = 0; tap < taps; ++tap)
+            {
+                // Distance between the tap and the position of the output sample, in input samples
+                const double distance = static_cast<double>(tap) - (halfWidth - 1.) - fraction;
+                const double x        = cutoff * distance;
+                const double sinc     = (std::abs(x) < 1e-9) ? 1. : std::sin(pi * x) / (pi * x);
+                const double edge     = std::min(std::abs(distance) / halfWidth, 1.);
+                const double window   = besselI0(settings.beta * std::sqrt(1. - edge * edge)) / norm;
+                const double value    = cutoff * sinc * window;
+
+                coefficients[phase * taps + tap] = static_cast<float>(value);
+                sum += value;
+            }
+
+            // Normalize each phase for unity gain at DC
+            const auto scale = static_cast<float>(1. / sum);
+            for (std::size_t tap = 0; tap < taps; ++tap)
+                coefficients[phase * taps + tap] *= scale;
+        }
+
+        kernel.resize(taps);
+        history.resize(channelCount);
+        channelPointers.resize(channelCount);
+        reset();
+    }
+
+    void reset()
+    {
+        // Start with silence before the first sample so that the filter can be centered on it
+        for (auto& channel : history)
+            channel.assign(taps / 2 - 1, 0.f);
+
+        inputFrameCount     = 0;
+        outputFrameCount    = 0;
+        discardedFrameCount = 0;
+    }
+
+    void append(const float* samples, std::size_t frameCount)
+    {
+        const std::size_t oldSize = history[0].size();
+
+        for (unsigned int channel = 0; channel < channelCount; ++channel)
+        {
+            history[channel].resize(oldSize + frameCount);
+            channelPointers[channel] = history[channel].data() + oldSize;
+        }
+
+        // A null pointer appends silence
+        if (samples)
+        {
+            priv::SampleConversion::deinterleave(samples, frameCount, channelCount, channelPointers.data());
+        }
+        else
+        {
+            for (auto& channel : history)
+                std::fill(channel.begin() + static_cast<std::ptrdiff_t>(oldSize), channel.end(), 0.f);
+        }
+    }
+
+    void produce(std::vector<std::int16_t>& output, std::uint64_t maxOutputFrameCount)
+    {
+        const std::size_t available = history[0].size();
+        block.clear();
+
+        while (outputFrameCount < maxOutputFrameCount)
+        {
+            // Exact position of the output sample in the input, as an integer part and a fraction
+            const std::uint64_t position = outputFrameCount * inputSampleRate;
+            const auto          first    = static_cast<std::size_t>(position / outputSampleRate - discardedFrameCount);
+
+            if (first + taps > available)
+                break;
+
+            const float fraction      = static_cast<float>(position % outputSampleRate) / static_cast<float>(outputSampleRate);
+            const float phasePosition = fraction * static_cast<float>(phases);
+            const auto  phase         = std::min(static_cast<std::size_t>(phasePosition), phases - 1);
+            const float weight        = phasePosition - static_cast<float>(phase);
+
+            // Interpolate the filter between the two nearest precomputed phases
+            const float* const current = coefficients.data() + phase * taps;
+            const float* const next    = current + taps;
+
+            for (std::size_t tap = 0; tap < taps; ++tap)
+                kernel[tap] = current[tap] + weight * (next[tap] - current[tap]);
+
+            for (unsigned int channel = 0; channel < channelCount; ++channel)
+                block.push_back(priv::SampleConversion::dotProduct(history[channel].data() + first, kernel.data(), taps));
+
+            ++outputFrameCount;
+        }
+
+        const std::size_t oldSize = output.size();
+        output.resize(oldSize + block.size());
+        priv::SampleConversion::toInt16(block.data(), output.data() + oldSize, block.size());
+
+        // Drop the input samples that won't be used anymore
+        const auto consumed = static_cast<std::size_t>(
+            std::min<std::uint64_t>(outputFrameCount * inputSampleRate / outputSampleRate - discardedFrameCount, available));
+
+        for (auto& channel : history)
+            channel.erase(channel.begin(), channel.begin() + static_cast<std::ptrdiff_t>(consumed));
+
+        discardedFrameCount += consumed;
+    }
+
+    unsigned int                    inputSampleRate;       //!< Sample rate of the input samples
+    unsigned int                    outputSampleRate;      //!< Sample rate of the output samples
+    unsigned int                    channelCount;          //!< Number of interleaved channels
+    Quality                         quality;               //!< Quality of the conversion
+    std::size_t                     taps{};                //!< Number of taps of the filter
+    std::size_t                     phases{};              //!< Number of precomputed fractional positions
+    std::vector<float>              coefficients;          //!< Filter coefficients, one set of taps per phase
+    std::vector<float>              kernel;                //!< Filter interpolated for the current output sample
+    std::vector<std::vector<float>> history;               //!< Input samples of each channel that are still needed
+    std::vector<float*>             channelPointers;       //!< Destination of each channel when appending samples
+    std::vector<float>              block;                 //!< Scratch buffer for interleaved floating point samples
+    std::uint64_t                   inputFrameCount{};     //!< Number of frames received since the last reset
+    std::uint64_t                   outputFrameCount{};    //!< Number of frames produced since the last reset
+    std::uint64_t                   discardedFrameCount{}; //!< Number of input frames dropped from the history
+};
+
+
+////////////////////////////////////////////////////////////
+Resampler::Resampler(unsigned int inputSampleRate, unsigned int outputSampleRate, unsigned int channelCount, Quality quality)
+{
+    assert(inputSampleRate > 0 && outputSampleRate > 0 && "Sample rates must be greater than 0");
+    assert(channelCount > 0 && "Channel count must be greater than 0");
+
+    m_impl = std::make_unique<Impl>(inputSampleRate, outputSampleRate, channelCount, quality);
+}
+
+
+////////////////////////////////////////////////////////////
+Resampler::~Resampler() = default;
+
+
+////////////////////////////////////////////////////////////
+Resampler::Resampler(const Resampler& copy) :
+m_impl(copy.m_impl ? std::make_unique<Impl>(*copy.m_impl) : nullptr)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+Resampler& Resampler::operator=(const Resampler& right)
+{
+    Resampler temp(right);
+    std::swap(m_impl, temp.m_impl);
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+Resampler::Resampler(Resampler&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+Resampler& Resampler::operator=(Resampler&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+void Resampler::process(const std::int16_t* samples, std::uint64_t frameCount, std::vector<std::int16_t>& output)
+{
+    if (!samples || frameCount == 0)
+        return;
+
+    const auto sampleCount = static_cast<std::size_t>(frameCount * m_impl->channelCount);
+
+    m_impl->block.resize(sampleCount);
+    priv::SampleConversion::toFloat(samples, m_impl->block.data(), sampleCount);
+
+    m_impl->append(m_impl->block.data(), static_cast<std::size_t>(frameCount));
+    m_impl->inputFrameCount += frameCount;
+
+    m_impl->produce(output, std::numeric_limits<std::uint64_t>::max());
+}
+
+
+////////////////////////////////////////////////////////////
+void Resampler::flush(std::vector<std::int16_t>& output)
+{
+    // Pad with enough silence to center the filter on every remaining output sample
+    const std::uint64_t totalFrameCount = (m_impl->inputFrameCount * m_impl->outputSampleRate +
+                                           m_impl->inputSampleRate - 1) /
+                                          m_impl->inputSampleRate;
+
+    m_impl->append(nullptr, m_impl->taps);
+    m_impl->produce(output, totalFrameCount);
+    m_impl->reset();
+}
+
+
+////////////////////////////////////////////////////////////
+void Resampler::reset()
+{
+    m_impl->reset();
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int Resampler::getInputSampleRate() const
+{
+    return m_impl->inputSampleRate;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int Resampler::getOutputSampleRate() const
+{
+    return m_impl->outputSampleRate;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int Resampler::getChannelCount() const
+{
+    return m_impl->channelCount;
+}
+
+
+////////////////////////////////////////////////////////////
+Resampler::Quality Resampler::getQuality() const
+{
+    return m_impl->quality;
+}
+
+} // namespace sf
@@ -0,0 +1,155 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/SampleConversion.hpp>
+
+#include <algorithm>
+
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define SFML_SAMPLE_CONVERSION_SSE2
+#include <emmintrin.h>
+#endif
+
+
+namespace sf::priv::SampleConversion
+{
+////////////////////////////////////////////////////////////
+void toFloat(const std::int16_t* input, float* output, std::size_t count)
+{
+    constexpr float scale = 1.f / 32768.f;
+    std::size_t     i     = 0;
+
+#ifdef SFML_SAMPLE_CONVERSION_SSE2
+    const __m128 scaleVector = _mm_set1_ps(scale);
+
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m128i samples = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+
+        // Sign-extend to 32-bit by moving each sample to the upper half and shifting it back
+        const __m128i low  = _mm_srai_epi32(_mm_unpacklo_epi16(samples, samples), 16);
+        const __m128i high = _mm_srai_epi32(_mm_unpackhi_epi16(samples, samples), 16);
+
+        _mm_storeu_ps(output + i, _mm_mul_ps(_mm_cvtepi32_ps(low), scaleVector));
+        _mm_storeu_ps(output + i + 4, _mm_mul_ps(_mm_cvtepi32_ps(high), scaleVector));
+    }
+#endif
+
+    for (; i < count; ++i)
+        output[i] = static_cast<float>(input[i]) * scale;
+}
+
+
+////////////////////////////////////////////////////////////
+void toInt16(const float* input, std::int16_t* output, std::size_t count)
+{
+    std::size_t i = 0;
+
+#ifdef SFML_SAMPLE_CONVERSION_SSE2
+    const __m128 scaleVector = _mm_set1_ps(32768.f);
+    const __m128 minimum     = _mm_set1_ps(-32768.f);
+    const __m128 maximum     = _mm_set1_ps(32767.f);
+
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m128 low  = _mm_mul_ps(_mm_loadu_ps(input + i), scaleVector);
+        const __m128 high = _mm_mul_ps(_mm_loadu_ps(input + i + 4), scaleVector);
+
+        // Clamp before converting, out of range values would otherwise become the integer indefinite value
+        const __m128i lowIntegers  = _mm_cvtps_epi32(_mm_min_ps(_mm_max_ps(low, minimum), maximum));
+        const __m128i highIntegers = _mm_cvtps_epi32(_mm_min_ps(_mm_max_ps(high, minimum), maximum));
+        const __m128i samples      = _mm_packs_epi32(lowIntegers, highIntegers);
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), samples);
+    }
+#endif
+
+    for (; i < count; ++i)
+        output[i] = static_cast<std::int16_t>(std::clamp(std::nearbyint(input[i] * 32768.f), -32768.f, 32767.f));
+}
+
+
+////////////////////////////////////////////////////////////
+void deinterleave(const float* input, std::size_t frameCount, unsigned int channelCount, float* const* outputs)
+{
+    if (channelCount == 1)
+    {
+        std::copy(input, input + frameCount, outputs[0]);
+        return;
+    }
+
+    std::size_t frame = 0;
+
+#ifdef SFML_SAMPLE_CONVERSION_SSE2
+    if (channelCount == 2)
+    {
+        for (; frame + 4 <= frameCount; frame += 4)
+        {
+            const __m128 first  = _mm_loadu_ps(input + frame * 2);
+            const __m128 second = _mm_loadu_ps(input + frame * 2 + 4);
+
+            _mm_storeu_ps(outputs[0] + frame, _mm_shuffle_ps(first, second, _MM_SHUFFLE(2, 0, 2, 0)));
+            _mm_storeu_ps(outputs[1] + frame, _mm_shuffle_ps(first, second, _MM_SHUFFLE(3, 1, 3, 1)));
+        }
+    }
+#endif
+
+    for (; frame < frameCount; ++frame)
+    {
+        for (unsigned int channel = 0; channel < channelCount; ++channel)
+            outputs[channel][frame] = input[frame * channelCount + channel];
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+float dotProduct(const float* lhs, const float* rhs, std::size_t count)
+{
+    float       sum = 0.f;
+    std::size_t i   = 0;
+
+#ifdef SFML_SAMPLE_CONVERSION_SSE2
+    __m128 sumVector = _mm_setzero_ps();
+
+    for (; i + 4 <= count; i += 4)
+        sumVector = _mm_add_ps(sumVector, _mm_mul_ps(_mm_loadu_ps(lhs + i), _mm_loadu_ps(rhs + i)));
+
+    float sums[4];
+    _mm_storeu_ps(sums, sumVector);
+    sum = (sums[0] + sums[1]) + (sums[2] + sums[3]);
+#endif
+
+    for (; i < count; ++i)
+        sum += lhs[i] * rhs[i];
+
+    return sum;
+}
+
+} // namespace sf::priv::SampleConversion
@@ -0,0 +1,83 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf::priv::SampleConversion
+{
+////////////////////////////////////////////////////////////
+/// \brief Convert 16-bit samples to floating point samples in range [-1, 1)
+///
+/// \param input  Samples to convert
+/// \param output Array receiving the converted samples
+/// \param count  Number of samples
+///
+////////////////////////////////////////////////////////////
+void toFloat(const std::int16_t* input, float* output, std::size_t count);
+
+////////////////////////////////////////////////////////////
+/// \brief Convert floating point samples to 16-bit samples
+///
+/// Samples are rounded to the nearest value and clamped to
+/// the range of 16-bit integers.
+///
+/// \param input  Samples to convert
+/// \param output Array receiving the converted samples
+/// \param count  Number of samples
+///
+////////////////////////////////////////////////////////////
+void toInt16(const float* input, std::int16_t* output, std::size_t count);
+
+////////////////////////////////////////////////////////////
+/// \brief Split interleaved samples into one array per channel
+///
+/// \param input        Interleaved samples
+/// \param frameCount   Number of frames
+/// \param channelCount Number of channels
+/// \param outputs      Array of `channelCount` arrays receiving the samples of each channel
+///
+////////////////////////////////////////////////////////////
+void deinterleave(const float* input, std::size_t frameCount, unsigned int channelCount, float* const* outputs);
+
+////////////////////////////////////////////////////////////
+/// \brief Compute the dot product of two arrays
+///
+/// \param lhs   First array
+/// \param rhs   Second array
+/// \param count Number of elements of each array
+///
+/// \return Sum of the products of the elements
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] float dotProduct(const float* lhs, const float* rhs, std::size_t count);
+
+} // namespace sf::priv::SampleConversion
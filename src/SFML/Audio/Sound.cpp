@@ -91,11 +91,16 @@ struct Sound::Impl : priv::MiniaudioUtils::SoundBase
         if (buffer == nullptr)
             return MA_NO_DATA_AVAILABLE;
 
+        // Check the loading state first, once it is cleared the decoded sample count no longer changes
+        const bool          loading      = buffer->isLoading();
+        const std::uint64_t decoded      = buffer->getDecodedSampleCount();
+        const unsigned int  channelCount = buffer->getChannelCount();
+
         // Determine how many frames we can read
-        *framesRead = std::min(frameCount, (buffer->getSampleCount() - impl.cursor) / buffer->getChannelCount());
+        *framesRead = std::min(frameCount, (decoded - std::min<std::uint64_t>(impl.cursor, decoded)) / channelCount);
 
         // Copy the samples to the output
-        const auto sampleCount = *framesRead * buffer->getChannelCount();
+        const auto sampleCount = *framesRead * channelCount;
 
         std::memcpy(framesOut,
                     buffer->getSamples() + impl.cursor,
@@ -103,8 +108,20 @@ struct Sound::Impl : priv::MiniaudioUtils::SoundBase
 
         impl.cursor += static_cast<std::size_t>(sampleCount);
 
+        // If playback overtook a progressive load, pad with silence instead of ending the sound
+        if (loading && (*framesRead < frameCount))
+        {
+            std::memset(static_cast<std::int16_t*>(framesOut) + sampleCount,
+                        0,
+                        static_cast<std::size_t>((frameCount - *framesRead) * channelCount) * sizeof(std::int16_t));
+
+            *framesRead = frameCount;
+            buffer->notifyUnderrun();
+        }
+
         // If we are looping and at the end of the sound, set the cursor back to the start
-        if (impl.looping && (impl.cursor >= buffer->getSampleCount()))
+        // (once loading is over, only the decoded samples are playable since decoding may have failed partway)
+        if (impl.looping && (impl.cursor >= (loading ? buffer->getSampleCount() : decoded)))
             impl.cursor = 0;
 
         return MA_SUCCESS;
@@ -216,6 +233,10 @@ Sound::~Sound()
 ////////////////////////////////////////////////////////////
 void Sound::play()
 {
+    // Once a scheduled stop has been reached, playing again restarts from the beginning
+    if (priv::MiniaudioUtils::isScheduledStopReached(m_impl->sound))
+        stop();
+
     if (m_impl->status == Status::Playing)
         setPlayingOffset(Time::Zero);
 
@@ -239,6 +260,8 @@ void Sound::pause()
     }
     else
     {
+        priv::MiniaudioUtils::clearSchedule(m_impl->sound);
+
         if (m_impl->status == Status::Playing)
             m_impl->status = Status::Paused;
     }
@@ -254,6 +277,7 @@ void Sound::stop()
     }
     else
     {
+        priv::MiniaudioUtils::clearSchedule(m_impl->sound);
         setPlayingOffset(Time::Zero);
         m_impl->status = Status::Stopped;
     }
@@ -338,6 +362,9 @@ Time Sound::getPlayingOffset() const
 ////////////////////////////////////////////////////////////
 Sound::Status Sound::getStatus() const
 {
+    if ((m_impl->status == Status::Playing) && priv::MiniaudioUtils::isScheduledStopReached(m_impl->sound))
+        return Status::Stopped;
+
     return m_impl->status;
 }
 
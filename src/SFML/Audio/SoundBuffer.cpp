@@ -33,13 +33,65 @@
 #include <SFML/System/Err.hpp>
 #include <SFML/System/Exception.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <exception>
 #include <ostream>
+#include <thread>
 #include <utility>
 
 
 namespace sf
 {
+struct SoundBuffer::ProgressiveLoader
+{
+    ~ProgressiveLoader()
+    {
+        cancel = true;
+
+        if (thread.joinable())
+            thread.join();
+    }
+
+    void decode()
+    {
+        // Decode in small chunks so that the first samples become available as soon as possible
+        constexpr std::uint64_t chunkSize = 16384;
+        std::uint64_t           decoded   = 0;
+
+        while (!cancel && (decoded < sampleCount))
+        {
+            const std::uint64_t count = file.read(samples + decoded, std::min(chunkSize, sampleCount - decoded));
+
+            if (count == 0)
+            {
+                err() << "Failed to decode sound buffer (" << decoded << " of " << sampleCount << " samples decoded)"
+                      << std::endl;
+                break;
+            }
+
+            decoded += count;
+            decodedSampleCount.store(decoded, std::memory_order_release);
+        }
+
+        loading.store(false, std::memory_order_release);
+    }
+
+    InputSoundFile             file;                 //!< File being decoded
+    std::int16_t*              samples{};            //!< Destination of the decoded samples
+    std::uint64_t              sampleCount{};        //!< Total number of samples to decode
+    std::atomic<std::uint64_t> decodedSampleCount{}; //!< Number of samples decoded so far
+    std::atomic<std::uint64_t> underrunCount{};      //!< Number of times playback overtook the decoder
+    std::atomic<bool>          loading{true};        //!< `true` until the decoder thread has finished
+    std::atomic<bool>          cancel{};             //!< Set to stop the decoder thread early
+    std::thread                thread;               //!< Decoder thread
+};
+
+
+////////////////////////////////////////////////////////////
+SoundBuffer::SoundBuffer() = default;
+
+
 ////////////////////////////////////////////////////////////
 SoundBuffer::SoundBuffer(const std::filesystem::path& filename)
 {
@@ -79,8 +131,13 @@ SoundBuffer::SoundBuffer(const std::int16_t*              samples,
 ////////////////////////////////////////////////////////////
 SoundBuffer::SoundBuffer(const SoundBuffer& copy)
 {
+    // A buffer that is still being decoded is only copied once complete; if decoding
+    // failed partway, only the decoded samples are copied and the source is left as is
+    copy.waitForDecoder();
+    const auto sampleCount = static_cast<std::ptrdiff_t>(copy.getDecodedSampleCount());
+
     // don't copy the attached sounds
-    m_samples  = copy.m_samples;
+    m_samples.assign(copy.m_samples.begin(), copy.m_samples.begin() + sampleCount);
     m_duration = copy.m_duration;
 
     // Update the internal buffer with the new samples
@@ -101,6 +158,9 @@ SoundBuffer::~SoundBuffer()
     // Detach the buffer from the sounds that use it
     for (Sound* soundPtr : sounds)
         soundPtr->detachBuffer();
+
+    // No sound can read the loader state anymore, it is now safe to stop the decoder
+    cancelLoading();
 }
 
 
@@ -149,11 +209,16 @@ bool SoundBuffer::loadFromSamples(const std::int16_t*              samples,
 {
     if (samples && sampleCount && channelCount && sampleRate && !channelMap.empty())
     {
+        const SoundList sounds = detachSounds();
+        cancelLoading();
+
         // Copy the new audio samples
         m_samples.assign(samples, samples + sampleCount);
 
         // Update the internal buffer with the new samples
-        return update(channelCount, sampleRate, channelMap);
+        const bool result = update(channelCount, sampleRate, channelMap);
+        reattachSounds(sounds);
+        return result;
     }
 
     // Error...
@@ -167,15 +232,60 @@ bool SoundBuffer::loadFromSamples(const std::int16_t*              samples,
 }
 
 
+////////////////////////////////////////////////////////////
+bool SoundBuffer::loadFromFileProgressive(const std::filesystem::path& filename)
+{
+    auto loader = std::make_unique<ProgressiveLoader>();
+
+    if (!loader->file.openFromFile(filename))
+    {
+        err() << "Failed to open sound buffer from file" << std::endl;
+        return false;
+    }
+
+    // The sounds must stop reading the samples and the loader state before both are replaced
+    const SoundList sounds = detachSounds();
+    cancelLoading();
+
+    // Allocate the whole buffer up front, the decoder thread fills it in place
+    m_samples.assign(static_cast<std::size_t>(loader->file.getSampleCount()), 0);
+    loader->samples     = m_samples.data();
+    loader->sampleCount = m_samples.size();
+
+    const unsigned int              channelCount = loader->file.getChannelCount();
+    const unsigned int              sampleRate   = loader->file.getSampleRate();
+    const std::vector<SoundChannel> channelMap   = loader->file.getChannelMap();
+
+    // The loader must be in place before the sounds are reattached
+    m_loader = std::move(loader);
+
+    if (!update(channelCount, sampleRate, channelMap))
+    {
+        m_loader.reset();
+        reattachSounds(sounds);
+        err() << "Failed to initialize sound buffer (internal update failure)" << std::endl;
+        return false;
+    }
+
+    reattachSounds(sounds);
+
+    m_loader->thread = std::thread(&ProgressiveLoader::decode, m_loader.get());
+    return true;
+}
+
+
 ////////////////////////////////////////////////////////////
 bool SoundBuffer::saveToFile(const std::filesystem::path& filename) const
 {
+    // Wait for the decoder, then only write the samples that could be decoded
+    waitForDecoder();
+
     // Create the sound file in write mode
     OutputSoundFile file;
     if (file.openFromFile(filename, getSampleRate(), getChannelCount(), getChannelMap()))
     {
         // Write the samples to the opened file
-        file.write(m_samples.data(), m_samples.size());
+        file.write(m_samples.data(), getDecodedSampleCount());
 
         return true;
     }
@@ -184,6 +294,33 @@ bool SoundBuffer::saveToFile(const std::filesystem::path& filename) const
 }
 
 
+////////////////////////////////////////////////////////////
+bool SoundBuffer::resample(unsigned int sampleRate, Resampler::Quality quality)
+{
+    finishLoading();
+
+    if (sampleRate == 0)
+    {
+        err() << "Failed to resample sound buffer (invalid sample rate)" << std::endl;
+        return false;
+    }
+
+    if (m_samples.empty() || sampleRate == getSampleRate())
+        return true;
+
+    const unsigned int channelCount = getChannelCount();
+
+    Resampler                 resampler(getSampleRate(), sampleRate, channelCount, quality);
+    std::vector<std::int16_t> samples;
+    samples.reserve(static_cast<std::size_t>(m_samples.size() * sampleRate / getSampleRate() + channelCount));
+
+    resampler.process(m_samples.data(), m_samples.size() / channelCount, samples);
+    resampler.flush(samples);
+
+    return loadFromSamples(samples.data(), samples.size(), channelCount, sampleRate, getChannelMap());
+}
+
+
 ////////////////////////////////////////////////////////////
 const std::int16_t* SoundBuffer::getSamples() const
 {
@@ -198,6 +335,30 @@ std::uint64_t SoundBuffer::getSampleCount() const
 }
 
 
+////////////////////////////////////////////////////////////
+std::uint64_t SoundBuffer::getDecodedSampleCount() const
+{
+    if (m_loader)
+        return m_loader->decodedSampleCount.load(std::memory_order_acquire);
+
+    return m_samples.size();
+}
+
+
+////////////////////////////////////////////////////////////
+bool SoundBuffer::isLoading() const
+{
+    return m_loader && m_loader->loading.load(std::memory_order_acquire);
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint64_t SoundBuffer::getUnderrunCount() const
+{
+    return m_loader ? m_loader->underrunCount.load(std::memory_order_relaxed) : 0;
+}
+
+
 ////////////////////////////////////////////////////////////
 unsigned int SoundBuffer::getSampleRate() const
 {
@@ -231,11 +392,15 @@ SoundBuffer& SoundBuffer::operator=(const SoundBuffer& right)
 {
     SoundBuffer temp(right);
 
+    // The sounds must stop reading the samples and the loader state before both are swapped;
+    // they are not reattached, a sound doesn't keep playing a buffer that is assigned to
+    [[maybe_unused]] const SoundList sounds = detachSounds();
+
     std::swap(m_samples, temp.m_samples);
     std::swap(m_sampleRate, temp.m_sampleRate);
     std::swap(m_channelMap, temp.m_channelMap);
     std::swap(m_duration, temp.m_duration);
-    std::swap(m_sounds, temp.m_sounds); // swap sounds too, so that they are detached when temp is destroyed
+    std::swap(m_loader, temp.m_loader); // swap the loader too, so that a pending load is cancelled when temp is destroyed
 
     return *this;
 }
@@ -244,24 +409,26 @@ SoundBuffer& SoundBuffer::operator=(const SoundBuffer& right)
 ////////////////////////////////////////////////////////////
 bool SoundBuffer::initialize(InputSoundFile& file)
 {
+    // The sounds must stop reading the samples and the loader state before both are replaced
+    const SoundList sounds = detachSounds();
+    cancelLoading();
+
     // Retrieve the sound parameters
     const std::uint64_t sampleCount = file.getSampleCount();
 
     // Read the samples from the provided file
     m_samples.resize(static_cast<std::size_t>(sampleCount));
-    if (file.read(m_samples.data(), sampleCount) == sampleCount)
-    {
-        // Update the internal buffer with the new samples
-        if (!update(file.getChannelCount(), file.getSampleRate(), file.getChannelMap()))
-        {
-            err() << "Failed to initialize sound buffer (internal update failure)" << std::endl;
-            return false;
-        }
+    bool result = file.read(m_samples.data(), sampleCount) == sampleCount;
 
-        return true;
+    // Update the internal buffer with the new samples
+    if (result && !update(file.getChannelCount(), file.getSampleRate(), file.getChannelMap()))
+    {
+        err() << "Failed to initialize sound buffer (internal update failure)" << std::endl;
+        result = false;
     }
 
-    return false;
+    reattachSounds(sounds);
+    return result;
 }
 
 
@@ -275,6 +442,17 @@ bool SoundBuffer::update(unsigned int channelCount, unsigned int sampleRate, con
     m_sampleRate = sampleRate;
     m_channelMap = channelMap;
 
+    // Compute the duration
+    m_duration = seconds(
+        static_cast<float>(m_samples.size()) / static_cast<float>(sampleRate) / static_cast<float>(channelCount));
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+SoundBuffer::SoundList SoundBuffer::detachSounds()
+{
     // First make a copy of the list of sounds so we can reattach later
     const SoundList sounds(m_sounds);
 
@@ -282,15 +460,64 @@ bool SoundBuffer::update(unsigned int channelCount, unsigned int sampleRate, con
     for (Sound* soundPtr : sounds)
         soundPtr->detachBuffer();
 
-    // Compute the duration
-    m_duration = seconds(
-        static_cast<float>(m_samples.size()) / static_cast<float>(sampleRate) / static_cast<float>(channelCount));
+    return sounds;
+}
+
 
-    // Now reattach the buffer to the sounds that use it
+////////////////////////////////////////////////////////////
+void SoundBuffer::reattachSounds(const SoundList& sounds)
+{
     for (Sound* soundPtr : sounds)
         soundPtr->setBuffer(*this);
+}
 
-    return true;
+
+////////////////////////////////////////////////////////////
+void SoundBuffer::cancelLoading()
+{
+    // The loader destructor stops and joins the decoder thread
+    m_loader.reset();
+}
+
+
+////////////////////////////////////////////////////////////
+void SoundBuffer::waitForDecoder() const
+{
+    if (m_loader && m_loader->thread.joinable())
+        m_loader->thread.join();
+}
+
+
+////////////////////////////////////////////////////////////
+void SoundBuffer::finishLoading()
+{
+    if (!m_loader)
+        return;
+
+    // The decoder may already have been joined by a const function, which left the samples untouched
+    waitForDecoder();
+
+    // If decoding failed partway, only keep the samples that could be decoded
+    const auto decoded = static_cast<std::size_t>(m_loader->decodedSampleCount.load(std::memory_order_acquire));
+    if (decoded < m_samples.size())
+    {
+        const SoundList sounds = detachSounds();
+        m_loader.reset();
+        m_samples.resize(decoded);
+
+        if (!update(getChannelCount(), getSampleRate(), getChannelMap()))
+            err() << "Failed to update partially decoded sound buffer" << std::endl;
+
+        reattachSounds(sounds);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void SoundBuffer::notifyUnderrun() const
+{
+    if (m_loader)
+        m_loader->underrunCount.fetch_add(1, std::memory_order_relaxed);
 }
 
 
@@ -0,0 +1,389 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/SoundBuffer.hpp>
+#include <SFML/Audio/SoundBufferCache.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <cstdint>
+
+
+namespace
+{
+////////////////////////////////////////////////////////////
+std::filesystem::path normalizePath(const std::filesystem::path& filename)
+{
+    // Make sure that different spellings of the same path share a cache entry
+    std::error_code       errorCode;
+    std::filesystem::path absolutePath = std::filesystem::absolute(filename, errorCode);
+
+    return errorCode ? filename.lexically_normal() : absolutePath.lexically_normal();
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+bool isReady(const std::shared_future<T>& future)
+{
+    return future.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+}
+} // namespace
+
+
+namespace sf
+{
+struct SoundBufferCache::Impl
+{
+    using Key = std::variant<std::filesystem::path, const InputStream*>;
+
+    struct Entry
+    {
+        Handle        handle;    //!< Handle to the buffer, which may still be loading
+        std::uint64_t lastUse{}; //!< Value of the use counter the last time the entry was accessed
+    };
+
+    struct Job
+    {
+        std::filesystem::path                            filename; //!< Path of the file to load
+        std::promise<std::shared_ptr<const SoundBuffer>> promise;  //!< Promise fulfilled when the load has finished
+    };
+
+    Impl(std::size_t budget, unsigned int workerCount) : memoryBudget(budget)
+    {
+        workerCount = std::max(workerCount, 1u);
+
+        for (unsigned int i = 0; i < workerCount; ++i)
+            workers.emplace_back(&Impl::work, this);
+    }
+
+    ~Impl()
+    {
+        {
+            const std::lock_guard lock(mutex);
+            stopping = true;
+        }
+
+        condition.notify_all();
+
+        for (auto& worker : workers)
+            worker.join();
+
+        // Cancel the jobs that were never started
+        for (auto& job : jobs)
+            job.promise.set_value(nullptr);
+    }
+
+    void work()
+    {
+        for (;;)
+        {
+            Job job;
+
+            {
+                std::unique_lock lock(mutex);
+                condition.wait(lock, [this] { return stopping || !jobs.empty(); });
+
+                if (stopping)
+                    return;
+
+                job = std::move(jobs.front());
+                jobs.pop_front();
+            }
+
+            // Decode the file outside of the lock so that other threads can keep using the cache
+            auto buffer = std::make_shared<SoundBuffer>();
+
+            if (buffer->loadFromFile(job.filename))
+                job.promise.set_value(std::move(buffer));
+            else
+                job.promise.set_value(nullptr);
+        }
+    }
+
+    [[nodiscard]] std::shared_ptr<const SoundBuffer> find(const Key& key)
+    {
+        std::unique_lock lock(mutex);
+
+        const auto iter = entries.find(key);
+
+        if (iter == entries.end())
+            return nullptr;
+
+        iter->second.lastUse = ++useCounter;
+        const Handle handle  = iter->second.handle;
+
+        // Wait for a pending asynchronous load without blocking the other users of the cache
+        lock.unlock();
+        return handle.get();
+    }
+
+    [[nodiscard]] std::shared_ptr<const SoundBuffer> insert(Key key, std::shared_ptr<const SoundBuffer> buffer)
+    {
+        const std::lock_guard lock(mutex);
+
+        // Another thread may have loaded the same buffer in the meantime
+        const auto iter = entries.find(key);
+
+        if (iter != entries.end() && isReady(iter->second.handle) && iter->second.handle.get())
+        {
+            iter->second.lastUse = ++useCounter;
+            return iter->second.handle.get();
+        }
+
+        std::promise<std::shared_ptr<const SoundBuffer>> promise;
+        promise.set_value(buffer);
+        entries.insert_or_assign(std::move(key), Entry{promise.get_future().share(), ++useCounter});
+
+        trim();
+        return buffer;
+    }
+
+    [[nodiscard]] static std::size_t getSize(const Entry& entry)
+    {
+        if (!isReady(entry.handle) || !entry.handle.get())
+            return 0;
+
+        return static_cast<std::size_t>(entry.handle.get()->getSampleCount()) * sizeof(std::int16_t);
+    }
+
+    [[nodiscard]] static bool isUnused(const Entry& entry)
+    {
+        if (!isReady(entry.handle))
+            return false;
+
+        // The copy stored in the shared state is the only remaining reference
+        const auto& buffer = entry.handle.get();
+        return buffer && (buffer.use_count() == 1) && buffer->m_sounds.empty();
+    }
+
+    [[nodiscard]] std::size_t getMemoryUsage() const
+    {
+        std::size_t usage = 0;
+
+        for (const auto& [key, entry] : entries)
+            usage += getSize(entry);
+
+        return usage;
+    }
+
+    void trim()
+    {
+        // Forget about failed loads so that they can be retried
+        for (auto iter = entries.begin(); iter != entries.end();)
+        {
+            if (isReady(iter->second.handle) && !iter->second.handle.get())
+                iter = entries.erase(iter);
+            else
+                ++iter;
+        }
+
+        // Evict unused buffers in least recently used order until we fit in the budget
+        std::size_t usage = getMemoryUsage();
+
+        while (usage > memoryBudget)
+        {
+            auto leastRecentlyUsed = entries.end();
+
+            for (auto iter = entries.begin(); iter != entries.end(); ++iter)
+            {
+                if (isUnused(iter->second) &&
+                    (leastRecentlyUsed == entries.end() || iter->second.lastUse < leastRecentlyUsed->second.lastUse))
+                    leastRecentlyUsed = iter;
+            }
+
+            if (leastRecentlyUsed == entries.end())
+                break;
+
+            usage -= getSize(leastRecentlyUsed->second);
+            entries.erase(leastRecentlyUsed);
+        }
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::size_t              memoryBudget; //!< Maximum memory occupied by cached buffers, in bytes
+    std::uint64_t            useCounter{}; //!< Monotonic counter used to order entries by last use
+    std::map<Key, Entry>     entries;      //!< Cached entries
+    std::deque<Job>          jobs;         //!< Pending asynchronous loads
+    bool                     stopping{};   //!< `true` when the workers have to terminate
+    mutable std::mutex       mutex;        //!< Mutex protecting the entries and the jobs
+    std::condition_variable  condition;    //!< Condition used to wake up the workers
+    std::vector<std::thread> workers;      //!< Worker threads performing asynchronous loads
+};
+
+
+////////////////////////////////////////////////////////////
+SoundBufferCache::SoundBufferCache(std::size_t memoryBudget, unsigned int workerCount) :
+m_impl(std::make_unique<Impl>(memoryBudget, workerCount))
+{
+}
+
+
+////////////////////////////////////////////////////////////
+SoundBufferCache::~SoundBufferCache() = default;
+
+
+////////////////////////////////////////////////////////////
+std::shared_ptr<const SoundBuffer> SoundBufferCache::load(const std::filesystem::path& filename)
+{
+    auto key = normalizePath(filename);
+
+    if (auto buffer = m_impl->find(key))
+        return buffer;
+
+    auto buffer = std::make_shared<SoundBuffer>();
+
+    if (!buffer->loadFromFile(filename))
+        return nullptr;
+
+    return m_impl->insert(std::move(key), std::move(buffer));
+}
+
+
+////////////////////////////////////////////////////////////
+std::shared_ptr<const SoundBuffer> SoundBufferCache::load(InputStream& stream)
+{
+    const Impl::Key key = &stream;
+
+    if (auto buffer = m_impl->find(key))
+        return buffer;
+
+    auto buffer = std::make_shared<SoundBuffer>();
+
+    if (!buffer->loadFromStream(stream))
+        return nullptr;
+
+    return m_impl->insert(key, std::move(buffer));
+}
+
+
+////////////////////////////////////////////////////////////
+SoundBufferCache::Handle SoundBufferCache::loadAsync(const std::filesystem::path& filename)
+{
+    auto key = normalizePath(filename);
+
+    Handle handle;
+
+    {
+        const std::lock_guard lock(m_impl->mutex);
+
+        m_impl->trim();
+
+        if (const auto iter = m_impl->entries.find(key); iter != m_impl->entries.end())
+        {
+            iter->second.lastUse = ++m_impl->useCounter;
+            return iter->second.handle;
+        }
+
+        Impl::Job job{filename, {}};
+        handle = job.promise.get_future().share();
+
+        m_impl->entries.emplace(std::move(key), Impl::Entry{handle, ++m_impl->useCounter});
+        m_impl->jobs.push_back(std::move(job));
+    }
+
+    m_impl->condition.notify_one();
+    return handle;
+}
+
+
+////////////////////////////////////////////////////////////
+void SoundBufferCache::remove(const std::filesystem::path& filename)
+{
+    const std::lock_guard lock(m_impl->mutex);
+    m_impl->entries.erase(normalizePath(filename));
+}
+
+
+////////////////////////////////////////////////////////////
+void SoundBufferCache::remove(const InputStream& stream)
+{
+    const std::lock_guard lock(m_impl->mutex);
+    m_impl->entries.erase(&stream);
+}
+
+
+////////////////////////////////////////////////////////////
+void SoundBufferCache::clear()
+{
+    const std::lock_guard lock(m_impl->mutex);
+
+    for (auto iter = m_impl->entries.begin(); iter != m_impl->entries.end();)
+    {
+        if (Impl::isUnused(iter->second) || (isReady(iter->second.handle) && !iter->second.handle.get()))
+            iter = m_impl->entries.erase(iter);
+        else
+            ++iter;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void SoundBufferCache::setMemoryBudget(std::size_t memoryBudget)
+{
+    const std::lock_guard lock(m_impl->mutex);
+    m_impl->memoryBudget = memoryBudget;
+    m_impl->trim();
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t SoundBufferCache::getMemoryBudget() const
+{
+    const std::lock_guard lock(m_impl->mutex);
+    return m_impl->memoryBudget;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t SoundBufferCache::getMemoryUsage() const
+{
+    const std::lock_guard lock(m_impl->mutex);
+    return m_impl->getMemoryUsage();
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t SoundBufferCache::getBufferCount() const
+{
+    const std::lock_guard lock(m_impl->mutex);
+    return m_impl->entries.size();
+}
+
+} // namespace sf
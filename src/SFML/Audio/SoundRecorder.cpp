@@ -25,6 +25,7 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include <SFML/Audio/DeviceCache.hpp>
 #include <SFML/Audio/SoundRecorder.hpp>
 
 #include <SFML/System/Err.hpp>
@@ -55,11 +56,23 @@ struct SoundRecorder::Impl
             return false;
 
         // Find the device by its name
-        auto devices = getAvailableDevices();
+        auto       devices    = getAvailableDevices();
+        const auto findDevice = [this, &devices]
+        {
+            return std::find_if(devices.begin(),
+                                devices.end(),
+                                [this](const ma_device_info& info) { return info.name == deviceName; });
+        };
+
+        auto iter = findDevice();
 
-        const auto iter = std::find_if(devices.begin(),
-                                       devices.end(),
-                                       [this](const ma_device_info& info) { return info.name == deviceName; });
+        // The device might have been connected after the list was cached
+        if (iter == devices.end())
+        {
+            priv::DeviceCache::invalidate(ma_device_type_capture);
+            devices = getAvailableDevices();
+            iter    = findDevice();
+        }
 
         if (iter == devices.end())
             return false;
@@ -74,12 +87,13 @@ struct SoundRecorder::Impl
             captureDevice.emplace();
         }
 
-        auto captureDeviceConfig              = ma_device_config_init(ma_device_type_capture);
-        captureDeviceConfig.capture.pDeviceID = &iter->id;
-        captureDeviceConfig.capture.channels  = channelCount;
-        captureDeviceConfig.capture.format    = ma_format_s16;
-        captureDeviceConfig.sampleRate        = sampleRate;
-        captureDeviceConfig.pUserData         = this;
+        auto captureDeviceConfig                 = ma_device_config_init(ma_device_type_capture);
+        captureDeviceConfig.capture.pDeviceID    = &iter->id;
+        captureDeviceConfig.capture.channels     = channelCount;
+        captureDeviceConfig.capture.format       = ma_format_s16;
+        captureDeviceConfig.sampleRate           = sampleRate;
+        captureDeviceConfig.pUserData            = this;
+        captureDeviceConfig.notificationCallback = &priv::DeviceCache::onDeviceNotification;
         captureDeviceConfig.dataCallback = [](ma_device* device, void*, const void* input, std::uint32_t frameCount)
         {
             auto& impl = *static_cast<Impl*>(device->pUserData);
@@ -112,36 +126,7 @@ struct SoundRecorder::Impl
 
     static std::vector<ma_device_info> getAvailableDevices()
     {
-        std::vector<ma_device_info> deviceList;
-
-        // Create the context
-        ma_context context;
-
-        const auto contextConfig = ma_context_config_init();
-
-        if (const auto result = ma_context_init(nullptr, 0, &contextConfig, &context); result != MA_SUCCESS)
-        {
-            err() << "Failed to initialize the audio context: " << ma_result_description(result) << std::endl;
-            return deviceList;
-        }
-
-        // Enumerate the capture devices
-        ma_device_info* deviceInfos = nullptr;
-        std::uint32_t   deviceCount = 0;
-
-        if (const auto result = ma_context_get_devices(&context, nullptr, nullptr, &deviceInfos, &deviceCount);
-            result != MA_SUCCESS)
-        {
-            err() << "Failed to get audio capture devices: " << ma_result_description(result) << std::endl;
-            ma_context_uninit(&context);
-            return deviceList;
-        }
-
-        for (auto i = 0u; i < deviceCount; ++i)
-            deviceList.push_back(deviceInfos[i]);
-
-        ma_context_uninit(&context);
-        return deviceList;
+        return priv::DeviceCache::getDevices(ma_device_type_capture);
     }
 
     ////////////////////////////////////////////////////////////
@@ -361,6 +346,13 @@ std::vector<std::string> SoundRecorder::getAvailableDevices()
 }
 
 
+////////////////////////////////////////////////////////////
+void SoundRecorder::refreshAvailableDevices()
+{
+    priv::DeviceCache::invalidate(ma_device_type_capture);
+}
+
+
 ////////////////////////////////////////////////////////////
 std::string SoundRecorder::getDefaultDevice()
 {
@@ -25,11 +25,14 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include <SFML/Audio/AudioDevice.hpp>
+#include <SFML/Audio/MiniaudioUtils.hpp>
 #include <SFML/Audio/SoundSource.hpp>
 
 #include <miniaudio.h>
 
 #include <algorithm>
+#include <vector>
 
 
 namespace sf
@@ -350,6 +353,58 @@ float SoundSource::getAttenuation() const
 }
 
 
+////////////////////////////////////////////////////////////
+void SoundSource::playAt(Time engineTime)
+{
+    auto* sound = static_cast<ma_sound*>(getSound());
+
+    if (!sound || !ma_sound_get_engine(sound))
+        return;
+
+    // Make sure a stop that was scheduled earlier won't make play() discard the new start time
+    if (getStatus() == Status::Stopped)
+        stop();
+
+    // Schedule the start before starting the sound so that not a single frame is played too early
+    ma_sound_set_start_time_in_pcm_frames(sound,
+                                          priv::MiniaudioUtils::getEngineFrame(*ma_sound_get_engine(sound), engineTime));
+    play();
+}
+
+
+////////////////////////////////////////////////////////////
+void SoundSource::stopAt(Time engineTime)
+{
+    auto* sound = static_cast<ma_sound*>(getSound());
+
+    if (!sound || !ma_sound_get_engine(sound))
+        return;
+
+    ma_sound_set_stop_time_in_pcm_frames(sound, priv::MiniaudioUtils::getEngineFrame(*ma_sound_get_engine(sound), engineTime));
+}
+
+
+////////////////////////////////////////////////////////////
+void SoundSource::updateSpatial(const SpatialUpdate* updates, std::size_t count, const ListenerUpdate& listener)
+{
+    std::vector<priv::AudioDevice::SpatialUpdate> soundUpdates;
+    soundUpdates.reserve(count);
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const auto& update = updates[i];
+
+        if (!update.source)
+            continue;
+
+        if (auto* sound = static_cast<ma_sound*>(update.source->getSound()))
+            soundUpdates.push_back({sound, update.position, update.direction, update.velocity});
+    }
+
+    priv::AudioDevice::queueSpatialUpdates(soundUpdates, listener);
+}
+
+
 ////////////////////////////////////////////////////////////
 SoundSource& SoundSource::operator=(const SoundSource& right)
 {
@@ -272,6 +272,10 @@ void SoundStream::initialize(unsigned int channelCount, unsigned int sampleRate,
 ////////////////////////////////////////////////////////////
 void SoundStream::play()
 {
+    // Once a scheduled stop has been reached, playing again restarts from the beginning
+    if (priv::MiniaudioUtils::isScheduledStopReached(m_impl->sound))
+        stop();
+
     if (m_impl->status == Status::Playing)
         setPlayingOffset(Time::Zero);
 
@@ -295,6 +299,8 @@ void SoundStream::pause()
     }
     else
     {
+        priv::MiniaudioUtils::clearSchedule(m_impl->sound);
+
         if (m_impl->status == Status::Playing)
             m_impl->status = Status::Paused;
     }
@@ -310,6 +316,7 @@ void SoundStream::stop()
     }
     else
     {
+        priv::MiniaudioUtils::clearSchedule(m_impl->sound);
         setPlayingOffset(Time::Zero);
         m_impl->status = Status::Stopped;
     }
@@ -340,6 +347,9 @@ std::vector<SoundChannel> SoundStream::getChannelMap() const
 ////////////////////////////////////////////////////////////
 SoundStream::Status SoundStream::getStatus() const
 {
+    if ((m_impl->status == Status::Playing) && priv::MiniaudioUtils::isScheduledStopReached(m_impl->sound))
+        return Status::Stopped;
+
     return m_impl->status;
 }
 
@@ -0,0 +1,591 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Network/BitPacket.hpp>
+
+#include <SFML/System/String.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <string>
+#include <utility>
+
+#include <cassert>
+#include <cmath>
+#include <cstring>
+
+
+namespace
+{
+////////////////////////////////////////////////////////////
+std::uint64_t zigZagEncode(std::int64_t value)
+{
+    // Interleave positive and negative values so that small magnitudes give small varints
+    const auto bits = static_cast<std::uint64_t>(value);
+    return value < 0 ? ~(bits << 1) : (bits << 1);
+}
+
+
+////////////////////////////////////////////////////////////
+std::int64_t zigZagDecode(std::uint64_t value)
+{
+    return static_cast<std::int64_t>((value >> 1) ^ (std::uint64_t{0} - (value & 1)));
+}
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+void BitPacket::append(const void* data, std::size_t sizeInBytes)
+{
+    if (!data || (sizeInBytes == 0))
+        return;
+
+    const auto* begin = static_cast<const std::byte*>(data);
+    if (m_bitCount % 8 == 0)
+    {
+        // Aligned on a byte boundary: bytes can be copied directly
+        m_data.insert(m_data.end(), begin, begin + sizeInBytes);
+        m_bitCount += sizeInBytes * 8;
+    }
+    else
+    {
+        for (std::size_t i = 0; i < sizeInBytes; ++i)
+            writeBits(std::to_integer<std::uint64_t>(begin[i]), 8);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void BitPacket::clear()
+{
+    m_data.clear();
+    m_bitCount = 0;
+    m_readPos  = 0;
+    m_isValid  = true;
+}
+
+
+////////////////////////////////////////////////////////////
+const void* BitPacket::getData() const
+{
+    return !m_data.empty() ? m_data.data() : nullptr;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t BitPacket::getDataSize() const
+{
+    return m_data.size();
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t BitPacket::getBitCount() const
+{
+    return m_bitCount;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t BitPacket::getReadPosition() const
+{
+    return m_readPos;
+}
+
+
+////////////////////////////////////////////////////////////
+bool BitPacket::endOfPacket() const
+{
+    return m_readPos >= m_bitCount;
+}
+
+
+////////////////////////////////////////////////////////////
+BitPacket::operator bool() const
+{
+    return m_isValid;
+}
+
+
+////////////////////////////////////////////////////////////
+BitPacket& BitPacket::writeBits(std::uint64_t value, unsigned int bitCount)
+{
+    assert(bitCount <= 64 && "BitPacket::writeBits Cannot write more than 64 bits");
+
+    if (bitCount < 64)
+        value &= (std::uint64_t{1} << bitCount) - 1;
+
+    m_data.resize((m_bitCount + bitCount + 7) / 8);
+
+    // Fill the current byte, then the following ones, starting from the least significant bits
+    while (bitCount > 0)
+    {
+        const std::size_t  byteIndex = m_bitCount / 8;
+        const unsigned int bitOffset = m_bitCount % 8;
+        const unsigned int chunk     = std::min(8 - bitOffset, bitCount);
+
+        m_data[byteIndex] |= static_cast<std::byte>((value << bitOffset) & 0xFF);
+
+        value >>= chunk;
+        bitCount -= chunk;
+        m_bitCount += chunk;
+    }
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+BitPacket& BitPacket::readBits(std::uint64_t& value, unsigned int bitCount)
+{
+    assert(bitCount <= 64 && "BitPacket::readBits Cannot read more than 64 bits");
+
+    if (checkSize(bitCount))
+    {
+        std::uint64_t result = 0;
+        unsigned int  shift  = 0;
+        while (shift < bitCount)
+        {
+            const std::size_t  byteIndex = m_readPos / 8;
+            const unsigned int bitOffset = m_readPos % 8;
+            const unsigned int chunk     = std::min(8 - bitOffset, bitCount - shift);
+            const auto         byte      = std::to_integer<unsigned int>(m_data[byteIndex]);
+            const auto         bits      = (byte >> bitOffset) & ((1u << chunk) - 1);
+
+            result |= std::uint64_t{bits} << shift;
+
+            shift += chunk;
+            m_readPos += chunk;
+        }
+
+        value = result;
+    }
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+BitPacket& BitPacket::writeFloat(float value, float min, float max, unsigned int bitCount)
+{
+    assert(bitCount > 0 && bitCount <= 32 && "BitPacket::writeFloat Bit count must be between 1 and 32");
+    assert(min < max && "BitPacket::writeFloat Range must not be empty");
+
+    // NaN is mapped to the minimum of the range
+    const float  clamped    = value > min ? std::min(value, max) : min;
+    const double maxInteger = static_cast<double>((std::uint64_t{1} << bitCount) - 1);
+    const double ratio      = (double{clamped} - double{min}) / (double{max} - double{min});
+
+    return writeBits(static_cast<std::uint64_t>(std::llround(ratio * maxInteger)), bitCount);
+}
+
+
+////////////////////////////////////////////////////////////
+BitPacket& BitPacket::readFloat(float& value, float min, float max, unsigned int bitCount)
+{
+    assert(bitCount > 0 && bitCount <= 32 && "BitPacket::readFloat Bit count must be between 1 and 32");
+    assert(min < max && "BitPacket::readFloat Range must not be empty");
+
+    std::uint64_t integer = 0;
+    if (readBits(integer, bitCount))
+    {
+        const double maxInteger = static_cast<double>((std::uint64_t{1} << bitCount) - 1);
+        const double ratio      = static_cast<double>(integer) / maxInteger;
+
+        value = static_cast<float>(double{min} + ratio * (double{max} - double{min}));
+    }
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+BitPacket& BitPacket::operator>>(bool& data)
+{
+    std::uint64_t value = 0;
+    if (readBits(value, 1))
+        data = (value != 0);
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+BitPacket& BitPacket::operator>>(std::int8_t& data)
+{
+    std::uint64_t value = 0;
+    if (readBits(value, 8))
+        data = static_cast<std::int8_t>(static_cast<std::uint8_t>(value));
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+BitPacket& BitPacket::operator>>(std::uint8_t& data)
+{
+    std::uint64_t value = 0;
+    if (readBits(value, 8))
+        data = static_cast<std::uint8_t>(value);
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+BitPacket& BitPacket::operator>>(std::int16_t& data)
+{
+    std::uint64_t value = 0;
+    if (readVarint(value, std::numeric_limits<std::uint16_t>::max()))
+        data = static_cast<std::int16_t>(zigZagDecode(value));
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+BitPacket& BitPacket::operator>>(std::uint16_t& data)
+{
+    std::uint64_t value = 0;
+    if (readVarint(value, std::numeric_limits<std::uint16_t>::max()))
+        data = static_cast<std::uint16_t>(value);
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+BitPacket& BitPacket::operator>>(std::int32_t& data)
+{
+    std::uint64_t value = 0;
+    if (readVarint(value, std::numeric_limits<std::uint32_t>::max()))
+        data = static_cast<std::int32_t>(zigZagDecode(value));
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+BitPacket& BitPacket::operator>>(std::uint32_t& data)
+{
+    std::uint64_t value = 0;
+    if (readVarint(value, std::numeric_limits<std::uint32_t>::max()))
+        data = static_cast<std::uint32_t>(value);
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+BitPacket& BitPacket::operator>>(std::int64_t& data)
+{
+    std::uint64_t value = 0;
+    if (readVarint(value, std::numeric_limits<std::uint64_t>::max()))
+        data = zigZagDecode(value);
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+BitPacket& BitPacket::operator>>(std::uint64_t& data)
+{
+    readVarint(data, std::numeric_limits<std::uint64_t>::max());
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+BitPacket& BitPacket::operator>>(float& data)
+{
+    std::uint64_t value = 0;
+    if (readBits(value, 32))
+    {
+        const auto bits = static_cast<std::uint32_t>(value);
+        std::memcpy(&data, &bits, sizeof(data));
+    }
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+BitPacket& BitPacket::operator>>(double& data)
+{
+    std::uint64_t value = 0;
+    if (readBits(value, 64))
+        std::memcpy(&data, &value, sizeof(data));
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+BitPacket& BitPacket::operator>>(std::string& data)
+{
+    // First extract string length, which cannot exceed the remaining bytes
+    std::uint64_t length = 0;
+    if (readVarint(length, (m_bitCount - m_readPos) / 8) && checkSize(static_cast<std::size_t>(length) * 8))
+    {
+        // Then extract characters
+        data.resize(static_cast<std::size_t>(length));
+        if (m_readPos % 8 == 0)
+        {
+            // The read position may be at the very end of the data if the string is empty
+            if (!data.empty())
+                std::memcpy(data.data(), m_data.data() + m_readPos / 8, data.size());
+            m_readPos += data.size() * 8;
+        }
+        else
+        {
+            for (char& character : data)
+            {
+                std::uint64_t value = 0;
+                readBits(value, 8);
+                character = static_cast<char>(value);
+            }
+        }
+    }
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+BitPacket& BitPacket::operator>>(String& data)
+{
+    // First extract string length, each character taking at least a byte
+    std::uint64_t length = 0;
+    if (readVarint(length, (m_bitCount - m_readPos) / 8))
+    {
+        // Then extract characters
+        std::u32string characters(static_cast<std::size_t>(length), U'\0');
+        for (char32_t& character : characters)
+        {
+            std::uint64_t value = 0;
+            if (!readVarint(value, std::numeric_limits<std::uint32_t>::max()))
+                return *this;
+
+            character = static_cast<char32_t>(value);
+        }
+
+        data = std::move(characters);
+    }
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+BitPacket& BitPacket::operator<<(bool data)
+{
+    return writeBits(data ? 1 : 0, 1);
+}
+
+
+////////////////////////////////////////////////////////////
+BitPacket& BitPacket::operator<<(std::int8_t data)
+{
+    return writeBits(static_cast<std::uint8_t>(data), 8);
+}
+
+
+////////////////////////////////////////////////////////////
+BitPacket& BitPacket::operator<<(std::uint8_t data)
+{
+    return writeBits(data, 8);
+}
+
+
+////////////////////////////////////////////////////////////
+BitPacket& BitPacket::operator<<(std::int16_t data)
+{
+    writeVarint(zigZagEncode(data));
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+BitPacket& BitPacket::operator<<(std::uint16_t data)
+{
+    writeVarint(data);
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+BitPacket& BitPacket::operator<<(std::int32_t data)
+{
+    writeVarint(zigZagEncode(data));
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+BitPacket& BitPacket::operator<<(std::uint32_t data)
+{
+    writeVarint(data);
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+BitPacket& BitPacket::operator<<(std::int64_t data)
+{
+    writeVarint(zigZagEncode(data));
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+BitPacket& BitPacket::operator<<(std::uint64_t data)
+{
+    writeVarint(data);
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+BitPacket& BitPacket::operator<<(float data)
+{
+    std::uint32_t bits = 0;
+    std::memcpy(&bits, &data, sizeof(bits));
+    return writeBits(bits, 32);
+}
+
+
+////////////////////////////////////////////////////////////
+BitPacket& BitPacket::operator<<(double data)
+{
+    std::uint64_t bits = 0;
+    std::memcpy(&bits, &data, sizeof(bits));
+    return writeBits(bits, 64);
+}
+
+
+////////////////////////////////////////////////////////////
+BitPacket& BitPacket::operator<<(const char* data)
+{
+    assert(data && "BitPacket::operator<< Data must not be null");
+
+    return *this << std::string_view(data);
+}
+
+
+////////////////////////////////////////////////////////////
+BitPacket& BitPacket::operator<<(const std::string& data)
+{
+    return *this << std::string_view(data);
+}
+
+
+////////////////////////////////////////////////////////////
+BitPacket& BitPacket::operator<<(std::string_view data)
+{
+    // First insert string length
+    writeVarint(data.size());
+
+    // Then insert characters
+    append(data.data(), data.size());
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+BitPacket& BitPacket::operator<<(const String& data)
+{
+    // First insert the string length
+    writeVarint(data.getSize());
+
+    // Then insert characters
+    for (const char32_t character : data)
+        writeVarint(character);
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+void BitPacket::writeVarint(std::uint64_t value)
+{
+    // Write 7 bits at a time, the highest bit of each group telling if more groups follow
+    while (value >= 0x80)
+    {
+        writeBits((value & 0x7F) | 0x80, 8);
+        value >>= 7;
+    }
+
+    writeBits(value, 8);
+}
+
+
+////////////////////////////////////////////////////////////
+bool BitPacket::readVarint(std::uint64_t& value, std::uint64_t maxValue)
+{
+    std::uint64_t result = 0;
+    for (unsigned int shift = 0; shift < 64; shift += 7)
+    {
+        std::uint64_t group = 0;
+        if (!readBits(group, 8))
+            return false;
+
+        // Reject groups whose bits would not fit in 64 bits
+        const std::uint64_t bits = group & 0x7F;
+        if ((bits << shift) >> shift != bits)
+            break;
+
+        result |= bits << shift;
+
+        if ((group & 0x80) == 0)
+        {
+            if (result > maxValue)
+                break;
+
+            value = result;
+            return true;
+        }
+    }
+
+    m_isValid = false;
+    return false;
+}
+
+
+////////////////////////////////////////////////////////////
+bool BitPacket::checkSize(std::size_t bitCount)
+{
+    // Determine if size is big enough to trigger an overflow
+    const bool overflowDetected = m_readPos + bitCount < m_readPos;
+    m_isValid                   = m_isValid && (m_readPos + bitCount <= m_bitCount) && !overflowDetected;
+
+    return m_isValid;
+}
+
+} // namespace sf
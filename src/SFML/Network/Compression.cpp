@@ -0,0 +1,338 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Network/Compression.hpp>
+
+#include <algorithm>
+#include <array>
+
+#include <cstring>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace CompressionImpl
+{
+// Format constants, see https://github.com/lz4/lz4/blob/dev/doc/lz4_Block_format.md
+constexpr std::size_t   minMatch     = 4;           // Matches shorter than this are written as literals
+constexpr std::size_t   lastLiterals = 5;           // The last bytes of a block are always literals
+constexpr std::size_t   matchLimit   = 12;          // No match may start in the last bytes of a block
+constexpr unsigned int  skipTrigger  = 6;           // Search faster in data that doesn't compress
+constexpr std::size_t   runMask      = 15;          // Largest length stored in a half of the token
+constexpr std::uint32_t hashPrime    = 2654435761u; // Multiplier spreading 4 bytes over the hash table
+
+////////////////////////////////////////////////////////////
+std::uint32_t read32(const std::byte* data)
+{
+    std::uint32_t value = 0;
+    std::memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint32_t hash(const std::byte* data)
+{
+    return (read32(data) * hashPrime) >> (32 - sf::priv::Lz::hashLog);
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t countMatching(const std::byte* a, const std::byte* b, const std::byte* bEnd)
+{
+    const std::byte* begin = b;
+    while ((b < bEnd) && (*a == *b))
+    {
+        ++a;
+        ++b;
+    }
+    return static_cast<std::size_t>(b - begin);
+}
+
+
+////////////////////////////////////////////////////////////
+std::byte* writeLength(std::byte* output, std::size_t length)
+{
+    // Lengths that don't fit in the token are continued with bytes of 255, then the remainder
+    while (length >= 255)
+    {
+        *output++ = std::byte{255};
+        length -= 255;
+    }
+    *output++ = static_cast<std::byte>(length);
+    return output;
+}
+
+
+////////////////////////////////////////////////////////////
+bool readLength(const std::byte*& input, const std::byte* inputEnd, std::size_t& length)
+{
+    std::byte value{255};
+    while (value == std::byte{255})
+    {
+        if (input == inputEnd)
+            return false;
+
+        value = *input++;
+        length += std::to_integer<std::size_t>(value);
+    }
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+std::byte* writeSequence(std::byte*       output,
+                         const std::byte* outputEnd,
+                         const std::byte* literals,
+                         std::size_t      literalLength,
+                         std::size_t      offset,
+                         std::size_t      matchLength)
+{
+    // Worst case size of the sequence, including the continuation bytes of both lengths
+    const std::size_t required = 1 + literalLength / 255 + 1 + literalLength + 2 + matchLength / 255 + 1;
+    if (static_cast<std::size_t>(outputEnd - output) < required)
+        return nullptr;
+
+    std::byte* token = output++;
+    *token           = static_cast<std::byte>(std::min(literalLength, runMask) << 4);
+    if (literalLength >= runMask)
+        output = writeLength(output, literalLength - runMask);
+
+    std::copy_n(literals, literalLength, output);
+    output += literalLength;
+
+    // The last sequence only contains literals
+    if (matchLength == 0)
+        return output;
+
+    *output++ = static_cast<std::byte>(offset & 0xFF);
+    *output++ = static_cast<std::byte>(offset >> 8);
+
+    const std::size_t length = matchLength - minMatch;
+    *token |= static_cast<std::byte>(std::min(length, runMask));
+    if (length >= runMask)
+        output = writeLength(output, length - runMask);
+
+    return output;
+}
+} // namespace CompressionImpl
+} // namespace
+
+
+namespace sf::priv::Lz
+{
+////////////////////////////////////////////////////////////
+void fillHashTable(const std::byte* data, std::size_t size, std::uint32_t* hashTable)
+{
+    std::fill(hashTable, hashTable + hashTableSize, 0);
+
+    // Entries store positions + 1, so that 0 means no entry; later positions are preferred as they are closer
+    for (std::size_t i = 0; i + CompressionImpl::minMatch <= size; ++i)
+        hashTable[CompressionImpl::hash(data + i)] = static_cast<std::uint32_t>(i + 1);
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t compress(const std::byte*  source,
+                     std::size_t       sourceSize,
+                     std::byte*        destination,
+                     std::size_t       destinationCapacity,
+                     const Dictionary* dictionary)
+{
+    using namespace CompressionImpl;
+
+    const std::byte* input     = source;
+    const std::byte* anchor    = source;
+    const std::byte* inputEnd  = source + sourceSize;
+    std::byte*       output    = destination;
+    std::byte*       outputEnd = destination + destinationCapacity;
+
+    // Blocks too small to contain a match are only made of literals
+    if (sourceSize > matchLimit)
+    {
+        std::array<std::uint32_t, hashTableSize> hashTable{};
+
+        const std::byte* searchEnd = inputEnd - matchLimit;
+        const std::byte* matchEnd  = inputEnd - lastLiterals;
+        unsigned int     attempts  = 1 << skipTrigger;
+
+        while (input <= searchEnd)
+        {
+            const std::uint32_t h        = hash(input);
+            const std::uint32_t entry    = hashTable[h];
+            const std::size_t   position = static_cast<std::size_t>(input - source);
+            hashTable[h]                 = static_cast<std::uint32_t>(position + 1);
+
+            // Look for a match in the data already compressed, then in the dictionary
+            std::size_t offset = 0;
+            std::size_t length = 0;
+            if ((entry != 0) && (position - (entry - 1) <= maxOffset) && (read32(source + entry - 1) == read32(input)))
+            {
+                const std::byte* match = source + entry - 1;
+                offset                 = static_cast<std::size_t>(input - match);
+                length                 = minMatch + countMatching(match + minMatch, input + minMatch, matchEnd);
+
+                // Extend the match backwards over the pending literals
+                while ((input > anchor) && (match > source) && (input[-1] == match[-1]))
+                {
+                    --input;
+                    --match;
+                    ++length;
+                }
+            }
+            else if (dictionary && (dictionary->hashTable[h] != 0))
+            {
+                const std::size_t dictionaryPosition = dictionary->hashTable[h] - 1;
+                const std::size_t dictionaryOffset   = position + dictionary->size - dictionaryPosition;
+                if ((dictionaryOffset <= maxOffset) && (read32(dictionary->data + dictionaryPosition) == read32(input)))
+                {
+                    // The match may continue past the end of the dictionary, into the beginning of the source
+                    const std::byte*  match        = dictionary->data + dictionaryPosition;
+                    const std::size_t inDictionary = dictionary->size - dictionaryPosition;
+                    offset                         = dictionaryOffset;
+                    length = countMatching(match, input, std::min(input + inDictionary, matchEnd));
+                    if (length == inDictionary)
+                        length += countMatching(source, input + length, matchEnd);
+                }
+            }
+
+            if (length == 0)
+            {
+                // Skip bytes faster and faster while no match is found
+                input += attempts++ >> skipTrigger;
+                continue;
+            }
+
+            output = writeSequence(output,
+                                   outputEnd,
+                                   anchor,
+                                   static_cast<std::size_t>(input - anchor),
+                                   offset,
+                                   length);
+            if (!output)
+                return 0;
+
+            input += length;
+            anchor   = input;
+            attempts = 1 << skipTrigger;
+        }
+    }
+
+    // Write the remaining bytes as literals
+    output = writeSequence(output, outputEnd, anchor, static_cast<std::size_t>(inputEnd - anchor), 0, 0);
+    if (!output)
+        return 0;
+
+    return static_cast<std::size_t>(output - destination);
+}
+
+
+////////////////////////////////////////////////////////////
+bool decompress(const std::byte*  source,
+                std::size_t       sourceSize,
+                std::byte*        destination,
+                std::size_t       destinationSize,
+                const Dictionary* dictionary)
+{
+    using namespace CompressionImpl;
+
+    const std::byte* input     = source;
+    const std::byte* inputEnd  = source + sourceSize;
+    std::byte*       output    = destination;
+    std::byte*       outputEnd = destination + destinationSize;
+
+    while (input < inputEnd)
+    {
+        const auto token = std::to_integer<std::size_t>(*input++);
+
+        // Copy the literals
+        std::size_t literalLength = token >> 4;
+        if ((literalLength == runMask) && !readLength(input, inputEnd, literalLength))
+            return false;
+
+        if ((literalLength > static_cast<std::size_t>(inputEnd - input)) ||
+            (literalLength > static_cast<std::size_t>(outputEnd - output)))
+            return false;
+
+        std::copy_n(input, literalLength, output);
+        input += literalLength;
+        output += literalLength;
+
+        // The last sequence has no match
+        if (input == inputEnd)
+            break;
+
+        // Copy the match
+        if (inputEnd - input < 2)
+            return false;
+
+        const std::size_t offset = std::to_integer<std::size_t>(input[0]) |
+                                   (std::to_integer<std::size_t>(input[1]) << 8);
+        input += 2;
+
+        std::size_t matchLength = token & runMask;
+        if ((matchLength == runMask) && !readLength(input, inputEnd, matchLength))
+            return false;
+
+        matchLength += minMatch;
+        if ((offset == 0) || (matchLength > static_cast<std::size_t>(outputEnd - output)))
+            return false;
+
+        const auto position = static_cast<std::size_t>(output - destination);
+        if (offset > position)
+        {
+            // The match starts in the dictionary, and may continue at the beginning of the destination
+            const std::size_t inDictionary = offset - position;
+            if (!dictionary || (inDictionary > dictionary->size))
+                return false;
+
+            const std::size_t fromDictionary = std::min(inDictionary, matchLength);
+            std::memcpy(output, dictionary->data + dictionary->size - inDictionary, fromDictionary);
+            output += fromDictionary;
+            matchLength -= fromDictionary;
+
+            for (const std::byte* match = destination; matchLength > 0; --matchLength)
+                *output++ = *match++;
+        }
+        else if (offset >= matchLength)
+        {
+            std::memcpy(output, output - offset, matchLength);
+            output += matchLength;
+        }
+        else
+        {
+            // Overlapping copy, repeating the last bytes
+            for (const std::byte* match = output - offset; matchLength > 0; --matchLength)
+                *output++ = *match++;
+        }
+    }
+
+    return output == outputEnd;
+}
+
+} // namespace sf::priv::Lz
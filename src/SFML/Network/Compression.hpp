@@ -0,0 +1,108 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Fast LZ compression, using the LZ4 block format
+///
+////////////////////////////////////////////////////////////
+namespace Lz
+{
+constexpr unsigned int hashLog       = 12;           //!< Number of bits of the hash of 4 bytes
+constexpr std::size_t  hashTableSize = 1 << hashLog; //!< Number of entries of a hash table
+constexpr std::size_t  maxOffset     = 65535;        //!< Maximum distance between a match and its copy
+constexpr std::size_t  maxRatio      = 255;          //!< Upper bound of decompressed size / compressed size
+
+////////////////////////////////////////////////////////////
+/// \brief Data that compressed data may refer to, as if it preceded it
+///
+////////////////////////////////////////////////////////////
+struct Dictionary
+{
+    const std::byte*     data{};      //!< Content of the dictionary
+    std::size_t          size{};      //!< Size of the dictionary, at most `maxOffset`
+    const std::uint32_t* hashTable{}; //!< Table filled with `fillHashTable`
+};
+
+////////////////////////////////////////////////////////////
+/// \brief Index the content of a dictionary
+///
+/// \param data      Content of the dictionary
+/// \param size      Size of the dictionary
+/// \param hashTable Table of `hashTableSize` entries to fill
+///
+////////////////////////////////////////////////////////////
+void fillHashTable(const std::byte* data, std::size_t size, std::uint32_t* hashTable);
+
+////////////////////////////////////////////////////////////
+/// \brief Compress a block of data
+///
+/// \param source              Data to compress
+/// \param sourceSize          Size of the data to compress
+/// \param destination         Buffer to write the compressed data to
+/// \param destinationCapacity Size of the destination buffer
+/// \param dictionary          Optional dictionary
+///
+/// \return Size of the compressed data, or 0 if it doesn't fit in the destination
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] std::size_t compress(const std::byte*  source,
+                                   std::size_t       sourceSize,
+                                   std::byte*        destination,
+                                   std::size_t       destinationCapacity,
+                                   const Dictionary* dictionary);
+
+////////////////////////////////////////////////////////////
+/// \brief Decompress a block of data
+///
+/// Malformed data is detected and never causes reads or
+/// writes outside of the buffers.
+///
+/// \param source          Compressed data
+/// \param sourceSize      Size of the compressed data
+/// \param destination     Buffer to write the decompressed data to
+/// \param destinationSize Exact size of the decompressed data
+/// \param dictionary      Dictionary used for compression, if any
+///
+/// \return `true` if the data was valid and decompressed to exactly \a destinationSize bytes
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] bool decompress(const std::byte*  source,
+                              std::size_t       sourceSize,
+                              std::byte*        destination,
+                              std::size_t       destinationSize,
+                              const Dictionary* dictionary);
+} // namespace Lz
+
+} // namespace sf::priv
@@ -0,0 +1,77 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Network/Compression.hpp>
+#include <SFML/Network/CompressionDictionary.hpp>
+
+#include <algorithm>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+CompressionDictionary::CompressionDictionary(const void* data, std::size_t sizeInBytes) :
+m_hashTable(priv::Lz::hashTableSize)
+{
+    if (data && (sizeInBytes > 0))
+    {
+        // Only keep what compressed data can refer to
+        const auto* end   = static_cast<const std::byte*>(data) + sizeInBytes;
+        const auto* begin = end - std::min(sizeInBytes, priv::Lz::maxOffset);
+        m_data.assign(begin, end);
+    }
+
+    priv::Lz::fillHashTable(m_data.data(), m_data.size(), m_hashTable.data());
+
+    // FNV-1a hash of the content
+    m_id = 2166136261u;
+    for (const std::byte byte : m_data)
+        m_id = (m_id ^ std::to_integer<std::uint32_t>(byte)) * 16777619u;
+}
+
+
+////////////////////////////////////////////////////////////
+const void* CompressionDictionary::getData() const
+{
+    return !m_data.empty() ? m_data.data() : nullptr;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t CompressionDictionary::getDataSize() const
+{
+    return m_data.size();
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint32_t CompressionDictionary::getId() const
+{
+    return m_id;
+}
+
+} // namespace sf
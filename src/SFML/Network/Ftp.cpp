@@ -28,19 +28,227 @@
 #include <SFML/Network/Ftp.hpp>
 #include <SFML/Network/IpAddress.hpp>
 
+#include <SFML/System/Clock.hpp>
 #include <SFML/System/Err.hpp>
 
 #include <algorithm>
 #include <array>
 #include <fstream>
+#include <optional>
 #include <ostream>
 #include <sstream>
 #include <utility>
 
 #include <cctype>
+#include <cerrno>
+#include <climits>
 #include <cstddef>
 #include <cstdint>
 
+#ifdef SFML_SYSTEM_LINUX
+#include <fcntl.h>
+#include <sys/sendfile.h>
+#include <unistd.h>
+#endif
+
+
+namespace
+{
+namespace FtpImpl
+{
+////////////////////////////////////////////////////////////
+struct Transfer
+{
+    const sf::Ftp::ProgressCallback* callback{}; //!< Function reporting the progress, may be null or empty
+    sf::Ftp::Progress                progress;   //!< Progress of the transfer
+    std::uint64_t                    offset{};   //!< Number of bytes transferred before the transfer was resumed
+    sf::Clock                        clock;      //!< Clock measuring the duration of the transfer
+
+    // Count newly transferred bytes and report the progress; return false if the transfer must be aborted
+    [[nodiscard]] bool advance(std::uint64_t count)
+    {
+        progress.transferred += count;
+        progress.elapsed = clock.getElapsedTime();
+
+        const double seconds = static_cast<double>(progress.elapsed.asMicroseconds()) / 1'000'000.0;
+        progress.throughput = (seconds > 0) ? static_cast<double>(progress.transferred - offset) / seconds : 0;
+
+        return (callback == nullptr) || !*callback || (*callback)(progress);
+    }
+};
+
+
+////////////////////////////////////////////////////////////
+// Extract the size of a file from the response to a SIZE command; return nothing if the server didn't tell
+std::optional<std::uint64_t> parseSize(const sf::Ftp::Response& response)
+{
+    if (response.getStatus() != sf::Ftp::Response::Status::FileStatus)
+        return std::nullopt;
+
+    std::uint64_t size = 0;
+    if (!(std::istringstream(response.getMessage()) >> size))
+        return std::nullopt;
+
+    return size;
+}
+
+
+#ifdef SFML_SYSTEM_LINUX
+////////////////////////////////////////////////////////////
+// Local file opened by its descriptor, closed when going out of scope
+class File
+{
+public:
+    explicit File(int descriptor) : m_descriptor(descriptor)
+    {
+    }
+
+    ~File()
+    {
+        if (m_descriptor >= 0)
+            ::close(m_descriptor);
+    }
+
+    File(const File&)            = delete;
+    File& operator=(const File&) = delete;
+
+    [[nodiscard]] int get() const
+    {
+        return m_descriptor;
+    }
+
+private:
+    int m_descriptor; //!< File descriptor, negative if the file couldn't be opened
+};
+
+
+////////////////////////////////////////////////////////////
+// Write a whole buffer to a file
+[[nodiscard]] bool writeAll(int file, const char* data, std::size_t size)
+{
+    while (size > 0)
+    {
+        const ssize_t written = ::write(file, data, size);
+        if (written < 0)
+        {
+            if (errno == EINTR)
+                continue;
+
+            return false;
+        }
+
+        data += written;
+        size -= static_cast<std::size_t>(written);
+    }
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+// Move data from a socket to a file without copying it to user space, through a pipe; return
+// nothing if the kernel can't splice them, otherwise whether the whole stream reached the file
+std::optional<bool> spliceToFile(int socket, int file, std::size_t step, Transfer& transfer)
+{
+    std::array<int, 2> pipe{};
+    if (::pipe2(pipe.data(), O_CLOEXEC) != 0)
+        return std::nullopt;
+
+    // A bigger pipe moves more data per call; the kernel may refuse, which is harmless
+    (void)::fcntl(pipe[1], F_SETPIPE_SZ, static_cast<int>(std::min<std::size_t>(step, INT_MAX)));
+
+    std::optional<bool> completed;
+    bool                started = false;
+    for (;;)
+    {
+        const ssize_t received = ::splice(socket, nullptr, pipe[1], nullptr, step, SPLICE_F_MOVE | SPLICE_F_MORE);
+        if ((received < 0) && (errno == EINTR))
+            continue;
+
+        // Let the caller copy the data itself if splicing isn't supported at all
+        if ((received < 0) && !started && ((errno == EINVAL) || (errno == ENOSYS)))
+            break;
+
+        // Only the end of the stream completes the transfer, an error leaves the file truncated
+        started = true;
+        if (received <= 0)
+        {
+            completed = (received == 0);
+            break;
+        }
+
+        // Flush the pipe to the file
+        auto left = static_cast<std::size_t>(received);
+        while (left > 0)
+        {
+            const ssize_t written = ::splice(pipe[0], nullptr, file, nullptr, left, SPLICE_F_MOVE | SPLICE_F_MORE);
+            if ((written < 0) && (errno == EINTR))
+                continue;
+
+            if (written <= 0)
+                break;
+
+            left -= static_cast<std::size_t>(written);
+        }
+
+        if (left > 0)
+        {
+            sf::err() << "FTP Error: Writing to the file has failed" << std::endl;
+            completed = false;
+            break;
+        }
+
+        if (!transfer.advance(static_cast<std::uint64_t>(received)))
+        {
+            completed = false;
+            break;
+        }
+    }
+
+    ::close(pipe[0]);
+    ::close(pipe[1]);
+    return completed;
+}
+
+
+////////////////////////////////////////////////////////////
+// Send a file to a socket straight from the page cache; return nothing if the
+// kernel can't send this file, otherwise whether the whole file was sent
+std::optional<bool> sendFile(int socket, int file, std::size_t step, Transfer& transfer)
+{
+    std::optional<bool> completed;
+    bool                started = false;
+    for (;;)
+    {
+        const ssize_t sent = ::sendfile(socket, file, nullptr, step);
+        if ((sent < 0) && (errno == EINTR))
+            continue;
+
+        // Let the caller copy the data itself if the file can't be sent this way
+        if ((sent < 0) && !started && ((errno == EINVAL) || (errno == ENOSYS)))
+            break;
+
+        // Only the end of the file completes the transfer, an error leaves the remote file truncated
+        started = true;
+        if (sent <= 0)
+        {
+            completed = (sent == 0);
+            break;
+        }
+
+        if (!transfer.advance(static_cast<std::uint64_t>(sent)))
+        {
+            completed = false;
+            break;
+        }
+    }
+
+    return completed;
+}
+#endif
+} // namespace FtpImpl
+} // namespace
+
 
 namespace sf
 {
@@ -67,10 +275,18 @@ public:
     Ftp::Response open(Ftp::TransferMode mode);
 
     ////////////////////////////////////////////////////////////
-    void send(std::istream& stream);
+    [[nodiscard]] bool receive(std::ostream& stream, FtpImpl::Transfer& transfer);
+
+#ifdef SFML_SYSTEM_LINUX
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool send(int file, FtpImpl::Transfer& transfer);
 
     ////////////////////////////////////////////////////////////
-    void receive(std::ostream& stream);
+    [[nodiscard]] bool receive(int file, FtpImpl::Transfer& transfer);
+#else
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool send(std::istream& stream, FtpImpl::Transfer& transfer);
+#endif
 
 private:
     ////////////////////////////////////////////////////////////
@@ -228,7 +444,8 @@ Ftp::ListingResponse Ftp::getDirectoryListing(const std::string& directory)
         if (response.isOk())
         {
             // Receive the listing
-            data.receive(directoryData);
+            FtpImpl::Transfer transfer;
+            (void)data.receive(directoryData, transfer);
 
             // Get the response from the server
             response = getResponse();
@@ -286,37 +503,81 @@ Ftp::Response Ftp::deleteFile(const std::filesystem::path& name)
 
 
 ////////////////////////////////////////////////////////////
-Ftp::Response Ftp::download(const std::filesystem::path& remoteFile, const std::filesystem::path& localPath, TransferMode mode)
+Ftp::Response Ftp::download(const std::filesystem::path& remoteFile,
+                            const std::filesystem::path& localPath,
+                            TransferMode                 mode,
+                            bool                         resume)
 {
     // Open a data channel using the given transfer mode
     DataChannel data(*this);
     Response    response = data.open(mode);
-    if (response.isOk())
+    if (!response.isOk())
+        return response;
+
+    // Get the size of the file to report the progress, if the server supports it
+    FtpImpl::Transfer transfer;
+    transfer.callback = &m_progressCallback;
+    if (m_progressCallback)
+        transfer.progress.total = FtpImpl::parseSize(sendCommand("SIZE", remoteFile.string())).value_or(0);
+
+    // Skip the part of the file that was already downloaded
+    const std::filesystem::path filepath = localPath / remoteFile.filename();
+    if (resume)
     {
-        // Tell the server to start the transfer
-        response = sendCommand("RETR", remoteFile.string());
-        if (response.isOk())
-        {
-            // Create the file and truncate it if necessary
-            const std::filesystem::path filepath = localPath / remoteFile.filename();
-            std::ofstream               file(filepath, std::ios_base::binary | std::ios_base::trunc);
-            if (!file)
-                return Response(Response::Status::InvalidFile);
-
-            // Receive the file data
-            data.receive(file);
-
-            // Close the file
-            file.close();
-
-            // Get the response from the server
-            response = getResponse();
+        std::error_code error;
+        transfer.offset = std::filesystem::file_size(filepath, error);
+        if (error)
+            transfer.offset = 0;
 
-            // If the download was unsuccessful, delete the partial file
+        if (transfer.offset > 0)
+        {
+            response = sendCommand("REST", std::to_string(transfer.offset));
             if (!response.isOk())
-                std::filesystem::remove(filepath);
+                return response;
         }
     }
+    transfer.progress.transferred = transfer.offset;
+
+    // Tell the server to start the transfer
+    response = sendCommand("RETR", remoteFile.string());
+    if (response.isOk())
+    {
+        // Create the file and truncate it if necessary, or append to it when resuming
+#ifdef SFML_SYSTEM_LINUX
+        // (splice doesn't write to files opened in append mode, so seek to the end instead)
+        std::optional<FtpImpl::File> file;
+        const int flags = O_WRONLY | O_CREAT | O_CLOEXEC | ((transfer.offset > 0) ? 0 : O_TRUNC);
+        file.emplace(::open(filepath.c_str(), flags, 0666));
+        if ((file->get() < 0) || (::lseek(file->get(), static_cast<off_t>(transfer.offset), SEEK_SET) < 0))
+            return Response(Response::Status::InvalidFile);
+
+        // Receive the file data
+        const bool completed = data.receive(file->get(), transfer);
+
+        // Close the file
+        file.reset();
+#else
+        std::ofstream file(filepath,
+                           std::ios_base::binary | ((transfer.offset > 0) ? std::ios_base::app : std::ios_base::trunc));
+        if (!file)
+            return Response(Response::Status::InvalidFile);
+
+        // Receive the file data
+        const bool completed = data.receive(file, transfer);
+
+        // Close the file
+        file.close();
+#endif
+
+        // Get the response from the server
+        response = getResponse();
+        if (!completed)
+            response = Response(Response::Status::TransferAborted);
+
+        // If the download was unsuccessful, delete the partial file, unless it can be resumed
+        if (!response.isOk() && !resume)
+            std::filesystem::remove(filepath);
+    }
 
     return response;
 }
@@ -326,34 +587,95 @@ Ftp::Response Ftp::download(const std::filesystem::path& remoteFile, const std::
 Ftp::Response Ftp::upload(const std::filesystem::path& localFile,
                           const std::filesystem::path& remotePath,
                           TransferMode                 mode,
-                          bool                         append)
+                          bool                         append,
+                          bool                         resume)
 {
     // Get the contents of the file to send
+#ifdef SFML_SYSTEM_LINUX
+    const FtpImpl::File file(::open(localFile.c_str(), O_RDONLY | O_CLOEXEC));
+    if (file.get() < 0)
+        return Response(Response::Status::InvalidFile);
+#else
     std::ifstream file(localFile, std::ios_base::binary);
     if (!file)
         return Response(Response::Status::InvalidFile);
+#endif
+
+    FtpImpl::Transfer transfer;
+    transfer.callback = &m_progressCallback;
+    std::error_code error;
+    transfer.progress.total = std::filesystem::file_size(localFile, error);
 
     // Open a data channel using the given transfer mode
     DataChannel data(*this);
     Response    response = data.open(mode);
-    if (response.isOk())
+    if (!response.isOk())
+        return response;
+
+    // Skip the part of the file that the server already has
+    const std::string remoteFile = (remotePath / localFile.filename()).string();
+    if (resume)
     {
-        // Tell the server to start the transfer
-        response = sendCommand(append ? "APPE" : "STOR", (remotePath / localFile.filename()).string());
-        if (response.isOk())
+        transfer.offset = FtpImpl::parseSize(sendCommand("SIZE", remoteFile)).value_or(0);
+        if (transfer.offset > 0)
         {
-            // Send the file data
-            data.send(file);
+            response = sendCommand("REST", std::to_string(transfer.offset));
+            if (!response.isOk())
+                return response;
 
-            // Get the response from the server
-            response = getResponse();
+#ifdef SFML_SYSTEM_LINUX
+            if (::lseek(file.get(), static_cast<off_t>(transfer.offset), SEEK_SET) < 0)
+                return Response(Response::Status::InvalidFile);
+#else
+            if (!file.seekg(static_cast<std::streamoff>(transfer.offset)))
+                return Response(Response::Status::InvalidFile);
+#endif
         }
     }
+    transfer.progress.transferred = transfer.offset;
+
+    // Tell the server to start the transfer
+    response = sendCommand(append ? "APPE" : "STOR", remoteFile);
+    if (response.isOk())
+    {
+        // Send the file data
+#ifdef SFML_SYSTEM_LINUX
+        const bool completed = data.send(file.get(), transfer);
+#else
+        const bool completed = data.send(file, transfer);
+#endif
+
+        // Get the response from the server
+        response = getResponse();
+        if (!completed)
+            response = Response(Response::Status::TransferAborted);
+    }
 
     return response;
 }
 
 
+////////////////////////////////////////////////////////////
+void Ftp::setTransferBufferSize(std::size_t size)
+{
+    m_transferBufferSize = std::max<std::size_t>(size, 1);
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t Ftp::getTransferBufferSize() const
+{
+    return m_transferBufferSize;
+}
+
+
+////////////////////////////////////////////////////////////
+void Ftp::setProgressCallback(ProgressCallback callback)
+{
+    m_progressCallback = std::move(callback);
+}
+
+
 ////////////////////////////////////////////////////////////
 Ftp::Response Ftp::sendCommand(const std::string& command, const std::string& parameter)
 {
@@ -582,12 +904,13 @@ Ftp::Response Ftp::DataChannel::open(Ftp::TransferMode mode)
 
 
 ////////////////////////////////////////////////////////////
-void Ftp::DataChannel::receive(std::ostream& stream)
+bool Ftp::DataChannel::receive(std::ostream& stream, FtpImpl::Transfer& transfer)
 {
     // Receive data
-    std::array<char, 1024> buffer{};
-    std::size_t            received = 0;
-    while (m_dataSocket.receive(buffer.data(), buffer.size(), received) == Socket::Status::Done)
+    std::vector<char> buffer(m_ftp.m_transferBufferSize);
+    std::size_t       received = 0;
+    Socket::Status    status   = Socket::Status::Done;
+    while ((status = m_dataSocket.receive(buffer.data(), buffer.size(), received)) == Socket::Status::Done)
     {
         stream.write(buffer.data(), static_cast<std::streamsize>(received));
 
@@ -596,24 +919,32 @@ void Ftp::DataChannel::receive(std::ostream& stream)
             err() << "FTP Error: Writing to the file has failed" << std::endl;
             break;
         }
+
+        if (!transfer.advance(received))
+            break;
     }
 
     // Close the data socket
     m_dataSocket.disconnect();
+
+    // The transfer is complete only if the server closed the connection after the last byte
+    return status == Socket::Status::Disconnected;
 }
 
 
+#ifndef SFML_SYSTEM_LINUX
 ////////////////////////////////////////////////////////////
-void Ftp::DataChannel::send(std::istream& stream)
+bool Ftp::DataChannel::send(std::istream& stream, FtpImpl::Transfer& transfer)
 {
     // Send data
-    std::array<char, 1024> buffer{};
-    std::size_t            count = 0;
+    std::vector<char> buffer(m_ftp.m_transferBufferSize);
+    std::size_t       count     = 0;
+    bool              completed = false;
 
     for (;;)
     {
         // read some data from the stream
-        stream.read(buffer.data(), buffer.size());
+        stream.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
 
         if (!stream.good() && !stream.eof())
         {
@@ -628,16 +959,107 @@ void Ftp::DataChannel::send(std::istream& stream)
             // we could read more data from the stream: send them
             if (m_dataSocket.send(buffer.data(), count) != Socket::Status::Done)
                 break;
+
+            if (!transfer.advance(count))
+                break;
         }
         else
         {
-            // no more data: exit the loop
+            // no more data: the whole file was sent
+            completed = true;
             break;
         }
     }
 
     // Close the data socket
     m_dataSocket.disconnect();
+
+    return completed;
+}
+#endif
+
+
+#ifdef SFML_SYSTEM_LINUX
+////////////////////////////////////////////////////////////
+bool Ftp::DataChannel::receive(int file, FtpImpl::Transfer& transfer)
+{
+    // Let the kernel move the data to the file if possible
+    std::optional<bool> completed = FtpImpl::spliceToFile(m_dataSocket.getNativeHandle(),
+                                                          file,
+                                                          m_ftp.m_transferBufferSize,
+                                                          transfer);
+    if (!completed)
+    {
+        // Otherwise copy it through a buffer
+        std::vector<char> buffer(m_ftp.m_transferBufferSize);
+        std::size_t       received = 0;
+        Socket::Status    status   = Socket::Status::Done;
+        while ((status = m_dataSocket.receive(buffer.data(), buffer.size(), received)) == Socket::Status::Done)
+        {
+            if (!FtpImpl::writeAll(file, buffer.data(), received))
+            {
+                err() << "FTP Error: Writing to the file has failed" << std::endl;
+                break;
+            }
+
+            if (!transfer.advance(received))
+                break;
+        }
+
+        // The transfer is complete only if the server closed the connection after the last byte
+        completed = (status == Socket::Status::Disconnected);
+    }
+
+    // Close the data socket
+    m_dataSocket.disconnect();
+
+    return *completed;
+}
+
+
+////////////////////////////////////////////////////////////
+bool Ftp::DataChannel::send(int file, FtpImpl::Transfer& transfer)
+{
+    // Let the kernel send the file from the page cache if possible
+    std::optional<bool> completed = FtpImpl::sendFile(m_dataSocket.getNativeHandle(),
+                                                      file,
+                                                      m_ftp.m_transferBufferSize,
+                                                      transfer);
+    if (!completed)
+    {
+        // Otherwise copy it through a buffer
+        completed = false;
+
+        std::vector<char> buffer(m_ftp.m_transferBufferSize);
+        for (;;)
+        {
+            const ssize_t count = ::read(file, buffer.data(), buffer.size());
+            if ((count < 0) && (errno == EINTR))
+                continue;
+
+            if (count < 0)
+                err() << "FTP Error: Reading from the file has failed" << std::endl;
+
+            // Only the end of the file completes the transfer
+            if (count <= 0)
+            {
+                completed = (count == 0);
+                break;
+            }
+
+            if (m_dataSocket.send(buffer.data(), static_cast<std::size_t>(count)) != Socket::Status::Done)
+                break;
+
+            if (!transfer.advance(static_cast<std::uint64_t>(count)))
+                break;
+        }
+    }
+
+    // Close the data socket
+    m_dataSocket.disconnect();
+
+    return *completed;
 }
+#endif
 
 } // namespace sf
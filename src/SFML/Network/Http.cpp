@@ -26,14 +26,18 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <SFML/Network/Http.hpp>
+#include <SFML/Network/TcpSocket.hpp>
 
+#include <SFML/System/Clock.hpp>
 #include <SFML/System/Err.hpp>
 #include <SFML/System/Utils.hpp>
 
 #include <algorithm>
-#include <array>
+#include <functional>
 #include <iterator>
 #include <limits>
+#include <mutex>
+#include <optional>
 #include <ostream>
 #include <sstream>
 #include <utility>
@@ -42,6 +46,406 @@
 #include <cstddef>
 
 
+namespace
+{
+namespace HttpImpl
+{
+// Size of the buffer receiving responses, large enough to keep up with fast downloads
+constexpr std::size_t receiveBufferSize = 64 * 1024;
+
+////////////////////////////////////////////////////////////
+struct Connection
+{
+    sf::TcpSocket socket;  //!< Socket connected to the host
+    std::string   pending; //!< Bytes received but not consumed by a response yet
+};
+
+
+////////////////////////////////////////////////////////////
+struct IdleConnection
+{
+    sf::IpAddress  address;    //!< Address of the host
+    unsigned short port{};     //!< Port of the host
+    Connection     connection; //!< Connection waiting for a request
+};
+
+
+////////////////////////////////////////////////////////////
+struct Pool
+{
+    std::mutex                  mutex;         //!< Mutex protecting the pool
+    std::vector<IdleConnection> connections;   //!< Idle connections, most recently used last
+    std::size_t                 maxPerHost{8}; //!< Maximum number of idle connections per host
+};
+
+
+////////////////////////////////////////////////////////////
+Pool& getPool()
+{
+    static Pool pool;
+    return pool;
+}
+
+
+////////////////////////////////////////////////////////////
+// Connect to the first address of the host that accepts the connection, and move it to the front for the
+// next connections; the timeout covers all the attempts, counted from the time elapsed on the clock
+bool connect(sf::TcpSocket&              socket,
+             std::vector<sf::IpAddress>& addresses,
+             unsigned short              port,
+             sf::Time                    timeout,
+             const sf::Clock&            clock)
+{
+    for (auto it = addresses.begin(); it != addresses.end(); ++it)
+    {
+        // A zero timeout means no time limit, so a spent one must not be passed as is
+        sf::Time remaining = sf::Time::Zero;
+        if (timeout != sf::Time::Zero)
+        {
+            remaining = timeout - clock.getElapsedTime();
+            if (remaining <= sf::Time::Zero)
+                return false;
+        }
+
+        if (socket.connect(*it, port, remaining) == sf::Socket::Status::Done)
+        {
+            std::rotate(addresses.begin(), it, std::next(it));
+            return true;
+        }
+    }
+
+    return false;
+}
+
+
+////////////////////////////////////////////////////////////
+// Check whether sending a request twice has the same effect as sending it once
+bool isIdempotent(sf::Http::Request::Method method)
+{
+    return method != sf::Http::Request::Method::Post;
+}
+
+
+////////////////////////////////////////////////////////////
+// Take an idle connection to the host, if there is one that the server didn't close meanwhile
+std::optional<Connection> takeConnection(sf::IpAddress address, unsigned short port)
+{
+    for (;;)
+    {
+        std::optional<Connection> connection;
+        {
+            Pool&                 pool = getPool();
+            const std::lock_guard lock(pool.mutex);
+            const auto            it = std::find_if(pool.connections.rbegin(),
+                                         pool.connections.rend(),
+                                         [&](const IdleConnection& idle)
+                                         { return (idle.address == address) && (idle.port == port); });
+            if (it == pool.connections.rend())
+                return std::nullopt;
+
+            connection = std::move(it->connection);
+            pool.connections.erase(std::next(it).base());
+        }
+
+        // An idle connection has nothing to receive, unless the server closed it
+        char        byte     = 0;
+        std::size_t received = 0;
+        connection->socket.setBlocking(false);
+        const sf::Socket::Status status = connection->socket.receive(&byte, 1, received);
+        connection->socket.setBlocking(true);
+
+        if ((status == sf::Socket::Status::NotReady) && connection->pending.empty())
+            return connection;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+// Give back a connection to the pool, for the next request to the same host
+void releaseConnection(sf::IpAddress address, unsigned short port, Connection&& connection)
+{
+    Pool&                 pool = getPool();
+    const std::lock_guard lock(pool.mutex);
+
+    if (pool.maxPerHost == 0)
+        return;
+
+    // Drop the oldest connection to the host if there are too many already
+    const auto sameHost = [&](const IdleConnection& idle) { return (idle.address == address) && (idle.port == port); };
+    if (static_cast<std::size_t>(std::count_if(pool.connections.begin(), pool.connections.end(), sameHost)) >=
+        pool.maxPerHost)
+        pool.connections.erase(std::find_if(pool.connections.begin(), pool.connections.end(), sameHost));
+
+    pool.connections.push_back({address, port, std::move(connection)});
+}
+
+
+////////////////////////////////////////////////////////////
+struct Header
+{
+    std::size_t size{};        //!< Size of the header, including the empty line that ends it
+    int         status{};      //!< Status code
+    bool        http10{};      //!< Is the response in HTTP/1.0?
+    bool        chunked{};     //!< Is the body sent in chunks?
+    std::string contentLength; //!< Value of the Content-Length field
+    std::string connection;    //!< Value of the Connection field, in lower case
+};
+
+
+////////////////////////////////////////////////////////////
+// Parse the fields that determine the size of a response, once its header was entirely received
+std::optional<Header> parseHeader(const std::string& data)
+{
+    const std::size_t end = data.find("\r\n\r\n");
+    if (end == std::string::npos)
+        return std::nullopt;
+
+    Header             header;
+    std::istringstream in(data.substr(0, end));
+    std::string        version;
+    in >> version >> header.status;
+    header.size   = end + 4;
+    header.http10 = sf::toLower(version) == "http/1.0";
+
+    std::string line;
+    while (std::getline(in, line))
+    {
+        const std::size_t colon = line.find(':');
+        if (colon == std::string::npos)
+            continue;
+
+        const std::string field = sf::toLower(line.substr(0, colon));
+        std::string       value = line.substr(colon + 1);
+        value.erase(0, value.find_first_not_of(" \t"));
+        value.erase(value.find_last_not_of(" \t\r") + 1);
+
+        if (field == "content-length")
+            header.contentLength = value;
+        else if (field == "transfer-encoding")
+            header.chunked = sf::toLower(value) == "chunked";
+        else if (field == "connection")
+            header.connection = sf::toLower(value);
+    }
+
+    return header;
+}
+
+
+////////////////////////////////////////////////////////////
+struct ReceivedResponse
+{
+    std::string                               header;       //!< Status line and fields of the response
+    std::string                               trailers;     //!< Trailer fields that follow a chunked body
+    bool                                      persistent{}; //!< Can the connection be used for another request?
+    std::optional<sf::Http::Response::Status> failure;      //!< Why the body is incomplete, if it was cut short or malformed
+};
+
+using HeaderHandler = std::function<bool(const std::string& header)>;
+using BodyHandler   = std::function<bool(const char* data, std::size_t size)>;
+
+
+////////////////////////////////////////////////////////////
+// Receive the next response on a connection, and pass its header then the pieces of its decoded body to
+// the handlers as soon as they arrive; return nothing if the connection was closed before the response started
+std::optional<ReceivedResponse> receiveResponse(Connection&          connection,
+                                                bool                 headRequest,
+                                                const HeaderHandler& onHeader,
+                                                const BodyHandler&   onBody)
+{
+    std::vector<char> buffer(receiveBufferSize);
+    bool              stopped   = false; // The handler stopped the transfer
+    bool              malformed = false; // The framing of the body is invalid
+
+    // Pass a piece of the body to the handler, and remember if it stopped the transfer
+    const auto deliver = [&](const char* data, std::size_t size)
+    {
+        stopped = !onBody(data, size);
+        return !stopped;
+    };
+
+    // Append more data to the pending bytes; return false if the connection was closed
+    const auto receiveMore = [&]
+    {
+        std::size_t received = 0;
+        if (connection.socket.receive(buffer.data(), buffer.size(), received) != sf::Socket::Status::Done)
+            return false;
+
+        connection.pending.append(buffer.data(), received);
+        return true;
+    };
+
+    // Pass the next bytes of the body to the handler, or all of them until the connection is closed if
+    // no length is given; return false if the body was cut short or the handler stopped the transfer
+    const auto forward = [&](std::optional<std::size_t> length)
+    {
+        std::size_t remaining = length.value_or(std::numeric_limits<std::size_t>::max());
+
+        // Bytes that were already received come first
+        if ((remaining > 0) && !connection.pending.empty())
+        {
+            const std::size_t size = std::min(remaining, connection.pending.size());
+            if (!deliver(connection.pending.data(), size))
+                return false;
+
+            connection.pending.erase(0, size);
+            remaining -= size;
+        }
+
+        // Then the next ones go straight from the socket to the handler
+        while (remaining > 0)
+        {
+            std::size_t received = 0;
+            if (connection.socket.receive(buffer.data(), buffer.size(), received) != sf::Socket::Status::Done)
+                return !length.has_value();
+
+            const std::size_t size = std::min(remaining, received);
+            if (!deliver(buffer.data(), size))
+                return false;
+
+            // Keep what belongs to the next response
+            connection.pending.append(buffer.data() + size, received - size);
+            remaining -= size;
+        }
+
+        return true;
+    };
+
+    // Pass the chunks of a chunked body to the handler as they arrive, and collect the trailer fields
+    const auto forwardChunks = [&](std::string& trailers)
+    {
+        for (;;)
+        {
+            std::size_t lineEnd = 0;
+            while ((lineEnd = connection.pending.find("\r\n")) == std::string::npos)
+            {
+                if (!receiveMore())
+                    return false;
+            }
+
+            const std::string& line   = connection.pending;
+            std::size_t        length = 0;
+            std::size_t        i      = 0;
+            for (; (i < lineEnd) && std::isxdigit(static_cast<unsigned char>(line[i])); ++i)
+            {
+                if (length > std::numeric_limits<std::size_t>::max() / 16)
+                {
+                    malformed = true;
+                    return false;
+                }
+
+                const char digit = static_cast<char>(std::tolower(static_cast<unsigned char>(line[i])));
+                length = length * 16 + static_cast<std::size_t>((digit <= '9') ? (digit - '0') : (digit - 'a' + 10));
+            }
+
+            // A chunk size without any digit isn't the last chunk, it is garbage
+            if (i == 0)
+            {
+                malformed = true;
+                return false;
+            }
+            connection.pending.erase(0, lineEnd + 2);
+
+            // The last chunk is followed by optional trailer fields, then an empty line
+            if (length == 0)
+            {
+                std::size_t trailersEnd = 0;
+                while ((connection.pending.compare(0, 2, "\r\n") != 0) &&
+                       ((trailersEnd = connection.pending.find("\r\n\r\n")) == std::string::npos))
+                {
+                    if (!receiveMore())
+                        return false;
+                }
+
+                if (trailersEnd > 0)
+                {
+                    trailers = connection.pending.substr(0, trailersEnd + 2);
+                    connection.pending.erase(0, trailersEnd + 2);
+                }
+                connection.pending.erase(0, 2);
+                return true;
+            }
+
+            if (!forward(length))
+                return false;
+
+            // Skip the line break that follows the chunk data
+            while (connection.pending.size() < 2)
+            {
+                if (!receiveMore())
+                    return false;
+            }
+            connection.pending.erase(0, 2);
+        }
+    };
+
+    // Wait for the header, skipping interim responses (such as "100 Continue"): the final one follows
+    std::optional<Header> header;
+    while (!(header = parseHeader(connection.pending)) || ((header->status >= 100) && (header->status < 200) &&
+                                                           (header->status != 101)))
+    {
+        if (header)
+        {
+            connection.pending.erase(0, header->size);
+        }
+        else if (!receiveMore())
+        {
+            // The connection was closed: whatever was received is the response
+            if (connection.pending.empty())
+                return std::nullopt;
+
+            ReceivedResponse response;
+            response.header = std::move(connection.pending);
+            connection.pending.clear();
+            onHeader(response.header);
+            return response;
+        }
+    }
+
+    ReceivedResponse response;
+    response.header = connection.pending.substr(0, header->size);
+    connection.pending.erase(0, header->size);
+    if (!onHeader(response.header))
+        return response;
+
+    // Find how the body ends, if it doesn't last until the connection is closed
+    bool complete = true;
+    if (headRequest || ((header->status >= 100) && (header->status < 200)) || (header->status == 204) ||
+        (header->status == 304))
+    {
+        // No body
+    }
+    else if (header->chunked)
+    {
+        complete = forwardChunks(response.trailers);
+    }
+    else if (!header->contentLength.empty() &&
+             std::all_of(header->contentLength.begin(),
+                         header->contentLength.end(),
+                         [](char c) { return std::isdigit(static_cast<unsigned char>(c)) != 0; }))
+    {
+        std::size_t length = 0;
+        std::istringstream(header->contentLength) >> length;
+        complete = forward(length);
+    }
+    else
+    {
+        forward(std::nullopt);
+        return response;
+    }
+
+    // A body that ends before its announced end must not pass for a complete one
+    if (!complete && !stopped)
+        response.failure = malformed ? sf::Http::Response::Status::InvalidResponse
+                                     : sf::Http::Response::Status::ConnectionFailed;
+
+    response.persistent = complete && (header->connection != "close") &&
+                          (!header->http10 || (header->connection == "keep-alive"));
+    return response;
+}
+} // namespace HttpImpl
+} // namespace
+
+
 namespace sf
 {
 ////////////////////////////////////////////////////////////
@@ -325,75 +729,238 @@ void Http::setHost(const std::string& host, unsigned short port)
     if (!m_hostName.empty() && (*m_hostName.rbegin() == '/'))
         m_hostName.erase(m_hostName.size() - 1);
 
-    m_host = IpAddress::resolve(m_hostName);
+    // Resolve the host name in the background, the first request waits for it
+    m_addresses.clear();
+    m_resolution = IpAddress::resolveAsync(m_hostName);
+}
+
+
+////////////////////////////////////////////////////////////
+void Http::setKeepAlive(bool keepAlive)
+{
+    m_keepAlive = keepAlive;
+}
+
+
+////////////////////////////////////////////////////////////
+bool Http::getKeepAlive() const
+{
+    return m_keepAlive;
 }
 
 
 ////////////////////////////////////////////////////////////
 Http::Response Http::sendRequest(const Http::Request& request, Time timeout)
 {
-    // First make sure that the request is valid -- add missing mandatory fields
-    Request toSend(request);
-    if (!toSend.hasField("From"))
-    {
-        toSend.setField("From", "user@sfml-dev.org");
-    }
-    if (!toSend.hasField("User-Agent"))
-    {
-        toSend.setField("User-Agent", "libsfml-network/3.x");
-    }
-    if (!toSend.hasField("Host"))
-    {
-        toSend.setField("Host", m_hostName);
-    }
-    if (!toSend.hasField("Content-Length"))
+    return std::move(sendRequests({request}, timeout).front());
+}
+
+
+////////////////////////////////////////////////////////////
+Http::Response Http::sendRequest(const Request&        request,
+                                 const BodyCallback&   onBody,
+                                 const HeaderCallback& onHeader,
+                                 Time                  timeout)
+{
+    return std::move(sendAndReceive({request}, timeout, onHeader, onBody).front());
+}
+
+
+////////////////////////////////////////////////////////////
+Http::Response Http::sendRequest(const Request& request, std::ostream& body, Time timeout)
+{
+    const auto write = [&body](const char* data, std::size_t size)
+    { return static_cast<bool>(body.write(data, static_cast<std::streamsize>(size))); };
+
+    return sendRequest(request, write, {}, timeout);
+}
+
+
+////////////////////////////////////////////////////////////
+std::vector<Http::Response> Http::sendRequests(const std::vector<Request>& requests, Time timeout)
+{
+    return sendAndReceive(requests, timeout, {}, {});
+}
+
+
+////////////////////////////////////////////////////////////
+std::vector<Http::Response> Http::sendAndReceive(const std::vector<Request>& requests,
+                                                 Time                        timeout,
+                                                 const HeaderCallback&       onHeader,
+                                                 const BodyCallback&         onBody)
+{
+    // Prepare the responses
+    std::vector<Response> responses(requests.size());
+
+    // Wait for the resolution of the host name, within the time limit shared with the connection
+    const Clock clock;
+    if (m_resolution.valid())
     {
-        std::ostringstream out;
-        out << toSend.m_body.size();
-        toSend.setField("Content-Length", out.str());
+        if ((timeout != Time::Zero) && (m_resolution.wait_for(timeout.toDuration()) != std::future_status::ready))
+            return responses;
+
+        m_addresses = m_resolution.get();
     }
-    if ((toSend.m_method == Request::Method::Post) && !toSend.hasField("Content-Type"))
+
+    if (m_addresses.empty())
+        return responses;
+
+    // First make sure that the requests are valid -- add missing mandatory fields
+    std::vector<std::string> prepared;
+    std::vector<bool>        closing;
+    prepared.reserve(requests.size());
+    closing.reserve(requests.size());
+    for (const Request& request : requests)
     {
-        toSend.setField("Content-Type", "application/x-www-form-urlencoded");
+        Request toSend(request);
+        if (!toSend.hasField("From"))
+        {
+            toSend.setField("From", "user@sfml-dev.org");
+        }
+        if (!toSend.hasField("User-Agent"))
+        {
+            toSend.setField("User-Agent", "libsfml-network/3.x");
+        }
+        if (!toSend.hasField("Host"))
+        {
+            toSend.setField("Host", m_hostName);
+        }
+        if (!toSend.hasField("Content-Length"))
+        {
+            std::ostringstream out;
+            out << toSend.m_body.size();
+            toSend.setField("Content-Length", out.str());
+        }
+        if ((toSend.m_method == Request::Method::Post) && !toSend.hasField("Content-Type"))
+        {
+            toSend.setField("Content-Type", "application/x-www-form-urlencoded");
+        }
+        if (!toSend.hasField("Connection"))
+        {
+            // Persistent connections are the default since HTTP/1.1, and an extension before
+            const bool http11 = toSend.m_majorVersion * 10 + toSend.m_minorVersion >= 11;
+            if (!m_keepAlive && http11)
+                toSend.setField("Connection", "close");
+            else if (m_keepAlive && !http11)
+                toSend.setField("Connection", "keep-alive");
+        }
+
+        prepared.push_back(toSend.prepare());
+        const auto connectionField = toSend.m_fields.find("connection");
+        closing.push_back((connectionField != toSend.m_fields.end()) && (toLower(connectionField->second) == "close"));
     }
-    if ((toSend.m_majorVersion * 10 + toSend.m_minorVersion >= 11) && !toSend.hasField("Connection"))
+
+    std::size_t next = 0;
+    while (next < requests.size())
     {
-        toSend.setField("Connection", "close");
-    }
+        // Reuse an idle connection to the host if possible, or connect a new one
+        std::optional<HttpImpl::Connection> connection = HttpImpl::takeConnection(m_addresses.front(), m_port);
+        const bool                          reused     = connection.has_value();
+        if (!reused)
+        {
+            connection.emplace();
+            if (!HttpImpl::connect(connection->socket, m_addresses, m_port, timeout, clock))
+                break;
+        }
 
-    // Prepare the response
-    Response received;
+        // Pipeline the remaining requests, up to the first one that closes the connection
+        const std::size_t first = next;
+        std::size_t       last  = first + 1;
+        if (m_keepAlive)
+        {
+            while ((last < requests.size()) && !closing[last - 1])
+                ++last;
+        }
 
-    // Connect the socket to the host
-    if (m_connection.connect(m_host.value(), m_port, timeout) == Socket::Status::Done)
-    {
-        // Convert the request to string and send it through the connected socket
-        const std::string requestStr = toSend.prepare();
+        std::string pipelined;
+        for (std::size_t i = first; i < last; ++i)
+            pipelined += prepared[i];
 
-        if (!requestStr.empty())
+        // Receive the responses in order, until the server closes the connection
+        bool persistent = false;
+        if (connection->socket.send(pipelined.data(), pipelined.size()) == Socket::Status::Done)
         {
-            // Send it through the socket
-            if (m_connection.send(requestStr.c_str(), requestStr.size()) == Socket::Status::Done)
+            while (next < last)
             {
-                // Wait for the server's response
-                std::string            receivedStr;
-                std::size_t            size = 0;
-                std::array<char, 1024> buffer{};
-                while (m_connection.receive(buffer.data(), buffer.size(), size) == Socket::Status::Done)
-                {
-                    receivedStr.append(buffer.data(), buffer.data() + size);
-                }
-
-                // Build the Response object from the received data
-                received.parse(receivedStr);
+                // Parse the header as soon as it arrives, and store the body unless it is streamed
+                Response&  response    = responses[next];
+                const bool headRequest = requests[next].m_method == Request::Method::Head;
+                const auto received    = HttpImpl::receiveResponse(
+                    *connection,
+                    headRequest,
+                    [&](const std::string& header)
+                    {
+                        response = Response();
+                        response.parse(header);
+                        return !onHeader || onHeader(response);
+                    },
+                    [&](const char* data, std::size_t size)
+                    {
+                        if (onBody)
+                            return onBody(data, size);
+
+                        response.m_body.append(data, size);
+                        return true;
+                    });
+                if (!received)
+                    break;
+
+                std::istringstream trailers(received->trailers);
+                response.parseFields(trailers);
+                if (received->failure)
+                    response.m_status = *received->failure;
+                persistent = m_keepAlive && received->persistent && !closing[next];
+                ++next;
+
+                if (!persistent)
+                    break;
             }
         }
 
-        // Close the connection
-        m_connection.disconnect();
+        if (persistent && (next == last))
+            HttpImpl::releaseConnection(m_addresses.front(), m_port, std::move(*connection));
+
+        // The server may have processed a request before closing the connection without answering
+        // it, so it is only sent again if repeating it is harmless
+        if ((next < last) && !HttpImpl::isIdempotent(requests[next].m_method))
+            break;
+
+        // A fresh connection that gives no response won't do better the next time; an idle
+        // one may just have been closed by the server, in which case a new one is tried
+        if ((next == first) && !reused)
+            break;
+    }
+
+    return responses;
+}
+
+
+////////////////////////////////////////////////////////////
+void Http::setMaxIdleConnections(std::size_t count)
+{
+    HttpImpl::Pool&       pool = HttpImpl::getPool();
+    const std::lock_guard lock(pool.mutex);
+    pool.maxPerHost = count;
+
+    // Close the connections beyond the new limit, oldest first
+    for (auto it = pool.connections.begin(); it != pool.connections.end();)
+    {
+        const auto sameHost = [&](const HttpImpl::IdleConnection& idle)
+        { return (idle.address == it->address) && (idle.port == it->port); };
+        if (static_cast<std::size_t>(std::count_if(it, pool.connections.end(), sameHost)) > count)
+            it = pool.connections.erase(it);
+        else
+            ++it;
     }
+}
 
-    return received;
+
+////////////////////////////////////////////////////////////
+void Http::closeIdleConnections()
+{
+    HttpImpl::Pool&       pool = HttpImpl::getPool();
+    const std::lock_guard lock(pool.mutex);
+    pool.connections.clear();
 }
 
 } // namespace sf
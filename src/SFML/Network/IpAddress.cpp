@@ -30,13 +30,176 @@
 #include <SFML/Network/SocketImpl.hpp>
 
 #include <SFML/System/Err.hpp>
+#include <SFML/System/Utils.hpp>
 
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
 #include <istream>
+#include <memory>
+#include <mutex>
 #include <ostream>
+#include <thread>
+#include <unordered_map>
+#include <utility>
 
+#include <cstddef>
 #include <cstring>
 
 
+namespace
+{
+namespace IpAddressImpl
+{
+// Maximum number of threads resolving host names at the same time
+constexpr std::size_t maxResolverThreads = 4;
+
+// Number of cached names above which expired entries are removed
+constexpr std::size_t cachePurgeThreshold = 256;
+
+////////////////////////////////////////////////////////////
+struct CacheEntry
+{
+    std::vector<sf::IpAddress>            addresses; //!< Addresses of the host, empty if the resolution failed
+    std::chrono::steady_clock::time_point expiry;    //!< Time at which the entry must be resolved again
+};
+
+
+////////////////////////////////////////////////////////////
+struct Resolver;
+using Task = std::packaged_task<std::vector<sf::IpAddress>(Resolver&)>;
+
+
+////////////////////////////////////////////////////////////
+struct Resolver
+{
+    std::mutex                                  mutex;                             //!< Mutex protecting the resolver
+    std::condition_variable                     condition;                         //!< Condition signaling new tasks
+    std::deque<Task>                            tasks;                             //!< Resolutions waiting for a thread
+    std::size_t                                 threads{};                         //!< Number of resolver threads
+    std::size_t                                 idleThreads{};                     //!< Number of threads waiting for a task
+    std::unordered_map<std::string, CacheEntry> cache;                             //!< Resolved names, in lower case
+    sf::Time                                    positiveDuration{sf::seconds(60)}; //!< How long successful resolutions are cached
+    sf::Time                                    negativeDuration{sf::seconds(10)}; //!< How long failed resolutions are cached
+};
+
+
+////////////////////////////////////////////////////////////
+// The resolver threads are detached and share the ownership, so that it outlives them
+const std::shared_ptr<Resolver>& getResolver()
+{
+    static const auto resolver = std::make_shared<Resolver>();
+    return resolver;
+}
+
+
+////////////////////////////////////////////////////////////
+// Convert a decimal address ("xxx.xxx.xxx.xxx"), without looking up host names
+std::optional<sf::IpAddress> parseAddress(const std::string& address)
+{
+    if (address == "255.255.255.255")
+    {
+        // The broadcast address needs to be handled explicitly,
+        // because it is also the value returned by inet_addr on error
+        return sf::IpAddress::Broadcast;
+    }
+
+    if (address == "0.0.0.0")
+        return sf::IpAddress::Any;
+
+    if (const std::uint32_t ip = inet_addr(address.c_str()); ip != INADDR_NONE)
+        return sf::IpAddress(ntohl(ip));
+
+    return std::nullopt;
+}
+
+
+////////////////////////////////////////////////////////////
+// Get the cached addresses of a host, if they didn't expire
+std::optional<std::vector<sf::IpAddress>> findCached(Resolver& resolver, const std::string& name)
+{
+    const std::lock_guard lock(resolver.mutex);
+
+    const auto it = resolver.cache.find(name);
+    if ((it == resolver.cache.end()) || (it->second.expiry <= std::chrono::steady_clock::now()))
+        return std::nullopt;
+
+    return it->second.addresses;
+}
+
+
+////////////////////////////////////////////////////////////
+// Look up the addresses of a host, or take them from the cache
+std::vector<sf::IpAddress> resolveName(Resolver& resolver, const std::string& name)
+{
+    if (std::optional<std::vector<sf::IpAddress>> cached = findCached(resolver, name))
+        return std::move(*cached);
+
+    std::vector<sf::IpAddress> addresses;
+
+    addrinfo hints{}; // Zero-initialize
+    hints.ai_family   = AF_INET;
+    hints.ai_socktype = SOCK_STREAM; // Avoid getting each address once per socket type
+
+    addrinfo* result = nullptr;
+    if (getaddrinfo(name.c_str(), nullptr, &hints, &result) == 0)
+    {
+        for (const addrinfo* info = result; info != nullptr; info = info->ai_next)
+        {
+            sockaddr_in sin{};
+            std::memcpy(&sin, info->ai_addr, sizeof(sin));
+
+            const sf::IpAddress address(ntohl(sin.sin_addr.s_addr));
+            if (std::find(addresses.begin(), addresses.end(), address) == addresses.end())
+                addresses.push_back(address);
+        }
+
+        freeaddrinfo(result);
+    }
+
+    // The system resolver doesn't tell how long the answer is valid, so the entries are kept for a fixed duration
+    const std::lock_guard lock(resolver.mutex);
+    const sf::Time        duration = addresses.empty() ? resolver.negativeDuration : resolver.positiveDuration;
+    if (duration > sf::Time::Zero)
+    {
+        const auto now = std::chrono::steady_clock::now();
+        if (resolver.cache.size() >= cachePurgeThreshold)
+        {
+            for (auto it = resolver.cache.begin(); it != resolver.cache.end();)
+                it = (it->second.expiry <= now) ? resolver.cache.erase(it) : std::next(it);
+        }
+
+        resolver.cache[name] = {addresses, now + duration.toDuration()};
+    }
+
+    return addresses;
+}
+
+
+////////////////////////////////////////////////////////////
+// Run the resolutions queued by resolveAsync
+void runResolverThread(const std::shared_ptr<Resolver>& resolver)
+{
+    std::unique_lock lock(resolver->mutex);
+    for (;;)
+    {
+        ++resolver->idleThreads;
+        resolver->condition.wait(lock, [&] { return !resolver->tasks.empty(); });
+        --resolver->idleThreads;
+
+        Task task = std::move(resolver->tasks.front());
+        resolver->tasks.pop_front();
+
+        lock.unlock();
+        task(*resolver);
+        lock.lock();
+    }
+}
+} // namespace IpAddressImpl
+} // namespace
+
+
 namespace sf
 {
 ////////////////////////////////////////////////////////////
@@ -48,46 +211,91 @@ const IpAddress IpAddress::Broadcast(255, 255, 255, 255);
 ////////////////////////////////////////////////////////////
 std::optional<IpAddress> IpAddress::resolve(std::string_view address)
 {
-    using namespace std::string_view_literals;
-
-    if (address.empty())
+    const std::vector<IpAddress> addresses = resolveAll(address);
+    if (addresses.empty())
     {
         // Not generating en error message here as resolution failure is a valid outcome.
         return std::nullopt;
     }
 
-    if (address == "255.255.255.255"sv)
-    {
-        // The broadcast address needs to be handled explicitly,
-        // because it is also the value returned by inet_addr on error
-        return Broadcast;
-    }
+    return addresses.front();
+}
 
-    if (address == "0.0.0.0"sv)
-        return Any;
+
+////////////////////////////////////////////////////////////
+std::vector<IpAddress> IpAddress::resolveAll(std::string_view address)
+{
+    if (address.empty())
+        return {};
 
     // Try to convert the address as a byte representation ("xxx.xxx.xxx.xxx")
-    if (const std::uint32_t ip = inet_addr(address.data()); ip != INADDR_NONE)
-        return IpAddress(ntohl(ip));
+    const std::string name(address);
+    if (const std::optional<IpAddress> ip = IpAddressImpl::parseAddress(name))
+        return {*ip};
 
     // Not a valid address, try to convert it as a host name
-    addrinfo hints{}; // Zero-initialize
-    hints.ai_family = AF_INET;
+    return IpAddressImpl::resolveName(*IpAddressImpl::getResolver(), toLower(name));
+}
 
-    addrinfo* result = nullptr;
-    if (getaddrinfo(address.data(), nullptr, &hints, &result) == 0 && result != nullptr)
+
+////////////////////////////////////////////////////////////
+std::future<std::vector<IpAddress>> IpAddress::resolveAsync(std::string_view address)
+{
+    const std::string name = toLower(std::string(address));
+
+    const std::shared_ptr<IpAddressImpl::Resolver>& resolver = IpAddressImpl::getResolver();
+
+    // Addresses and cached host names don't need to wait for a thread
+    std::optional<std::vector<IpAddress>> addresses;
+    if (name.empty())
+        addresses.emplace();
+    else if (const std::optional<IpAddress> ip = IpAddressImpl::parseAddress(name))
+        addresses.emplace(1, *ip);
+    else
+        addresses = IpAddressImpl::findCached(*resolver, name);
+
+    if (addresses)
     {
-        sockaddr_in sin{};
-        std::memcpy(&sin, result->ai_addr, sizeof(*result->ai_addr));
+        std::promise<std::vector<IpAddress>> promise;
+        promise.set_value(std::move(*addresses));
+        return promise.get_future();
+    }
 
-        const std::uint32_t ip = sin.sin_addr.s_addr;
-        freeaddrinfo(result);
+    // Queue the resolution, and start a new thread if all the others are busy; the thread runs
+    // it with its own reference to the resolver, as the static one is destroyed at exit
+    IpAddressImpl::Task task([name](IpAddressImpl::Resolver& threadResolver)
+                             { return IpAddressImpl::resolveName(threadResolver, name); });
+    std::future<std::vector<IpAddress>> result = task.get_future();
 
-        return IpAddress(ntohl(ip));
+    const std::lock_guard lock(resolver->mutex);
+    resolver->tasks.push_back(std::move(task));
+    if ((resolver->idleThreads < resolver->tasks.size()) && (resolver->threads < IpAddressImpl::maxResolverThreads))
+    {
+        ++resolver->threads;
+        std::thread([resolver] { IpAddressImpl::runResolverThread(resolver); }).detach();
     }
+    resolver->condition.notify_one();
 
-    // Not generating en error message here as resolution failure is a valid outcome.
-    return std::nullopt;
+    return result;
+}
+
+
+////////////////////////////////////////////////////////////
+void IpAddress::setResolverCacheDuration(Time positive, Time negative)
+{
+    IpAddressImpl::Resolver& resolver = *IpAddressImpl::getResolver();
+    const std::lock_guard    lock(resolver.mutex);
+    resolver.positiveDuration = positive;
+    resolver.negativeDuration = negative;
+}
+
+
+////////////////////////////////////////////////////////////
+void IpAddress::clearResolverCache()
+{
+    IpAddressImpl::Resolver& resolver = *IpAddressImpl::getResolver();
+    const std::lock_guard    lock(resolver.mutex);
+    resolver.cache.clear();
 }
 
 
@@ -0,0 +1,898 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Network/NetworkReactor.hpp>
+#include <SFML/Network/Packet.hpp>
+#include <SFML/Network/SocketImpl.hpp>
+#include <SFML/Network/TcpListener.hpp>
+#include <SFML/Network/TcpSocket.hpp>
+#include <SFML/Network/UdpSocket.hpp>
+
+#include <SFML/System/Err.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <mutex>
+#include <ostream>
+#include <set>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(SFML_SYSTEM_LINUX) || defined(SFML_SYSTEM_ANDROID)
+#define SFML_NETWORK_REACTOR_EPOLL
+#endif
+
+#if defined(SFML_NETWORK_REACTOR_EPOLL)
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+
+#include <cerrno>
+#include <cstring>
+#else
+#include <SFML/System/Sleep.hpp>
+#endif
+
+#ifdef _MSC_VER
+#pragma warning(disable : 4127) // "conditional expression is constant" generated by the FD_SET macro
+#endif
+
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+// Call to the handler of an operation, with the result of the operation bound to it
+using Completion = std::function<void()>;
+
+// Attempt of an operation, made whenever its socket is ready;
+// returns true once the operation is finished and its completion has been added
+using Operation = std::function<bool(std::vector<Completion>&)>;
+
+// Maximum number of events handled by a thread in a single iteration of the loop
+constexpr std::size_t maxEvents = 64;
+
+
+////////////////////////////////////////////////////////////
+struct Event
+{
+    sf::SocketHandle handle{};   //!< Socket that is ready
+    bool             readable{}; //!< Can the socket receive (or did it fail)?
+    bool             writable{}; //!< Can the socket send (or did it fail)?
+    bool             wakeup{};   //!< Is this a wakeup of the loop rather than a socket event?
+};
+
+
+#if defined(SFML_NETWORK_REACTOR_EPOLL)
+
+////////////////////////////////////////////////////////////
+/// \brief Readiness notification built on epoll
+///
+/// Sockets are registered in one-shot mode, so that each
+/// readiness is reported to a single thread, and have to
+/// be armed again once their operations have been attempted.
+///
+////////////////////////////////////////////////////////////
+class Poller
+{
+public:
+    Poller() : m_epollFd(epoll_create1(EPOLL_CLOEXEC)), m_eventFd(eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK))
+    {
+        if ((m_epollFd < 0) || (m_eventFd < 0))
+        {
+            sf::err() << "Failed to create the network reactor: " << std::strerror(errno) << std::endl;
+            return;
+        }
+
+        // The event file descriptor is level-triggered: it wakes up every thread until it is drained
+        epoll_event event{};
+        event.events  = EPOLLIN;
+        event.data.fd = m_eventFd;
+        epoll_ctl(m_epollFd, EPOLL_CTL_ADD, m_eventFd, &event);
+    }
+
+    ~Poller()
+    {
+        if (m_eventFd >= 0)
+            ::close(m_eventFd);
+        if (m_epollFd >= 0)
+            ::close(m_epollFd);
+    }
+
+    Poller(const Poller&)            = delete;
+    Poller& operator=(const Poller&) = delete;
+
+    [[nodiscard]] bool arm(sf::SocketHandle handle, bool receive, bool send)
+    {
+        epoll_event event{};
+        event.events  = EPOLLONESHOT | (receive ? EPOLLIN | EPOLLRDHUP : 0u) | (send ? EPOLLOUT : 0u);
+        event.data.fd = handle;
+
+        if (epoll_ctl(m_epollFd, EPOLL_CTL_MOD, handle, &event) == 0)
+            return true;
+
+        // First use of the socket, or a reused handle whose previous socket was closed
+        return (errno == ENOENT) && (epoll_ctl(m_epollFd, EPOLL_CTL_ADD, handle, &event) == 0);
+    }
+
+    void remove(sf::SocketHandle handle)
+    {
+        // Fails harmlessly if the socket was already closed
+        epoll_event event{};
+        epoll_ctl(m_epollFd, EPOLL_CTL_DEL, handle, &event);
+    }
+
+    void wait(std::vector<Event>& events, int timeoutMs)
+    {
+        std::array<epoll_event, maxEvents> buffer{};
+        const int count = epoll_wait(m_epollFd, buffer.data(), static_cast<int>(buffer.size()), timeoutMs);
+
+        events.clear();
+        for (int i = 0; i < count; ++i)
+        {
+            const epoll_event& event = buffer[static_cast<std::size_t>(i)];
+            if (event.data.fd == m_eventFd)
+            {
+                events.push_back({sf::priv::SocketImpl::invalidSocket(), false, false, true});
+            }
+            else
+            {
+                // Errors and hang-ups are reported as readiness, so that the next attempt reveals them
+                const bool failed = (event.events & (EPOLLERR | EPOLLHUP)) != 0;
+                events.push_back({event.data.fd,
+                                  failed || (event.events & (EPOLLIN | EPOLLRDHUP)) != 0,
+                                  failed || (event.events & EPOLLOUT) != 0,
+                                  false});
+            }
+        }
+    }
+
+    void wakeup()
+    {
+        const std::uint64_t value = 1;
+        [[maybe_unused]] const auto result = ::write(m_eventFd, &value, sizeof(value));
+    }
+
+    void drain()
+    {
+        std::uint64_t               value  = 0;
+        [[maybe_unused]] const auto result = ::read(m_eventFd, &value, sizeof(value));
+    }
+
+private:
+    int m_epollFd; //!< Epoll instance watching the sockets
+    int m_eventFd; //!< Event file descriptor used to wake up the threads waiting on the epoll instance
+};
+
+#else
+
+////////////////////////////////////////////////////////////
+/// \brief Readiness notification built on select
+///
+/// select can't be interrupted portably, so it waits in short
+/// slices to notice new operations and wakeups. Sockets are
+/// disarmed once reported, like with epoll's one-shot mode.
+///
+////////////////////////////////////////////////////////////
+class Poller
+{
+public:
+    [[nodiscard]] bool arm(sf::SocketHandle handle, bool receive, bool send)
+    {
+        const std::lock_guard lock(m_mutex);
+        m_armed[handle] = {receive, send};
+        return true;
+    }
+
+    void remove(sf::SocketHandle handle)
+    {
+        const std::lock_guard lock(m_mutex);
+        m_armed.erase(handle);
+    }
+
+    void wait(std::vector<Event>& events, int timeoutMs)
+    {
+        events.clear();
+
+        if (m_woken)
+        {
+            events.push_back({sf::priv::SocketImpl::invalidSocket(), false, false, true});
+            return;
+        }
+
+        constexpr int sliceMs = 10;
+        const int     waitMs  = (timeoutMs < 0) ? sliceMs : std::min(timeoutMs, sliceMs);
+
+        fd_set receiveSet;
+        fd_set sendSet;
+        FD_ZERO(&receiveSet);
+        FD_ZERO(&sendSet);
+
+        int maxSocket   = 0;
+        int socketCount = 0;
+
+        {
+            const std::lock_guard lock(m_mutex);
+            for (const auto& [handle, interest] : m_armed)
+            {
+
+#if defined(SFML_SYSTEM_WINDOWS)
+
+                if (socketCount >= FD_SETSIZE)
+                    break;
+
+#else
+
+                if (handle >= FD_SETSIZE)
+                    continue;
+
+                maxSocket = std::max(maxSocket, handle);
+
+#endif
+
+                if (interest.first)
+                    FD_SET(handle, &receiveSet);
+                if (interest.second)
+                    FD_SET(handle, &sendSet);
+                ++socketCount;
+            }
+        }
+
+        // select fails on some systems when it has nothing to watch
+        if (socketCount == 0)
+        {
+            sf::sleep(sf::milliseconds(waitMs));
+            return;
+        }
+
+        timeval time{};
+        time.tv_usec = waitMs * 1000;
+
+        // The first parameter is ignored on Windows
+        if (select(maxSocket + 1, &receiveSet, &sendSet, nullptr, &time) <= 0)
+            return;
+
+        const std::lock_guard lock(m_mutex);
+        for (auto it = m_armed.begin(); it != m_armed.end();)
+        {
+            const bool readable = FD_ISSET(it->first, &receiveSet) != 0;
+            const bool writable = FD_ISSET(it->first, &sendSet) != 0;
+
+            if (readable || writable)
+            {
+                events.push_back({it->first, readable, writable, false});
+                it = m_armed.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+    }
+
+    void wakeup()
+    {
+        m_woken = true;
+    }
+
+    void drain()
+    {
+        m_woken = false;
+    }
+
+private:
+    std::mutex                                                  m_mutex;   //!< Mutex protecting the armed sockets
+    std::unordered_map<sf::SocketHandle, std::pair<bool, bool>> m_armed;   //!< Armed sockets, with their receive and send interests
+    std::atomic<bool>                                           m_woken{}; //!< Has the loop been woken up?
+};
+
+#endif
+
+
+////////////////////////////////////////////////////////////
+Completion makeCompletion(const sf::NetworkReactor::StatusHandler& handler, sf::Socket::Status status)
+{
+    return [handler, status]
+    {
+        if (handler)
+            handler(status);
+    };
+}
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+struct NetworkReactor::Impl
+{
+    struct SocketState
+    {
+        std::mutex            mutex;       //!< Mutex protecting the state, held while operations are attempted
+        std::deque<Operation> receptions;  //!< Pending receptions (and accepts), in order
+        std::deque<Operation> sends;       //!< Pending sends (and connects), in order
+        bool                  cancelled{}; //!< Has the socket been removed from the reactor?
+    };
+
+    enum class Queue
+    {
+        Receptions,
+        Sends
+    };
+
+    ////////////////////////////////////////////////////////////
+    void submit(Socket& socket, Queue queue, Operation operation, bool attemptNow = true)
+    {
+        ++outstanding;
+
+        std::vector<Completion> completions;
+        SocketHandle            handle = socket.getNativeHandle();
+
+        // A socket that doesn't exist yet can't be watched, but the attempt may create it (unbound UDP socket)
+        if (handle == priv::SocketImpl::invalidSocket())
+        {
+            if (operation(completions))
+            {
+                postCompletions(std::move(completions));
+                return;
+            }
+
+            handle = socket.getNativeHandle();
+            if (handle == priv::SocketImpl::invalidSocket())
+            {
+                err() << "Failed to start an asynchronous operation, the socket is invalid" << std::endl;
+                finish(1);
+                return;
+            }
+
+            attemptNow = false;
+        }
+
+        const std::shared_ptr<SocketState> state = getState(handle);
+        {
+            const std::lock_guard lock(state->mutex);
+
+            std::deque<Operation>& operations = (queue == Queue::Receptions) ? state->receptions : state->sends;
+
+            // Operations often complete without waiting; only try when nothing is queued before, to preserve ordering
+            if (!attemptNow || !operations.empty() || !operation(completions))
+            {
+                operations.push_back(std::move(operation));
+                arm(handle, *state);
+                return;
+            }
+        }
+
+        postCompletions(std::move(completions));
+    }
+
+    ////////////////////////////////////////////////////////////
+    std::shared_ptr<SocketState> getState(SocketHandle handle)
+    {
+        const std::lock_guard lock(mutex);
+
+        std::shared_ptr<SocketState>& state = sockets[handle];
+        if (!state)
+            state = std::make_shared<SocketState>();
+
+        return state;
+    }
+
+    ////////////////////////////////////////////////////////////
+    void arm(SocketHandle handle, const SocketState& state)
+    {
+        if (state.cancelled || (state.receptions.empty() && state.sends.empty()))
+            return;
+
+        if (!poller.arm(handle, !state.receptions.empty(), !state.sends.empty()))
+            err() << "Failed to watch a socket in the network reactor" << std::endl;
+    }
+
+    ////////////////////////////////////////////////////////////
+    void postCompletions(std::vector<Completion>&& completions)
+    {
+        {
+            const std::lock_guard lock(mutex);
+            posted.insert(posted.end(),
+                          std::make_move_iterator(completions.begin()),
+                          std::make_move_iterator(completions.end()));
+        }
+
+        poller.wakeup();
+    }
+
+    ////////////////////////////////////////////////////////////
+    void processSocket(const Event& event, std::vector<Completion>& completions)
+    {
+        std::shared_ptr<SocketState> state;
+        {
+            const std::lock_guard lock(mutex);
+            const auto            it = sockets.find(event.handle);
+            if (it == sockets.end())
+                return;
+
+            state = it->second;
+        }
+
+        const std::lock_guard lock(state->mutex);
+
+        if (state->cancelled)
+            return;
+
+        if (event.readable)
+            while (!state->receptions.empty() && state->receptions.front()(completions))
+                state->receptions.pop_front();
+
+        if (event.writable)
+            while (!state->sends.empty() && state->sends.front()(completions))
+                state->sends.pop_front();
+
+        arm(event.handle, *state);
+    }
+
+    ////////////////////////////////////////////////////////////
+    int getTimeout()
+    {
+        const std::lock_guard lock(mutex);
+
+        if (timerQueue.empty())
+            return -1;
+
+        // Round up, so that the timer has expired when the wait is over
+        const auto remaining = std::chrono::ceil<std::chrono::milliseconds>(timerQueue.begin()->first - Clock::now());
+        return static_cast<int>(std::clamp<std::chrono::milliseconds::rep>(remaining.count(), 0, INT_MAX));
+    }
+
+    ////////////////////////////////////////////////////////////
+    void collectTimers(std::vector<Completion>& completions)
+    {
+        const std::lock_guard lock(mutex);
+
+        const Clock::time_point now = Clock::now();
+        while (!timerQueue.empty() && (timerQueue.begin()->first <= now))
+        {
+            const auto it = timers.find(timerQueue.begin()->second);
+            completions.push_back(std::move(it->second.second));
+            timers.erase(it);
+            timerQueue.erase(timerQueue.begin());
+        }
+    }
+
+    ////////////////////////////////////////////////////////////
+    void finish(std::size_t count)
+    {
+        // Wake up the threads running the loop so that they notice that there's nothing left to do
+        if ((count > 0) && (outstanding.fetch_sub(count) == count))
+            poller.wakeup();
+    }
+
+    ////////////////////////////////////////////////////////////
+    std::size_t runOnce(std::vector<Event>& events, bool block)
+    {
+        std::vector<Completion> completions;
+        {
+            const std::lock_guard lock(mutex);
+            completions.swap(posted);
+        }
+
+        poller.wait(events, (block && completions.empty()) ? getTimeout() : 0);
+
+        for (const Event& event : events)
+        {
+            if (!event.wakeup)
+                processSocket(event, completions);
+            else if (!stopped && (outstanding > 0))
+                poller.drain();
+        }
+
+        collectTimers(completions);
+
+        for (const Completion& completion : completions)
+            if (completion)
+                completion();
+
+        finish(completions.size());
+        return completions.size();
+    }
+
+    ////////////////////////////////////////////////////////////
+    void runThread()
+    {
+        std::vector<Event> events;
+        events.reserve(maxEvents);
+
+        while (!stopped && (outstanding > 0))
+            runOnce(events, true);
+
+        // The last thread leaving makes the reactor ready to run again
+        if (--runningThreads == 0)
+        {
+            stopped = false;
+            poller.drain();
+        }
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    Poller                                                                poller;           //!< Readiness notification of the sockets
+    std::mutex                                                            mutex;            //!< Mutex protecting the sockets, timers and posted completions
+    std::unordered_map<SocketHandle, std::shared_ptr<SocketState>>        sockets;          //!< State of the sockets, indexed by handle
+    std::set<std::pair<Clock::time_point, TimerId>>                       timerQueue;       //!< Pending timers, sorted by deadline
+    std::unordered_map<TimerId, std::pair<Clock::time_point, Completion>> timers;           //!< Pending timers, indexed by identifier
+    TimerId                                                               nextTimerId{1};   //!< Identifier of the next timer
+    std::vector<Completion>                                               posted;           //!< Completions waiting to be called
+    std::atomic<std::size_t>                                              outstanding{};    //!< Number of pending operations, timers and posted completions
+    std::atomic<bool>                                                     stopped{};        //!< Has the loop been asked to stop?
+    std::atomic<unsigned int>                                             runningThreads{}; //!< Number of threads running the loop
+};
+
+
+////////////////////////////////////////////////////////////
+NetworkReactor::NetworkReactor() : m_impl(std::make_unique<Impl>())
+{
+}
+
+
+////////////////////////////////////////////////////////////
+NetworkReactor::~NetworkReactor() = default;
+
+
+////////////////////////////////////////////////////////////
+void NetworkReactor::asyncAccept(TcpListener& listener, TcpSocket& socket, StatusHandler handler)
+{
+    listener.setBlocking(false);
+    socket.setBlocking(false);
+
+    m_impl->submit(listener,
+                   Impl::Queue::Receptions,
+                   [&listener, &socket, handler = std::move(handler)](std::vector<Completion>& completions)
+                   {
+                       const Socket::Status status = listener.accept(socket);
+                       if (status == Socket::Status::NotReady)
+                           return false;
+
+                       completions.push_back(makeCompletion(handler, status));
+                       return true;
+                   });
+}
+
+
+////////////////////////////////////////////////////////////
+void NetworkReactor::asyncConnect(TcpSocket&     socket,
+                                  IpAddress      remoteAddress,
+                                  unsigned short remotePort,
+                                  StatusHandler  handler)
+{
+    socket.setBlocking(false);
+
+    // Start the connection right away, it doesn't complete immediately in non-blocking mode
+    const Socket::Status status = socket.connect(remoteAddress, remotePort);
+    if (status != Socket::Status::NotReady)
+    {
+        ++m_impl->outstanding;
+        m_impl->postCompletions({makeCompletion(handler, status)});
+        return;
+    }
+
+    // The socket becomes writable once the connection has been either accepted or refused
+    m_impl->submit(
+        socket,
+        Impl::Queue::Sends,
+        [&socket, handler = std::move(handler)](std::vector<Completion>& completions)
+        {
+            const Socket::Status result = socket.getRemoteAddress().has_value() ? Socket::Status::Done
+                                                                                : Socket::Status::Error;
+            completions.push_back(makeCompletion(handler, result));
+            return true;
+        },
+        false);
+}
+
+
+////////////////////////////////////////////////////////////
+void NetworkReactor::asyncSend(TcpSocket& socket, const void* data, std::size_t size, StatusHandler handler)
+{
+    socket.setBlocking(false);
+
+    const auto* begin = static_cast<const std::byte*>(data);
+
+    m_impl->submit(socket,
+                   Impl::Queue::Sends,
+                   [&socket,
+                    buffer = std::vector<std::byte>(begin, begin + (data ? size : 0)),
+                    offset = std::size_t{0},
+                    handler = std::move(handler)](std::vector<Completion>& completions) mutable
+                   {
+                       std::size_t          sent   = 0;
+                       const Socket::Status status = socket.send(buffer.data() + offset, buffer.size() - offset, sent);
+
+                       // Resume from where we stopped once the socket is writable again
+                       if (status == Socket::Status::Partial)
+                           offset += sent;
+                       if ((status == Socket::Status::Partial) || (status == Socket::Status::NotReady))
+                           return false;
+
+                       completions.push_back(makeCompletion(handler, status));
+                       return true;
+                   });
+}
+
+
+////////////////////////////////////////////////////////////
+void NetworkReactor::asyncSend(TcpSocket& socket, const Packet& packet, StatusHandler handler)
+{
+    socket.setBlocking(false);
+
+    // The packet keeps track of how much of it was sent, which is how sf::TcpSocket resumes partial sends
+    m_impl->submit(socket,
+                   Impl::Queue::Sends,
+                   [&socket, packetCopy = packet, handler = std::move(handler)](
+                       std::vector<Completion>& completions) mutable
+                   {
+                       const Socket::Status status = socket.send(packetCopy);
+                       if ((status == Socket::Status::Partial) || (status == Socket::Status::NotReady))
+                           return false;
+
+                       completions.push_back(makeCompletion(handler, status));
+                       return true;
+                   });
+}
+
+
+////////////////////////////////////////////////////////////
+void NetworkReactor::asyncReceive(TcpSocket& socket, void* data, std::size_t size, ReceiveHandler handler)
+{
+    socket.setBlocking(false);
+
+    m_impl->submit(socket,
+                   Impl::Queue::Receptions,
+                   [&socket, data, size, handler = std::move(handler)](std::vector<Completion>& completions)
+                   {
+                       std::size_t          received = 0;
+                       const Socket::Status status   = socket.receive(data, size, received);
+                       if (status == Socket::Status::NotReady)
+                           return false;
+
+                       completions.emplace_back(
+                           [handler, status, received]
+                           {
+                               if (handler)
+                                   handler(status, received);
+                           });
+                       return true;
+                   });
+}
+
+
+////////////////////////////////////////////////////////////
+void NetworkReactor::asyncReceive(TcpSocket& socket, Packet& packet, StatusHandler handler)
+{
+    socket.setBlocking(false);
+
+    // sf::TcpSocket accumulates the partially received packets itself
+    m_impl->submit(socket,
+                   Impl::Queue::Receptions,
+                   [&socket, &packet, handler = std::move(handler)](std::vector<Completion>& completions)
+                   {
+                       const Socket::Status status = socket.receive(packet);
+                       if ((status == Socket::Status::NotReady) || (status == Socket::Status::Partial))
+                           return false;
+
+                       completions.push_back(makeCompletion(handler, status));
+                       return true;
+                   });
+}
+
+
+////////////////////////////////////////////////////////////
+void NetworkReactor::asyncSend(UdpSocket&     socket,
+                               const void*    data,
+                               std::size_t    size,
+                               IpAddress      remoteAddress,
+                               unsigned short remotePort,
+                               StatusHandler  handler)
+{
+    socket.setBlocking(false);
+
+    const auto* begin = static_cast<const std::byte*>(data);
+
+    m_impl->submit(socket,
+                   Impl::Queue::Sends,
+                   [&socket,
+                    buffer = std::vector<std::byte>(begin, begin + (data ? size : 0)),
+                    remoteAddress,
+                    remotePort,
+                    handler = std::move(handler)](std::vector<Completion>& completions)
+                   {
+                       const Socket::Status status = socket.send(buffer.data(),
+                                                                 buffer.size(),
+                                                                 remoteAddress,
+                                                                 remotePort);
+                       if (status == Socket::Status::NotReady)
+                           return false;
+
+                       completions.push_back(makeCompletion(handler, status));
+                       return true;
+                   });
+}
+
+
+////////////////////////////////////////////////////////////
+void NetworkReactor::asyncReceive(UdpSocket& socket, void* data, std::size_t size, ReceiveFromHandler handler)
+{
+    socket.setBlocking(false);
+
+    m_impl->submit(socket,
+                   Impl::Queue::Receptions,
+                   [&socket, data, size, handler = std::move(handler)](std::vector<Completion>& completions)
+                   {
+                       std::size_t              received = 0;
+                       std::optional<IpAddress> remoteAddress;
+                       unsigned short           remotePort = 0;
+
+                       const Socket::Status status = socket.receive(data, size, received, remoteAddress, remotePort);
+                       if (status == Socket::Status::NotReady)
+                           return false;
+
+                       completions.emplace_back(
+                           [handler, status, received, remoteAddress, remotePort]
+                           {
+                               if (handler)
+                                   handler(status, received, remoteAddress, remotePort);
+                           });
+                       return true;
+                   });
+}
+
+
+////////////////////////////////////////////////////////////
+void NetworkReactor::cancel(Socket& socket)
+{
+    const SocketHandle handle = socket.getNativeHandle();
+    if (handle == priv::SocketImpl::invalidSocket())
+        return;
+
+    std::shared_ptr<Impl::SocketState> state;
+    {
+        const std::lock_guard lock(m_impl->mutex);
+        const auto            it = m_impl->sockets.find(handle);
+        if (it == m_impl->sockets.end())
+            return;
+
+        state = std::move(it->second);
+        m_impl->sockets.erase(it);
+    }
+
+    // Wait for the operations that are being attempted by other threads
+    std::size_t count = 0;
+    {
+        const std::lock_guard lock(state->mutex);
+        state->cancelled = true;
+        count            = state->receptions.size() + state->sends.size();
+        state->receptions.clear();
+        state->sends.clear();
+        m_impl->poller.remove(handle);
+    }
+
+    m_impl->finish(count);
+}
+
+
+////////////////////////////////////////////////////////////
+void NetworkReactor::post(Handler handler)
+{
+    ++m_impl->outstanding;
+    m_impl->postCompletions({std::move(handler)});
+}
+
+
+////////////////////////////////////////////////////////////
+NetworkReactor::TimerId NetworkReactor::addTimer(Time delay, Handler handler)
+{
+    ++m_impl->outstanding;
+
+    const Clock::time_point deadline = Clock::now() + delay.toDuration();
+
+    TimerId id    = 0;
+    bool    first = false;
+    {
+        const std::lock_guard lock(m_impl->mutex);
+        id = m_impl->nextTimerId++;
+        m_impl->timers.emplace(id, std::make_pair(deadline, std::move(handler)));
+        first = m_impl->timerQueue.emplace(deadline, id).first == m_impl->timerQueue.begin();
+    }
+
+    // A thread may be waiting for a later deadline
+    if (first)
+        m_impl->poller.wakeup();
+
+    return id;
+}
+
+
+////////////////////////////////////////////////////////////
+bool NetworkReactor::cancelTimer(TimerId id)
+{
+    {
+        const std::lock_guard lock(m_impl->mutex);
+        const auto            it = m_impl->timers.find(id);
+        if (it == m_impl->timers.end())
+            return false;
+
+        m_impl->timerQueue.erase({it->second.first, id});
+        m_impl->timers.erase(it);
+    }
+
+    m_impl->finish(1);
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void NetworkReactor::run(unsigned int threadCount)
+{
+    threadCount = std::max(threadCount, 1u);
+    m_impl->runningThreads += threadCount;
+
+    std::vector<std::thread> threads;
+    threads.reserve(threadCount - 1);
+    for (unsigned int i = 1; i < threadCount; ++i)
+        threads.emplace_back([this] { m_impl->runThread(); });
+
+    m_impl->runThread();
+
+    for (std::thread& thread : threads)
+        thread.join();
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t NetworkReactor::poll()
+{
+    std::vector<Event> events;
+    return m_impl->runOnce(events, false);
+}
+
+
+////////////////////////////////////////////////////////////
+void NetworkReactor::stop()
+{
+    m_impl->stopped = true;
+    m_impl->poller.wakeup();
+}
+
+} // namespace sf
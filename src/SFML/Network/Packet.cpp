@@ -25,26 +25,101 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include <SFML/Network/Compression.hpp>
+#include <SFML/Network/CompressionDictionary.hpp>
 #include <SFML/Network/Packet.hpp>
+#include <SFML/Network/PacketPoolImpl.hpp>
+#include <SFML/Network/PacketView.hpp>
 #include <SFML/Network/SocketImpl.hpp>
 
+#include <SFML/System/Err.hpp>
 #include <SFML/System/String.hpp>
 #include <SFML/System/Utils.hpp>
 
 #include <array>
+#include <limits>
+#include <optional>
+#include <ostream>
+#include <type_traits>
+#include <utility>
 
 #include <cassert>
 #include <cstring>
 #include <cwchar>
 
 
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace PacketImpl
+{
+// Header of the data sent by packets using compression: flags, then if the data is
+// compressed, its decompressed size as a varint and the identifier of the dictionary
+constexpr std::byte   compressedFlag{1};
+constexpr std::byte   dictionaryFlag{2};
+constexpr std::size_t maxHeaderSize = 1 + 5 + 4;
+
+////////////////////////////////////////////////////////////
+std::size_t writeSize(std::byte* output, std::uint32_t size)
+{
+    std::size_t count = 0;
+    for (; size >= 0x80; size >>= 7)
+        output[count++] = static_cast<std::byte>((size & 0x7F) | 0x80);
+
+    output[count++] = static_cast<std::byte>(size);
+    return count;
+}
+
+
+////////////////////////////////////////////////////////////
+bool readSize(const std::byte*& input, const std::byte* inputEnd, std::uint64_t& size)
+{
+    for (unsigned int shift = 0; (shift < 35) && (input < inputEnd); shift += 7)
+    {
+        const std::byte group = *input++;
+        size |= std::to_integer<std::uint64_t>(group & std::byte{0x7F}) << shift;
+        if ((group & std::byte{0x80}) == std::byte{0})
+            return true;
+    }
+
+    return false;
+}
+
+
+////////////////////////////////////////////////////////////
+bool readId(const std::byte*& input, const std::byte* inputEnd, std::uint32_t& id)
+{
+    if (inputEnd - input < 4)
+        return false;
+
+    std::memcpy(&id, input, sizeof(id));
+    id = ntohl(id);
+    input += sizeof(id);
+    return true;
+}
+} // namespace PacketImpl
+} // namespace
+
+
 namespace sf
 {
+////////////////////////////////////////////////////////////
+Packet::~Packet()
+{
+    // Give the memory back to the pool of the current thread
+    priv::releasePacketBuffer(m_data);
+    priv::releasePacketBuffer(m_compressedData);
+}
+
+
 ////////////////////////////////////////////////////////////
 void Packet::append(const void* data, std::size_t sizeInBytes)
 {
     if (data && (sizeInBytes > 0))
     {
+        if (m_data.capacity() == 0)
+            m_data = priv::acquirePacketBuffer();
+
         const auto* begin = reinterpret_cast<const std::byte*>(data);
         const auto* end   = begin + sizeInBytes;
         m_data.insert(m_data.end(), begin, end);
@@ -82,6 +157,21 @@ std::size_t Packet::getDataSize() const
 }
 
 
+////////////////////////////////////////////////////////////
+void Packet::setCompression(Compression compression, std::shared_ptr<const CompressionDictionary> dictionary)
+{
+    m_compression = compression;
+    m_dictionary  = std::move(dictionary);
+}
+
+
+////////////////////////////////////////////////////////////
+Packet::Compression Packet::getCompression() const
+{
+    return m_compression;
+}
+
+
 ////////////////////////////////////////////////////////////
 bool Packet::endOfPacket() const
 {
@@ -97,274 +187,164 @@ Packet::operator bool() const
 
 
 ////////////////////////////////////////////////////////////
-Packet& Packet::operator>>(bool& data)
+template <typename Function>
+Packet& Packet::extract(Function function)
 {
-    std::uint8_t value = 0;
-    if (*this >> value)
-        data = (value != 0);
+    // Decoding is shared with sf::PacketView, which reads from the current position
+    PacketView view(m_data.data(), m_data.size());
+    view.m_readPos = m_readPos;
+    view.m_isValid = m_isValid;
+
+    function(view);
 
+    m_readPos = view.m_readPos;
+    m_isValid = view.m_isValid;
     return *this;
 }
 
 
 ////////////////////////////////////////////////////////////
-Packet& Packet::operator>>(std::int8_t& data)
+template <typename T>
+Packet& Packet::writeArray(const T* data, std::size_t count)
 {
-    if (checkSize(sizeof(data)))
+    assert((data || count == 0) && "Packet::write Data must not be null");
+
+    if (count == 0)
+        return *this;
+
+    // Check the size of all the values at once, taking care of overflows
+    const std::size_t offset = m_data.size();
+    if (count > (std::numeric_limits<std::size_t>::max() - offset) / sizeof(T))
     {
-        std::memcpy(&data, &m_data[m_readPos], sizeof(data));
-        m_readPos += sizeof(data);
+        err() << "Failed to write " << count << " values to packet, its size would overflow" << std::endl;
+        return *this;
     }
 
+    // Grow the packet once, then convert all the values in a single pass
+    if (m_data.capacity() == 0)
+        m_data = priv::acquirePacketBuffer();
+
+    m_data.resize(offset + count * sizeof(T));
+
+    // Integers are stored in big endian, other types are stored as they are in memory
+    if constexpr (std::is_integral_v<T> && (sizeof(T) > 1) && !SFML_IS_BIG_ENDIAN)
+        copyByteSwapped<std::make_unsigned_t<T>>(&m_data[offset], data, count);
+    else
+        std::memcpy(&m_data[offset], data, count * sizeof(T));
+
     return *this;
 }
 
 
 ////////////////////////////////////////////////////////////
-Packet& Packet::operator>>(std::uint8_t& data)
+Packet& Packet::operator>>(bool& data)
 {
-    if (checkSize(sizeof(data)))
-    {
-        std::memcpy(&data, &m_data[m_readPos], sizeof(data));
-        m_readPos += sizeof(data);
-    }
+    return extract([&data](PacketView& view) { view >> data; });
+}
 
-    return *this;
+
+////////////////////////////////////////////////////////////
+Packet& Packet::operator>>(std::int8_t& data)
+{
+    return extract([&data](PacketView& view) { view >> data; });
 }
 
 
 ////////////////////////////////////////////////////////////
-Packet& Packet::operator>>(std::int16_t& data)
+Packet& Packet::operator>>(std::uint8_t& data)
 {
-    if (checkSize(sizeof(data)))
-    {
-        std::memcpy(&data, &m_data[m_readPos], sizeof(data));
-        data = static_cast<std::int16_t>(ntohs(static_cast<std::uint16_t>(data)));
-        m_readPos += sizeof(data);
-    }
+    return extract([&data](PacketView& view) { view >> data; });
+}
 
-    return *this;
+
+////////////////////////////////////////////////////////////
+Packet& Packet::operator>>(std::int16_t& data)
+{
+    return extract([&data](PacketView& view) { view >> data; });
 }
 
 
 ////////////////////////////////////////////////////////////
 Packet& Packet::operator>>(std::uint16_t& data)
 {
-    if (checkSize(sizeof(data)))
-    {
-        std::memcpy(&data, &m_data[m_readPos], sizeof(data));
-        data = ntohs(data);
-        m_readPos += sizeof(data);
-    }
-
-    return *this;
+    return extract([&data](PacketView& view) { view >> data; });
 }
 
 
 ////////////////////////////////////////////////////////////
 Packet& Packet::operator>>(std::int32_t& data)
 {
-    if (checkSize(sizeof(data)))
-    {
-        std::memcpy(&data, &m_data[m_readPos], sizeof(data));
-        data = static_cast<std::int32_t>(ntohl(static_cast<std::uint32_t>(data)));
-        m_readPos += sizeof(data);
-    }
-
-    return *this;
+    return extract([&data](PacketView& view) { view >> data; });
 }
 
 
 ////////////////////////////////////////////////////////////
 Packet& Packet::operator>>(std::uint32_t& data)
 {
-    if (checkSize(sizeof(data)))
-    {
-        std::memcpy(&data, &m_data[m_readPos], sizeof(data));
-        data = ntohl(data);
-        m_readPos += sizeof(data);
-    }
-
-    return *this;
+    return extract([&data](PacketView& view) { view >> data; });
 }
 
 
 ////////////////////////////////////////////////////////////
 Packet& Packet::operator>>(std::int64_t& data)
 {
-    if (checkSize(sizeof(data)))
-    {
-        // Since ntohll is not available everywhere, we have to convert
-        // to network byte order (big endian) manually
-        std::array<std::byte, sizeof(data)> bytes{};
-        std::memcpy(bytes.data(), &m_data[m_readPos], bytes.size());
-
-        data = toInteger<std::int64_t>(bytes[7], bytes[6], bytes[5], bytes[4], bytes[3], bytes[2], bytes[1], bytes[0]);
-
-        m_readPos += sizeof(data);
-    }
-
-    return *this;
+    return extract([&data](PacketView& view) { view >> data; });
 }
 
 
 ////////////////////////////////////////////////////////////
 Packet& Packet::operator>>(std::uint64_t& data)
 {
-    if (checkSize(sizeof(data)))
-    {
-        // Since ntohll is not available everywhere, we have to convert
-        // to network byte order (big endian) manually
-        std::array<std::byte, sizeof(data)> bytes{};
-        std::memcpy(bytes.data(), &m_data[m_readPos], sizeof(data));
-
-        data = toInteger<std::uint64_t>(bytes[7], bytes[6], bytes[5], bytes[4], bytes[3], bytes[2], bytes[1], bytes[0]);
-
-        m_readPos += sizeof(data);
-    }
-
-    return *this;
+    return extract([&data](PacketView& view) { view >> data; });
 }
 
 
 ////////////////////////////////////////////////////////////
 Packet& Packet::operator>>(float& data)
 {
-    if (checkSize(sizeof(data)))
-    {
-        std::memcpy(&data, &m_data[m_readPos], sizeof(data));
-        m_readPos += sizeof(data);
-    }
-
-    return *this;
+    return extract([&data](PacketView& view) { view >> data; });
 }
 
 
 ////////////////////////////////////////////////////////////
 Packet& Packet::operator>>(double& data)
 {
-    if (checkSize(sizeof(data)))
-    {
-        std::memcpy(&data, &m_data[m_readPos], sizeof(data));
-        m_readPos += sizeof(data);
-    }
-
-    return *this;
+    return extract([&data](PacketView& view) { view >> data; });
 }
 
 
 ////////////////////////////////////////////////////////////
 Packet& Packet::operator>>(char* data)
 {
-    assert(data && "Packet::operator>> Data must not be null");
-
-    // First extract string length
-    std::uint32_t length = 0;
-    *this >> length;
-
-    if ((length > 0) && checkSize(length))
-    {
-        // Then extract characters
-        std::memcpy(data, &m_data[m_readPos], length);
-        data[length] = '\0';
-
-        // Update reading position
-        m_readPos += length;
-    }
-
-    return *this;
+    return extract([&data](PacketView& view) { view >> data; });
 }
 
 
 ////////////////////////////////////////////////////////////
 Packet& Packet::operator>>(std::string& data)
 {
-    // First extract string length
-    std::uint32_t length = 0;
-    *this >> length;
-
-    data.clear();
-    if ((length > 0) && checkSize(length))
-    {
-        // Then extract characters
-        data.assign(reinterpret_cast<char*>(&m_data[m_readPos]), length);
-
-        // Update reading position
-        m_readPos += length;
-    }
-
-    return *this;
+    return extract([&data](PacketView& view) { view >> data; });
 }
 
 
 ////////////////////////////////////////////////////////////
 Packet& Packet::operator>>(wchar_t* data)
 {
-    assert(data && "Packet::operator>> Data must not be null");
-
-    // First extract string length
-    std::uint32_t length = 0;
-    *this >> length;
-
-    if ((length > 0) && checkSize(length * sizeof(std::uint32_t)))
-    {
-        // Then extract characters
-        for (std::uint32_t i = 0; i < length; ++i)
-        {
-            std::uint32_t character = 0;
-            *this >> character;
-            data[i] = static_cast<wchar_t>(character);
-        }
-        data[length] = L'\0';
-    }
-
-    return *this;
+    return extract([&data](PacketView& view) { view >> data; });
 }
 
 
 ////////////////////////////////////////////////////////////
 Packet& Packet::operator>>(std::wstring& data)
 {
-    // First extract string length
-    std::uint32_t length = 0;
-    *this >> length;
-
-    data.clear();
-    if ((length > 0) && checkSize(length * sizeof(std::uint32_t)))
-    {
-        // Then extract characters
-        for (std::uint32_t i = 0; i < length; ++i)
-        {
-            std::uint32_t character = 0;
-            *this >> character;
-            data += static_cast<wchar_t>(character);
-        }
-    }
-
-    return *this;
+    return extract([&data](PacketView& view) { view >> data; });
 }
 
 
 ////////////////////////////////////////////////////////////
 Packet& Packet::operator>>(String& data)
 {
-    // First extract the string length
-    std::uint32_t length = 0;
-    *this >> length;
-
-    data.clear();
-    if ((length > 0) && checkSize(length * sizeof(std::uint32_t)))
-    {
-        // Then extract characters
-        for (std::uint32_t i = 0; i < length; ++i)
-        {
-            std::uint32_t character = 0;
-            *this >> character;
-            data += static_cast<char32_t>(character);
-        }
-    }
-
-    return *this;
+    return extract([&data](PacketView& view) { view >> data; });
 }
 
 
@@ -569,28 +549,273 @@ Packet& Packet::operator<<(const String& data)
 
 
 ////////////////////////////////////////////////////////////
-bool Packet::checkSize(std::size_t size)
+Packet& Packet::read(std::int8_t* data, std::size_t count)
 {
-    // Determine if size is big enough to trigger an overflow
-    const bool overflowDetected = m_readPos + size < m_readPos;
-    m_isValid                   = m_isValid && (m_readPos + size <= m_data.size()) && !overflowDetected;
+    return extract([data, count](PacketView& view) { view.read(data, count); });
+}
 
-    return m_isValid;
+
+////////////////////////////////////////////////////////////
+Packet& Packet::read(std::uint8_t* data, std::size_t count)
+{
+    return extract([data, count](PacketView& view) { view.read(data, count); });
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::read(std::int16_t* data, std::size_t count)
+{
+    return extract([data, count](PacketView& view) { view.read(data, count); });
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::read(std::uint16_t* data, std::size_t count)
+{
+    return extract([data, count](PacketView& view) { view.read(data, count); });
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::read(std::int32_t* data, std::size_t count)
+{
+    return extract([data, count](PacketView& view) { view.read(data, count); });
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::read(std::uint32_t* data, std::size_t count)
+{
+    return extract([data, count](PacketView& view) { view.read(data, count); });
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::read(std::int64_t* data, std::size_t count)
+{
+    return extract([data, count](PacketView& view) { view.read(data, count); });
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::read(std::uint64_t* data, std::size_t count)
+{
+    return extract([data, count](PacketView& view) { view.read(data, count); });
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::read(float* data, std::size_t count)
+{
+    return extract([data, count](PacketView& view) { view.read(data, count); });
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::read(double* data, std::size_t count)
+{
+    return extract([data, count](PacketView& view) { view.read(data, count); });
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::write(const std::int8_t* data, std::size_t count)
+{
+    return writeArray(data, count);
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::write(const std::uint8_t* data, std::size_t count)
+{
+    return writeArray(data, count);
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::write(const std::int16_t* data, std::size_t count)
+{
+    return writeArray(data, count);
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::write(const std::uint16_t* data, std::size_t count)
+{
+    return writeArray(data, count);
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::write(const std::int32_t* data, std::size_t count)
+{
+    return writeArray(data, count);
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::write(const std::uint32_t* data, std::size_t count)
+{
+    return writeArray(data, count);
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::write(const std::int64_t* data, std::size_t count)
+{
+    return writeArray(data, count);
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::write(const std::uint64_t* data, std::size_t count)
+{
+    return writeArray(data, count);
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::write(const float* data, std::size_t count)
+{
+    return writeArray(data, count);
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::write(const double* data, std::size_t count)
+{
+    return writeArray(data, count);
 }
 
 
 ////////////////////////////////////////////////////////////
 const void* Packet::onSend(std::size_t& size)
 {
-    size = getDataSize();
-    return getData();
+    if ((m_compression == Compression::None) || m_data.empty())
+    {
+        size = getDataSize();
+        return getData();
+    }
+
+    if (m_compressedData.capacity() == 0)
+        m_compressedData = priv::acquirePacketBuffer();
+
+    if (m_compressedData.size() < PacketImpl::maxHeaderSize + m_data.size())
+        m_compressedData.resize(PacketImpl::maxHeaderSize + m_data.size());
+
+    // Write the header
+    std::byte*  header     = m_compressedData.data();
+    std::size_t headerSize = 1;
+    header[0]              = PacketImpl::compressedFlag;
+    headerSize += PacketImpl::writeSize(header + headerSize, static_cast<std::uint32_t>(m_data.size()));
+
+    std::optional<priv::Lz::Dictionary> dictionary;
+    if (m_dictionary)
+    {
+        dictionary.emplace(priv::Lz::Dictionary{m_dictionary->m_data.data(),
+                                                m_dictionary->m_data.size(),
+                                                m_dictionary->m_hashTable.data()});
+
+        const std::uint32_t id = htonl(m_dictionary->m_id);
+        std::memcpy(header + headerSize, &id, sizeof(id));
+        headerSize += sizeof(id);
+        header[0] |= PacketImpl::dictionaryFlag;
+    }
+
+    // Compress the data, only keeping the result if it is smaller than the data stored as it is
+    std::size_t compressedSize = 0;
+    if (m_data.size() > headerSize)
+    {
+        compressedSize = priv::Lz::compress(m_data.data(),
+                                            m_data.size(),
+                                            header + headerSize,
+                                            m_data.size() - headerSize,
+                                            dictionary ? &*dictionary : nullptr);
+    }
+
+    if (compressedSize == 0)
+    {
+        header[0] = std::byte{0};
+        std::memcpy(header + 1, m_data.data(), m_data.size());
+        size = 1 + m_data.size();
+    }
+    else
+    {
+        size = headerSize + compressedSize;
+    }
+
+    return m_compressedData.data();
 }
 
 
 ////////////////////////////////////////////////////////////
 void Packet::onReceive(const void* data, std::size_t size)
 {
-    append(data, size);
+    if ((m_compression == Compression::None) || (size == 0))
+    {
+        append(data, size);
+        return;
+    }
+
+    const auto* input    = static_cast<const std::byte*>(data);
+    const auto* inputEnd = input + size;
+    const auto  flags    = *input++;
+
+    // Data that was not compressed
+    if (flags == std::byte{0})
+    {
+        append(input, size - 1);
+        return;
+    }
+
+    // Read the rest of the header
+    const bool    hasDictionary = (flags & PacketImpl::dictionaryFlag) != std::byte{0};
+    std::uint64_t dataSize      = 0;
+    std::uint32_t id            = 0;
+    bool isValid = ((flags & ~(PacketImpl::compressedFlag | PacketImpl::dictionaryFlag)) == std::byte{0}) &&
+                   PacketImpl::readSize(input, inputEnd, dataSize) &&
+                   (!hasDictionary || PacketImpl::readId(input, inputEnd, id));
+
+    if (isValid && hasDictionary && (!m_dictionary || (m_dictionary->m_id != id)))
+    {
+        err() << "Failed to decompress packet: it was compressed with a different dictionary" << std::endl;
+        m_isValid = false;
+        return;
+    }
+
+    // Don't trust sizes that the compressed data cannot produce
+    const auto compressedSize = static_cast<std::size_t>(inputEnd - input);
+    isValid = isValid && (dataSize <= std::uint64_t{compressedSize} * priv::Lz::maxRatio);
+
+    if (isValid)
+    {
+        std::optional<priv::Lz::Dictionary> dictionary;
+        if (hasDictionary)
+        {
+            dictionary.emplace(priv::Lz::Dictionary{m_dictionary->m_data.data(),
+                                                    m_dictionary->m_data.size(),
+                                                    m_dictionary->m_hashTable.data()});
+        }
+
+        if (m_data.capacity() == 0)
+            m_data = priv::acquirePacketBuffer();
+
+        const std::size_t offset = m_data.size();
+        m_data.resize(offset + static_cast<std::size_t>(dataSize));
+        isValid = priv::Lz::decompress(input,
+                                       compressedSize,
+                                       m_data.data() + offset,
+                                       static_cast<std::size_t>(dataSize),
+                                       dictionary ? &*dictionary : nullptr);
+        if (!isValid)
+            m_data.resize(offset);
+    }
+
+    if (!isValid)
+    {
+        err() << "Failed to decompress packet: the data is corrupted" << std::endl;
+        m_isValid = false;
+    }
 }
 
 } // namespace sf
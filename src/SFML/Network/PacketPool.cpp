@@ -0,0 +1,234 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Network/PacketPool.hpp>
+#include <SFML/Network/PacketPoolImpl.hpp>
+
+#include <atomic>
+#include <utility>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace PacketPoolImpl
+{
+std::atomic<std::size_t> maxBuffers{64};           // Maximum number of buffers kept by each thread
+std::atomic<std::size_t> maxBufferSize{64 * 1024}; // Maximum capacity of the buffers kept
+
+// Statistics, shared by all threads
+std::atomic<std::uint64_t> hits{};
+std::atomic<std::uint64_t> misses{};
+std::atomic<std::uint64_t> discarded{};
+std::atomic<std::size_t>   pooledBuffers{};
+std::atomic<std::size_t>   pooledBytes{};
+std::atomic<std::size_t>   peakPooledBytes{};
+
+////////////////////////////////////////////////////////////
+// Buffers kept by a thread, used as a stack so that the most recently used memory is reused first
+struct FreeList
+{
+    FreeList() = default;
+
+    FreeList(const FreeList&)            = delete;
+    FreeList& operator=(const FreeList&) = delete;
+
+    ~FreeList();
+
+    void push(std::vector<std::byte>&& buffer)
+    {
+        const std::size_t capacity = buffer.capacity();
+        buffers.push_back(std::move(buffer));
+
+        pooledBuffers.fetch_add(1, std::memory_order_relaxed);
+        const std::size_t bytes = pooledBytes.fetch_add(capacity, std::memory_order_relaxed) + capacity;
+
+        std::size_t peak = peakPooledBytes.load(std::memory_order_relaxed);
+        while ((bytes > peak) && !peakPooledBytes.compare_exchange_weak(peak, bytes, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    std::vector<std::byte> pop()
+    {
+        std::vector<std::byte> buffer = std::move(buffers.back());
+        buffers.pop_back();
+
+        pooledBuffers.fetch_sub(1, std::memory_order_relaxed);
+        pooledBytes.fetch_sub(buffer.capacity(), std::memory_order_relaxed);
+        return buffer;
+    }
+
+    void clear()
+    {
+        while (!buffers.empty())
+            pop();
+    }
+
+    std::vector<std::vector<std::byte>> buffers;
+};
+
+// Set when the pool of the thread is destroyed, packets destroyed later on free their memory directly
+thread_local bool freeListDestroyed(false);
+
+////////////////////////////////////////////////////////////
+FreeList::~FreeList()
+{
+    clear();
+    freeListDestroyed = true;
+}
+
+////////////////////////////////////////////////////////////
+FreeList* getFreeList()
+{
+    if (freeListDestroyed)
+        return nullptr;
+
+    thread_local FreeList freeList;
+    return &freeList;
+}
+} // namespace PacketPoolImpl
+} // namespace
+
+
+namespace sf::PacketPool
+{
+////////////////////////////////////////////////////////////
+void setMaxBuffers(std::size_t count)
+{
+    PacketPoolImpl::maxBuffers.store(count, std::memory_order_relaxed);
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t getMaxBuffers()
+{
+    return PacketPoolImpl::maxBuffers.load(std::memory_order_relaxed);
+}
+
+
+////////////////////////////////////////////////////////////
+void setMaxBufferSize(std::size_t size)
+{
+    PacketPoolImpl::maxBufferSize.store(size, std::memory_order_relaxed);
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t getMaxBufferSize()
+{
+    return PacketPoolImpl::maxBufferSize.load(std::memory_order_relaxed);
+}
+
+
+////////////////////////////////////////////////////////////
+Statistics getStatistics()
+{
+    Statistics statistics;
+    statistics.hits            = PacketPoolImpl::hits.load(std::memory_order_relaxed);
+    statistics.misses          = PacketPoolImpl::misses.load(std::memory_order_relaxed);
+    statistics.discarded       = PacketPoolImpl::discarded.load(std::memory_order_relaxed);
+    statistics.pooledBuffers   = PacketPoolImpl::pooledBuffers.load(std::memory_order_relaxed);
+    statistics.pooledBytes     = PacketPoolImpl::pooledBytes.load(std::memory_order_relaxed);
+    statistics.peakPooledBytes = PacketPoolImpl::peakPooledBytes.load(std::memory_order_relaxed);
+    return statistics;
+}
+
+
+////////////////////////////////////////////////////////////
+void resetStatistics()
+{
+    PacketPoolImpl::hits.store(0, std::memory_order_relaxed);
+    PacketPoolImpl::misses.store(0, std::memory_order_relaxed);
+    PacketPoolImpl::discarded.store(0, std::memory_order_relaxed);
+    PacketPoolImpl::peakPooledBytes.store(PacketPoolImpl::pooledBytes.load(std::memory_order_relaxed),
+                                          std::memory_order_relaxed);
+}
+
+
+////////////////////////////////////////////////////////////
+void trim()
+{
+    if (PacketPoolImpl::FreeList* freeList = PacketPoolImpl::getFreeList())
+        freeList->clear();
+}
+} // namespace sf::PacketPool
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+std::vector<std::byte> acquirePacketBuffer()
+{
+    PacketPoolImpl::FreeList* freeList = PacketPoolImpl::getFreeList();
+    if (!freeList || freeList->buffers.empty())
+    {
+        PacketPoolImpl::misses.fetch_add(1, std::memory_order_relaxed);
+        return {};
+    }
+
+    PacketPoolImpl::hits.fetch_add(1, std::memory_order_relaxed);
+    return freeList->pop();
+}
+
+
+////////////////////////////////////////////////////////////
+void releasePacketBuffer(std::vector<std::byte>& buffer)
+{
+    if (buffer.capacity() == 0)
+        return;
+
+    PacketPoolImpl::FreeList* freeList = PacketPoolImpl::getFreeList();
+    if (!freeList)
+    {
+        std::vector<std::byte>().swap(buffer);
+        return;
+    }
+
+    // Free the buffers in excess if the limit was lowered
+    const std::size_t maxBuffers = PacketPoolImpl::maxBuffers.load(std::memory_order_relaxed);
+    while (freeList->buffers.size() > maxBuffers)
+    {
+        freeList->pop();
+        PacketPoolImpl::discarded.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    if ((freeList->buffers.size() == maxBuffers) ||
+        (buffer.capacity() > PacketPoolImpl::maxBufferSize.load(std::memory_order_relaxed)))
+    {
+        // Free the memory now
+        PacketPoolImpl::discarded.fetch_add(1, std::memory_order_relaxed);
+        std::vector<std::byte>().swap(buffer);
+        return;
+    }
+
+    buffer.clear();
+    freeList->push(std::move(buffer));
+    buffer = {};
+}
+
+} // namespace sf::priv
@@ -0,0 +1,57 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <vector>
+
+#include <cstddef>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Take a buffer from the pool of the calling thread
+///
+/// \return Empty buffer with the capacity of a previously
+///         released one, or without capacity if the pool is empty
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] std::vector<std::byte> acquirePacketBuffer();
+
+////////////////////////////////////////////////////////////
+/// \brief Give the memory of a buffer to the pool of the calling thread
+///
+/// The memory is freed if the pool is full or if the
+/// buffer is too large to be kept.
+///
+/// \param buffer Buffer to release, left without capacity
+///
+////////////////////////////////////////////////////////////
+void releasePacketBuffer(std::vector<std::byte>& buffer);
+
+} // namespace sf::priv
@@ -0,0 +1,491 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Network/Packet.hpp>
+#include <SFML/Network/PacketView.hpp>
+#include <SFML/Network/SocketImpl.hpp>
+
+#include <SFML/System/String.hpp>
+#include <SFML/System/Utils.hpp>
+
+#include <array>
+#include <limits>
+#include <type_traits>
+
+#include <cassert>
+#include <cstring>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+PacketView::PacketView(const void* data, std::size_t sizeInBytes) :
+m_data(static_cast<const std::byte*>(data)),
+m_size(data ? sizeInBytes : 0)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+PacketView::PacketView(const Packet& packet) : PacketView(packet.getData(), packet.getDataSize())
+{
+}
+
+
+////////////////////////////////////////////////////////////
+const void* PacketView::getData() const
+{
+    return m_size > 0 ? m_data : nullptr;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t PacketView::getDataSize() const
+{
+    return m_size;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t PacketView::getReadPosition() const
+{
+    return m_readPos;
+}
+
+
+////////////////////////////////////////////////////////////
+bool PacketView::endOfPacket() const
+{
+    return m_readPos >= m_size;
+}
+
+
+////////////////////////////////////////////////////////////
+PacketView::operator bool() const
+{
+    return m_isValid;
+}
+
+
+////////////////////////////////////////////////////////////
+PacketView& PacketView::operator>>(bool& data)
+{
+    std::uint8_t value = 0;
+    if (*this >> value)
+        data = (value != 0);
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+PacketView& PacketView::operator>>(std::int8_t& data)
+{
+    if (checkSize(sizeof(data)))
+    {
+        std::memcpy(&data, m_data + m_readPos, sizeof(data));
+        m_readPos += sizeof(data);
+    }
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+PacketView& PacketView::operator>>(std::uint8_t& data)
+{
+    if (checkSize(sizeof(data)))
+    {
+        std::memcpy(&data, m_data + m_readPos, sizeof(data));
+        m_readPos += sizeof(data);
+    }
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+PacketView& PacketView::operator>>(std::int16_t& data)
+{
+    if (checkSize(sizeof(data)))
+    {
+        std::memcpy(&data, m_data + m_readPos, sizeof(data));
+        data = static_cast<std::int16_t>(ntohs(static_cast<std::uint16_t>(data)));
+        m_readPos += sizeof(data);
+    }
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+PacketView& PacketView::operator>>(std::uint16_t& data)
+{
+    if (checkSize(sizeof(data)))
+    {
+        std::memcpy(&data, m_data + m_readPos, sizeof(data));
+        data = ntohs(data);
+        m_readPos += sizeof(data);
+    }
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+PacketView& PacketView::operator>>(std::int32_t& data)
+{
+    if (checkSize(sizeof(data)))
+    {
+        std::memcpy(&data, m_data + m_readPos, sizeof(data));
+        data = static_cast<std::int32_t>(ntohl(static_cast<std::uint32_t>(data)));
+        m_readPos += sizeof(data);
+    }
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+PacketView& PacketView::operator>>(std::uint32_t& data)
+{
+    if (checkSize(sizeof(data)))
+    {
+        std::memcpy(&data, m_data + m_readPos, sizeof(data));
+        data = ntohl(data);
+        m_readPos += sizeof(data);
+    }
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+PacketView& PacketView::operator>>(std::int64_t& data)
+{
+    if (checkSize(sizeof(data)))
+    {
+        // Since ntohll is not available everywhere, we have to convert
+        // to network byte order (big endian) manually
+        std::array<std::byte, sizeof(data)> bytes{};
+        std::memcpy(bytes.data(), m_data + m_readPos, bytes.size());
+
+        data = toInteger<std::int64_t>(bytes[7], bytes[6], bytes[5], bytes[4], bytes[3], bytes[2], bytes[1], bytes[0]);
+
+        m_readPos += sizeof(data);
+    }
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+PacketView& PacketView::operator>>(std::uint64_t& data)
+{
+    if (checkSize(sizeof(data)))
+    {
+        // Since ntohll is not available everywhere, we have to convert
+        // to network byte order (big endian) manually
+        std::array<std::byte, sizeof(data)> bytes{};
+        std::memcpy(bytes.data(), m_data + m_readPos, sizeof(data));
+
+        data = toInteger<std::uint64_t>(bytes[7], bytes[6], bytes[5], bytes[4], bytes[3], bytes[2], bytes[1], bytes[0]);
+
+        m_readPos += sizeof(data);
+    }
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+PacketView& PacketView::operator>>(float& data)
+{
+    if (checkSize(sizeof(data)))
+    {
+        std::memcpy(&data, m_data + m_readPos, sizeof(data));
+        m_readPos += sizeof(data);
+    }
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+PacketView& PacketView::operator>>(double& data)
+{
+    if (checkSize(sizeof(data)))
+    {
+        std::memcpy(&data, m_data + m_readPos, sizeof(data));
+        m_readPos += sizeof(data);
+    }
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+PacketView& PacketView::operator>>(char* data)
+{
+    assert(data && "PacketView::operator>> Data must not be null");
+
+    // First extract string length
+    std::uint32_t length = 0;
+    *this >> length;
+
+    if ((length > 0) && checkSize(length))
+    {
+        // Then extract characters
+        std::memcpy(data, m_data + m_readPos, length);
+        data[length] = '\0';
+
+        // Update reading position
+        m_readPos += length;
+    }
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+PacketView& PacketView::operator>>(std::string& data)
+{
+    // First extract string length
+    std::uint32_t length = 0;
+    *this >> length;
+
+    data.clear();
+    if ((length > 0) && checkSize(length))
+    {
+        // Then extract characters
+        data.assign(reinterpret_cast<const char*>(m_data + m_readPos), length);
+
+        // Update reading position
+        m_readPos += length;
+    }
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+PacketView& PacketView::operator>>(std::string_view& data)
+{
+    // First extract string length
+    std::uint32_t length = 0;
+    *this >> length;
+
+    data = {};
+    if ((length > 0) && checkSize(length))
+    {
+        // Then refer to the characters where they are
+        data = std::string_view(reinterpret_cast<const char*>(m_data + m_readPos), length);
+
+        // Update reading position
+        m_readPos += length;
+    }
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+PacketView& PacketView::operator>>(wchar_t* data)
+{
+    assert(data && "PacketView::operator>> Data must not be null");
+
+    // First extract string length
+    std::uint32_t length = 0;
+    *this >> length;
+
+    if ((length > 0) && checkSize(length * sizeof(std::uint32_t)))
+    {
+        // Then extract characters
+        for (std::uint32_t i = 0; i < length; ++i)
+        {
+            std::uint32_t character = 0;
+            *this >> character;
+            data[i] = static_cast<wchar_t>(character);
+        }
+        data[length] = L'\0';
+    }
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+PacketView& PacketView::operator>>(std::wstring& data)
+{
+    // First extract string length
+    std::uint32_t length = 0;
+    *this >> length;
+
+    data.clear();
+    if ((length > 0) && checkSize(length * sizeof(std::uint32_t)))
+    {
+        // Then extract characters
+        for (std::uint32_t i = 0; i < length; ++i)
+        {
+            std::uint32_t character = 0;
+            *this >> character;
+            data += static_cast<wchar_t>(character);
+        }
+    }
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+PacketView& PacketView::operator>>(String& data)
+{
+    // First extract the string length
+    std::uint32_t length = 0;
+    *this >> length;
+
+    data.clear();
+    if ((length > 0) && checkSize(length * sizeof(std::uint32_t)))
+    {
+        // Then extract characters
+        for (std::uint32_t i = 0; i < length; ++i)
+        {
+            std::uint32_t character = 0;
+            *this >> character;
+            data += static_cast<char32_t>(character);
+        }
+    }
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+PacketView& PacketView::readArray(T* data, std::size_t count)
+{
+    assert((data || count == 0) && "PacketView::read Data must not be null");
+
+    // Check the size of all the values at once, taking care of overflows
+    if (count > std::numeric_limits<std::size_t>::max() / sizeof(T))
+        m_isValid = false;
+    else if ((count > 0) && checkSize(count * sizeof(T)))
+    {
+        // Integers are stored in big endian, other types are stored as they are in memory
+        if constexpr (std::is_integral_v<T> && (sizeof(T) > 1) && !SFML_IS_BIG_ENDIAN)
+            copyByteSwapped<std::make_unsigned_t<T>>(data, m_data + m_readPos, count);
+        else
+            std::memcpy(data, m_data + m_readPos, count * sizeof(T));
+
+        m_readPos += count * sizeof(T);
+    }
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+PacketView& PacketView::read(std::int8_t* data, std::size_t count)
+{
+    return readArray(data, count);
+}
+
+
+////////////////////////////////////////////////////////////
+PacketView& PacketView::read(std::uint8_t* data, std::size_t count)
+{
+    return readArray(data, count);
+}
+
+
+////////////////////////////////////////////////////////////
+PacketView& PacketView::read(std::int16_t* data, std::size_t count)
+{
+    return readArray(data, count);
+}
+
+
+////////////////////////////////////////////////////////////
+PacketView& PacketView::read(std::uint16_t* data, std::size_t count)
+{
+    return readArray(data, count);
+}
+
+
+////////////////////////////////////////////////////////////
+PacketView& PacketView::read(std::int32_t* data, std::size_t count)
+{
+    return readArray(data, count);
+}
+
+
+////////////////////////////////////////////////////////////
+PacketView& PacketView::read(std::uint32_t* data, std::size_t count)
+{
+    return readArray(data, count);
+}
+
+
+////////////////////////////////////////////////////////////
+PacketView& PacketView::read(std::int64_t* data, std::size_t count)
+{
+    return readArray(data, count);
+}
+
+
+////////////////////////////////////////////////////////////
+PacketView& PacketView::read(std::uint64_t* data, std::size_t count)
+{
+    return readArray(data, count);
+}
+
+
+////////////////////////////////////////////////////////////
+PacketView& PacketView::read(float* data, std::size_t count)
+{
+    return readArray(data, count);
+}
+
+
+////////////////////////////////////////////////////////////
+PacketView& PacketView::read(double* data, std::size_t count)
+{
+    return readArray(data, count);
+}
+
+
+////////////////////////////////////////////////////////////
+bool PacketView::checkSize(std::size_t size)
+{
+    // Determine if size is big enough to trigger an overflow
+    const bool overflowDetected = m_readPos + size < m_readPos;
+    m_isValid                   = m_isValid && (m_readPos + size <= m_size) && !overflowDetected;
+
+    return m_isValid;
+}
+
+} // namespace sf
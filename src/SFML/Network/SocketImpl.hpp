@@ -45,6 +45,7 @@
 #include <netinet/tcp.h>
 #include <sys/socket.h>
 #include <sys/types.h>
+#include <sys/uio.h>
 #include <unistd.h>
 
 #include <cstddef>
@@ -70,9 +71,11 @@ public:
 #if defined(SFML_SYSTEM_WINDOWS)
     using AddrLength = int;
     using Size       = int;
+    using Buffer     = WSABUF;
 #else
     using AddrLength = socklen_t;
     using Size       = std::size_t;
+    using Buffer     = iovec;
 #endif
 
     ////////////////////////////////////////////////////////////
@@ -118,6 +121,32 @@ public:
     ///
     ////////////////////////////////////////////////////////////
     static Socket::Status getErrorStatus();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create the descriptor of a buffer to send with `sendBuffers`
+    ///
+    /// \param data Pointer to the bytes to send
+    /// \param size Number of bytes to send
+    ///
+    /// \return Buffer descriptor referencing the given bytes
+    ///
+    ////////////////////////////////////////////////////////////
+    static Buffer createBuffer(const void* data, std::size_t size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Send several buffers with a single system call
+    ///
+    /// The buffers are sent one after the other, as if they
+    /// were contiguous (scatter-gather output).
+    ///
+    /// \param sock    Handle of the socket
+    /// \param buffers Descriptors of the buffers to send
+    /// \param count   Number of buffers
+    ///
+    /// \return Number of bytes sent, or -1 on error (use `getErrorStatus` to know why)
+    ///
+    ////////////////////////////////////////////////////////////
+    static long sendBuffers(SocketHandle sock, Buffer* buffers, std::size_t count);
 };
 
 } // namespace sf::priv
@@ -32,24 +32,110 @@
 #include <SFML/System/Err.hpp>
 
 #include <algorithm>
+#include <cstdint>
 #include <memory>
 #include <ostream>
+#include <unordered_map>
 #include <utility>
+#include <vector>
+
+#if defined(SFML_SYSTEM_LINUX) || defined(SFML_SYSTEM_ANDROID)
+#define SFML_SOCKET_SELECTOR_EPOLL
+#endif
+
+#if defined(SFML_SOCKET_SELECTOR_EPOLL)
+#include <sys/epoll.h>
+
+#include <cerrno>
+#include <climits>
+#include <cstring>
+#endif
 
 #ifdef _MSC_VER
 #pragma warning(disable : 4127) // "conditional expression is constant" generated by the FD_SET macro
 #endif
 
 
+namespace
+{
+////////////////////////////////////////////////////////////
+[[nodiscard]] bool hasReadiness(sf::SocketSelector::Readiness readiness, sf::SocketSelector::Readiness flag)
+{
+    return (static_cast<int>(readiness) & static_cast<int>(flag)) != 0;
+}
+} // namespace
+
+
 namespace sf
 {
 ////////////////////////////////////////////////////////////
 struct SocketSelector::SocketSelectorImpl
 {
-    fd_set allSockets{};   //!< Set containing all the sockets handles
-    fd_set socketsReady{}; //!< Set containing handles of the sockets that are ready
-    int    maxSocket{};    //!< Maximum socket handle
-    int    socketCount{};  //!< Number of socket handles
+    struct Entry
+    {
+        Socket*   socket{};    //!< Socket that was added to the selector
+        Readiness readiness{}; //!< Kinds of readiness the socket is watched for
+        bool      readable{};  //!< Was the socket ready to read after the last wait?
+        bool      writable{};  //!< Was the socket ready to write after the last wait?
+    };
+
+#if defined(SFML_SOCKET_SELECTOR_EPOLL)
+
+    SocketSelectorImpl() : epollFd(epoll_create1(EPOLL_CLOEXEC))
+    {
+        if (epollFd < 0)
+            err() << "Failed to create the epoll instance of the socket selector: " << std::strerror(errno)
+                  << std::endl;
+    }
+
+    SocketSelectorImpl(const SocketSelectorImpl& copy) : SocketSelectorImpl()
+    {
+        // An epoll instance can't be shared, register the sockets again in our own
+        for (const auto& [handle, entry] : copy.entries)
+            if (control(EPOLL_CTL_ADD, handle, entry.readiness))
+                entries.emplace(handle, entry);
+
+        readyHandles = copy.readyHandles;
+        readySockets = copy.readySockets;
+    }
+
+    SocketSelectorImpl& operator=(const SocketSelectorImpl&) = delete;
+
+    ~SocketSelectorImpl()
+    {
+        if (epollFd >= 0)
+            ::close(epollFd);
+    }
+
+    [[nodiscard]] bool control(int operation, SocketHandle handle, Readiness readiness) const
+    {
+        epoll_event event{};
+        event.data.fd = handle;
+        if (hasReadiness(readiness, Readiness::Read))
+            event.events |= EPOLLIN;
+        if (hasReadiness(readiness, Readiness::Write))
+            event.events |= EPOLLOUT;
+
+        return epoll_ctl(epollFd, operation, handle, &event) == 0;
+    }
+
+    int                       epollFd;      //!< Epoll instance watching the sockets
+    std::vector<epoll_event>  events;       //!< Events filled by epoll_wait
+    std::vector<SocketHandle> readyHandles; //!< Handles of the sockets that were ready after the last wait
+
+#else
+
+    fd_set allSockets{};          //!< Set containing all the sockets handles watched for reading
+    fd_set allWriteSockets{};     //!< Set containing all the sockets handles watched for writing
+    fd_set socketsReady{};        //!< Set containing handles of the sockets that are ready to read
+    fd_set socketsReadyToWrite{}; //!< Set containing handles of the sockets that are ready to write
+    int    maxSocket{};           //!< Maximum socket handle
+    int    socketCount{};         //!< Number of socket handles
+
+#endif
+
+    std::unordered_map<SocketHandle, Entry> entries;      //!< Sockets of the selector, indexed by handle
+    std::vector<Socket*>                    readySockets; //!< Sockets that were ready after the last wait
 };
 
 
@@ -89,25 +175,49 @@ SocketSelector& SocketSelector::operator=(SocketSelector&&) noexcept = default;
 
 ////////////////////////////////////////////////////////////
 void SocketSelector::add(Socket& socket)
+{
+    add(socket, Readiness::Read);
+}
+
+
+////////////////////////////////////////////////////////////
+void SocketSelector::add(Socket& socket, Readiness readiness)
 {
     const SocketHandle handle = socket.getNativeHandle();
     if (handle != priv::SocketImpl::invalidSocket())
     {
 
-#if defined(SFML_SYSTEM_WINDOWS)
+#if defined(SFML_SOCKET_SELECTOR_EPOLL)
 
-        if (m_impl->socketCount >= FD_SETSIZE)
+        // The handle may already be registered, or may be a reused handle whose
+        // previous socket was closed (which silently removed it from the epoll set)
+        const auto it = m_impl->entries.find(handle);
+        if (it != m_impl->entries.end() && m_impl->control(EPOLL_CTL_MOD, handle, readiness))
         {
-            err() << "The socket can't be added to the selector because the "
-                  << "selector is full. This is a limitation of your operating "
-                  << "system's FD_SETSIZE setting.";
+            it->second = {&socket, readiness, false, false};
             return;
         }
 
-        if (FD_ISSET(handle, &m_impl->allSockets))
+        if (!m_impl->control(EPOLL_CTL_ADD, handle, readiness))
+        {
+            err() << "The socket can't be added to the selector: " << std::strerror(errno) << std::endl;
             return;
+        }
 
-        ++m_impl->socketCount;
+#elif defined(SFML_SYSTEM_WINDOWS)
+
+        if (m_impl->entries.count(handle) == 0)
+        {
+            if (m_impl->socketCount >= FD_SETSIZE)
+            {
+                err() << "The socket can't be added to the selector because the "
+                      << "selector is full. This is a limitation of your operating "
+                      << "system's FD_SETSIZE setting.";
+                return;
+            }
+
+            ++m_impl->socketCount;
+        }
 
 #else
 
@@ -124,7 +234,19 @@ void SocketSelector::add(Socket& socket)
 
 #endif
 
-        FD_SET(handle, &m_impl->allSockets);
+#if !defined(SFML_SOCKET_SELECTOR_EPOLL)
+
+        FD_CLR(handle, &m_impl->allSockets);
+        FD_CLR(handle, &m_impl->allWriteSockets);
+
+        if (hasReadiness(readiness, Readiness::Read))
+            FD_SET(handle, &m_impl->allSockets);
+        if (hasReadiness(readiness, Readiness::Write))
+            FD_SET(handle, &m_impl->allWriteSockets);
+
+#endif
+
+        m_impl->entries[handle] = {&socket, readiness, false, false};
     }
 }
 
@@ -135,23 +257,40 @@ void SocketSelector::remove(Socket& socket)
     const SocketHandle handle = socket.getNativeHandle();
     if (handle != priv::SocketImpl::invalidSocket())
     {
+        const auto it = m_impl->entries.find(handle);
+        if (it == m_impl->entries.end())
+            return;
 
-#if defined(SFML_SYSTEM_WINDOWS)
+        // Don't leave a dangling pointer in the list of ready sockets
+        if (it->second.readable || it->second.writable)
+        {
+            std::vector<Socket*>& readySockets = m_impl->readySockets;
+            readySockets.erase(std::remove(readySockets.begin(), readySockets.end(), it->second.socket),
+                               readySockets.end());
+        }
 
-        if (!FD_ISSET(handle, &m_impl->allSockets))
-            return;
+        m_impl->entries.erase(it);
 
-        --m_impl->socketCount;
+#if defined(SFML_SOCKET_SELECTOR_EPOLL)
+
+        // Fails harmlessly if the handle was already removed by closing it
+        epoll_event event{};
+        epoll_ctl(m_impl->epollFd, EPOLL_CTL_DEL, handle, &event);
 
 #else
 
-        if (handle >= FD_SETSIZE)
-            return;
+#if defined(SFML_SYSTEM_WINDOWS)
+
+        --m_impl->socketCount;
 
 #endif
 
         FD_CLR(handle, &m_impl->allSockets);
+        FD_CLR(handle, &m_impl->allWriteSockets);
         FD_CLR(handle, &m_impl->socketsReady);
+        FD_CLR(handle, &m_impl->socketsReadyToWrite);
+
+#endif
     }
 }
 
@@ -159,51 +298,147 @@ void SocketSelector::remove(Socket& socket)
 ////////////////////////////////////////////////////////////
 void SocketSelector::clear()
 {
+#if defined(SFML_SOCKET_SELECTOR_EPOLL)
+
+    for (const auto& [handle, entry] : m_impl->entries)
+    {
+        epoll_event event{};
+        epoll_ctl(m_impl->epollFd, EPOLL_CTL_DEL, handle, &event);
+    }
+
+#else
+
     FD_ZERO(&m_impl->allSockets);
+    FD_ZERO(&m_impl->allWriteSockets);
     FD_ZERO(&m_impl->socketsReady);
+    FD_ZERO(&m_impl->socketsReadyToWrite);
 
     m_impl->maxSocket   = 0;
     m_impl->socketCount = 0;
+
+#endif
+
+#if defined(SFML_SOCKET_SELECTOR_EPOLL)
+    m_impl->readyHandles.clear();
+#endif
+    m_impl->entries.clear();
+    m_impl->readySockets.clear();
 }
 
 
 ////////////////////////////////////////////////////////////
 bool SocketSelector::wait(Time timeout)
 {
+    m_impl->readySockets.clear();
+
+#if defined(SFML_SOCKET_SELECTOR_EPOLL)
+
+    // Forget about the sockets that were ready after the previous wait, without visiting the others
+    for (const SocketHandle handle : m_impl->readyHandles)
+    {
+        const auto it = m_impl->entries.find(handle);
+        if (it != m_impl->entries.end())
+            it->second.readable = it->second.writable = false;
+    }
+    m_impl->readyHandles.clear();
+
+    // Round the timeout up, so that a small timeout doesn't turn into busy polling
+    int timeoutMs = -1;
+    if (timeout != Time::Zero)
+        timeoutMs = static_cast<int>(
+            std::clamp((timeout.asMicroseconds() + 999) / 1000, std::int64_t{0}, std::int64_t{INT_MAX}));
+
+    // Every socket can be reported by a single call
+    m_impl->events.resize(std::max<std::size_t>(m_impl->entries.size(), 1));
+
+    // Wait until one of the sockets is ready, or timeout is reached
+    const int count = epoll_wait(m_impl->epollFd,
+                                 m_impl->events.data(),
+                                 static_cast<int>(std::min<std::size_t>(m_impl->events.size(), INT_MAX)),
+                                 timeoutMs);
+
+    for (int i = 0; i < count; ++i)
+    {
+        const epoll_event& event = m_impl->events[static_cast<std::size_t>(i)];
+
+        const auto it = m_impl->entries.find(event.data.fd);
+        if (it == m_impl->entries.end())
+            continue;
+
+        // Like select, report errors and hang-ups as readiness so that the next call reveals them
+        auto& entry    = it->second;
+        entry.readable = hasReadiness(entry.readiness, Readiness::Read) &&
+                         (event.events & (EPOLLIN | EPOLLHUP | EPOLLRDHUP | EPOLLERR)) != 0;
+        entry.writable = hasReadiness(entry.readiness, Readiness::Write) &&
+                         (event.events & (EPOLLOUT | EPOLLHUP | EPOLLERR)) != 0;
+
+        if (entry.readable || entry.writable)
+        {
+            m_impl->readyHandles.push_back(event.data.fd);
+            m_impl->readySockets.push_back(entry.socket);
+        }
+    }
+
+    return !m_impl->readySockets.empty();
+
+#else
+
     // Setup the timeout
     timeval time{};
     time.tv_sec  = static_cast<long>(timeout.asMicroseconds() / 1'000'000);
     time.tv_usec = static_cast<int>(timeout.asMicroseconds() % 1'000'000);
 
-    // Initialize the set that will contain the sockets that are ready
-    m_impl->socketsReady = m_impl->allSockets;
+    // Initialize the sets that will contain the sockets that are ready
+    m_impl->socketsReady        = m_impl->allSockets;
+    m_impl->socketsReadyToWrite = m_impl->allWriteSockets;
 
-    // Wait until one of the sockets is ready for reading, or timeout is reached
+    // Wait until one of the sockets is ready, or timeout is reached
     // The first parameter is ignored on Windows
-    const int count = select(m_impl->maxSocket + 1, &m_impl->socketsReady, nullptr, nullptr, timeout != Time::Zero ? &time : nullptr);
+    const int count = select(m_impl->maxSocket + 1,
+                             &m_impl->socketsReady,
+                             &m_impl->socketsReadyToWrite,
+                             nullptr,
+                             timeout != Time::Zero ? &time : nullptr);
+
+    for (auto& [handle, entry] : m_impl->entries)
+    {
+        entry.readable = entry.writable = false;
+        if (count <= 0)
+            continue;
+
+        entry.readable = FD_ISSET(handle, &m_impl->socketsReady) != 0;
+        entry.writable = FD_ISSET(handle, &m_impl->socketsReadyToWrite) != 0;
+
+        if (entry.readable || entry.writable)
+            m_impl->readySockets.push_back(entry.socket);
+    }
 
     return count > 0;
+
+#endif
 }
 
 
 ////////////////////////////////////////////////////////////
 bool SocketSelector::isReady(Socket& socket) const
 {
-    const SocketHandle handle = socket.getNativeHandle();
-    if (handle != priv::SocketImpl::invalidSocket())
-    {
-
-#if !defined(SFML_SYSTEM_WINDOWS)
+    const auto it = m_impl->entries.find(socket.getNativeHandle());
+    return it != m_impl->entries.end() && it->second.readable;
+}
 
-        if (handle >= FD_SETSIZE)
-            return false;
 
-#endif
+////////////////////////////////////////////////////////////
+bool SocketSelector::isReadyToWrite(Socket& socket) const
+{
+    const auto it = m_impl->entries.find(socket.getNativeHandle());
+    return it != m_impl->entries.end() && it->second.writable;
+}
 
-        return FD_ISSET(handle, &m_impl->socketsReady) != 0;
-    }
 
-    return false;
+////////////////////////////////////////////////////////////
+const std::vector<Socket*>& SocketSelector::getReadySockets() const
+{
+    return m_impl->readySockets;
 }
 
 } // namespace sf
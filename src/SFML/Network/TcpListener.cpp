@@ -31,6 +31,8 @@
 
 #include <SFML/System/Err.hpp>
 
+#include <algorithm>
+#include <limits>
 #include <ostream>
 
 
@@ -61,6 +63,62 @@ unsigned short TcpListener::getLocalPort() const
 }
 
 
+////////////////////////////////////////////////////////////
+void TcpListener::setReusePort(bool reusePort)
+{
+    m_reusePort = reusePort;
+}
+
+
+////////////////////////////////////////////////////////////
+bool TcpListener::getReusePort() const
+{
+    return m_reusePort;
+}
+
+
+////////////////////////////////////////////////////////////
+void TcpListener::setDeferAccept(Time delay)
+{
+    m_deferAccept = delay;
+}
+
+
+////////////////////////////////////////////////////////////
+Time TcpListener::getDeferAccept() const
+{
+    return m_deferAccept;
+}
+
+
+////////////////////////////////////////////////////////////
+void TcpListener::setSendBufferSize(std::size_t size)
+{
+    m_sendBufferSize = size;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t TcpListener::getSendBufferSize() const
+{
+    return m_sendBufferSize;
+}
+
+
+////////////////////////////////////////////////////////////
+void TcpListener::setReceiveBufferSize(std::size_t size)
+{
+    m_receiveBufferSize = size;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t TcpListener::getReceiveBufferSize() const
+{
+    return m_receiveBufferSize;
+}
+
+
 ////////////////////////////////////////////////////////////
 Socket::Status TcpListener::listen(unsigned short port, IpAddress address)
 {
@@ -74,6 +132,37 @@ Socket::Status TcpListener::listen(unsigned short port, IpAddress address)
     if (address == IpAddress::Broadcast)
         return Status::Error;
 
+    // Share the port with other listeners if requested; this must be done before binding
+    if (m_reusePort)
+    {
+#ifdef SO_REUSEPORT
+        int yes = 1;
+        if (setsockopt(getNativeHandle(), SOL_SOCKET, SO_REUSEPORT, reinterpret_cast<char*>(&yes), sizeof(yes)) == -1)
+        {
+            err() << "Failed to share port " << port << " with other listeners" << std::endl;
+            return Status::Error;
+        }
+#else
+        err() << "Failed to share port " << port << " with other listeners, this is not supported on this system"
+              << std::endl;
+        return Status::Error;
+#endif
+    }
+
+    // Set the buffer sizes inherited by the accepted sockets; the receive buffer must be in
+    // place before listening, as it determines the window scaling of the connections
+    const auto setBufferSize = [this](int option, std::size_t size)
+    {
+        int   value = static_cast<int>(std::min<std::size_t>(size, std::numeric_limits<int>::max()));
+        auto* data  = reinterpret_cast<char*>(&value);
+        return (size == 0) || (setsockopt(getNativeHandle(), SOL_SOCKET, option, data, sizeof(value)) != -1);
+    };
+    if (!setBufferSize(SO_SNDBUF, m_sendBufferSize) || !setBufferSize(SO_RCVBUF, m_receiveBufferSize))
+    {
+        err() << "Failed to set the size of the buffers of the connections on port " << port << std::endl;
+        return Status::Error;
+    }
+
     // Bind the socket to the specified port
     sockaddr_in addr = priv::SocketImpl::createAddress(address.toInteger(), port);
     if (bind(getNativeHandle(), reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) == -1)
@@ -91,6 +180,18 @@ Socket::Status TcpListener::listen(unsigned short port, IpAddress address)
         return Status::Error;
     }
 
+#ifdef TCP_DEFER_ACCEPT
+    // Only report connections once they have data to read
+    if (m_deferAccept > Time::Zero)
+    {
+        int        seconds = std::max(static_cast<int>((m_deferAccept.asMilliseconds() + 999) / 1000), 1);
+        auto*      value   = reinterpret_cast<char*>(&seconds);
+        const bool applied = setsockopt(getNativeHandle(), IPPROTO_TCP, TCP_DEFER_ACCEPT, value, sizeof(seconds)) != -1;
+        if (!applied)
+            err() << "Failed to defer accepting connections on port " << port << std::endl;
+    }
+#endif
+
     return Status::Done;
 }
 
@@ -122,9 +223,44 @@ Socket::Status TcpListener::accept(TcpSocket& socket)
     if (remote == priv::SocketImpl::invalidSocket())
         return priv::SocketImpl::getErrorStatus();
 
-    // Initialize the new connected socket
+    // Initialize the new connected socket, overriding the buffer sizes it inherited if it has its own
     socket.close();
     socket.create(remote);
+    socket.applyBufferSizes();
+
+    return Status::Done;
+}
+
+
+////////////////////////////////////////////////////////////
+Socket::Status TcpListener::accept(std::vector<TcpSocket>& sockets, std::size_t maxCount)
+{
+    if (maxCount == 0)
+        return Status::NotReady;
+
+    // The first connection follows the blocking mode of the listener
+    const Status status = accept(sockets.emplace_back());
+    if (status != Status::Done)
+    {
+        sockets.pop_back();
+        return status;
+    }
+
+    // Then take the connections that are already pending, without waiting for more
+    if (isBlocking())
+        priv::SocketImpl::setBlocking(getNativeHandle(), false);
+
+    for (std::size_t count = 1; count < maxCount; ++count)
+    {
+        if (accept(sockets.emplace_back()) != Status::Done)
+        {
+            sockets.pop_back();
+            break;
+        }
+    }
+
+    if (isBlocking())
+        priv::SocketImpl::setBlocking(getNativeHandle(), true);
 
     return Status::Done;
 }
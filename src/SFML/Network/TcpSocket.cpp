@@ -27,6 +27,7 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Network/IpAddress.hpp>
 #include <SFML/Network/Packet.hpp>
+#include <SFML/Network/PacketPoolImpl.hpp>
 #include <SFML/Network/SocketImpl.hpp>
 #include <SFML/Network/TcpSocket.hpp>
 
@@ -34,7 +35,11 @@
 
 #include <algorithm>
 #include <array>
+#include <limits>
 #include <ostream>
+#include <typeinfo>
+#include <utility>
+#include <vector>
 
 #include <cstring>
 
@@ -51,6 +56,40 @@ constexpr int flags = MSG_NOSIGNAL;
 #else
 constexpr int flags = 0;
 #endif
+
+// Size of the buffer receiving many packets at once
+constexpr std::size_t receiveBufferSize = 64 * 1024;
+
+// Maximum size of the data allocated when the size of an incoming packet is known; larger
+// packets grow as their data arrives, so that a bogus size can't trigger a huge allocation
+constexpr std::size_t maxPresize = 1024 * 1024;
+
+// Set an integer option of a socket
+bool setSocketOption(sf::SocketHandle handle, int level, int option, int value)
+{
+    if (handle == sf::priv::SocketImpl::invalidSocket())
+        return false;
+
+    return setsockopt(handle, level, option, reinterpret_cast<char*>(&value), sizeof(value)) != -1;
+}
+
+// Convert a buffer size to the value of a socket option
+int toBufferSizeOption(std::size_t size)
+{
+    return static_cast<int>(std::min<std::size_t>(size, std::numeric_limits<int>::max()));
+}
+
+// Get an integer option of a socket, or 0 if it can't be retrieved
+int getSocketOption(sf::SocketHandle handle, int level, int option)
+{
+    int                              value  = 0;
+    sf::priv::SocketImpl::AddrLength length = sizeof(value);
+    if ((handle == sf::priv::SocketImpl::invalidSocket()) ||
+        (getsockopt(handle, level, option, reinterpret_cast<char*>(&value), &length) == -1))
+        return 0;
+
+    return value;
+}
 } // namespace
 
 namespace sf
@@ -127,6 +166,9 @@ Socket::Status TcpSocket::connect(IpAddress remoteAddress, unsigned short remote
     // Create the internal socket if it doesn't exist
     create();
 
+    // The buffer sizes must be in place before the handshake, which negotiates the window scaling
+    applyBufferSizes();
+
     // Create the remote address
     sockaddr_in address = priv::SocketImpl::createAddress(remoteAddress.toInteger(), remotePort);
 
@@ -216,10 +258,65 @@ void TcpSocket::disconnect()
     close();
 
     // Reset the pending packet data
+    priv::releasePacketBuffer(m_pendingPacket.data);
     m_pendingPacket = PendingPacket();
 }
 
 
+////////////////////////////////////////////////////////////
+bool TcpSocket::setNoDelay(bool noDelay)
+{
+    return setSocketOption(getNativeHandle(), IPPROTO_TCP, TCP_NODELAY, noDelay ? 1 : 0);
+}
+
+
+////////////////////////////////////////////////////////////
+bool TcpSocket::setSendBufferSize(std::size_t size)
+{
+    // Create the socket if needed, so that the option can be set before connecting
+    create();
+
+    m_sendBufferSize = size;
+    return setSocketOption(getNativeHandle(), SOL_SOCKET, SO_SNDBUF, toBufferSizeOption(size));
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t TcpSocket::getSendBufferSize() const
+{
+    return static_cast<std::size_t>(std::max(getSocketOption(getNativeHandle(), SOL_SOCKET, SO_SNDBUF), 0));
+}
+
+
+////////////////////////////////////////////////////////////
+bool TcpSocket::setReceiveBufferSize(std::size_t size)
+{
+    // Create the socket if needed, so that the option can be set before connecting
+    create();
+
+    m_receiveBufferSize = size;
+    return setSocketOption(getNativeHandle(), SOL_SOCKET, SO_RCVBUF, toBufferSizeOption(size));
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t TcpSocket::getReceiveBufferSize() const
+{
+    return static_cast<std::size_t>(std::max(getSocketOption(getNativeHandle(), SOL_SOCKET, SO_RCVBUF), 0));
+}
+
+
+////////////////////////////////////////////////////////////
+bool TcpSocket::setQuickAck([[maybe_unused]] bool quickAck)
+{
+#ifdef TCP_QUICKACK
+    return setSocketOption(getNativeHandle(), IPPROTO_TCP, TCP_QUICKACK, quickAck ? 1 : 0);
+#else
+    return false;
+#endif
+}
+
+
 ////////////////////////////////////////////////////////////
 Socket::Status TcpSocket::send(const void* data, std::size_t size)
 {
@@ -308,60 +405,107 @@ Socket::Status TcpSocket::receive(void* data, std::size_t size, std::size_t& rec
 
 ////////////////////////////////////////////////////////////
 Socket::Status TcpSocket::send(Packet& packet)
+{
+    return send(&packet, 1);
+}
+
+
+////////////////////////////////////////////////////////////
+Socket::Status TcpSocket::send(Packet* packets, std::size_t count)
 {
     // TCP is a stream protocol, it doesn't preserve messages boundaries.
     // This means that we have to send the packet size first, so that the
     // receiver knows the actual end of the packet in the data stream.
 
-    // We allocate an extra memory block so that the size can be sent
-    // together with the data in a single call. This may seem inefficient,
-    // but it is actually required to avoid partial send, which could cause
-    // data corruption on the receiving end.
+    // The size and the data of the packets are gathered by the system in a
+    // single call, which avoids copying them into a contiguous block while
+    // still avoiding partial sends between the size and the data, which
+    // could cause data corruption on the receiving end.
 
-    // Get the data to send from the packet
-    std::size_t size = 0;
-    const void* data = packet.onSend(size);
+    // Packets are processed in batches that fit in the stack and stay
+    // below the limit of buffers per system call
+    constexpr std::size_t batchSize = 64;
 
-    // First convert the packet size to network byte order
-    std::uint32_t packetSize = htonl(static_cast<std::uint32_t>(size));
+    bool sentAny = false;
+    for (std::size_t first = 0; first < count; first += batchSize)
+    {
+        const std::size_t batchCount = std::min(batchSize, count - first);
 
-    // Allocate memory for the data block to send
-    m_blockToSendBuffer.resize(sizeof(packetSize) + size);
+        std::array<std::uint32_t, batchSize>                packetSizes{};
+        std::array<const std::byte*, batchSize>             packetData{};
+        std::array<std::size_t, batchSize>                  dataSizes{};
+        std::array<priv::SocketImpl::Buffer, batchSize * 2> buffers{};
 
-// Copy the packet size and data into the block to send
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wnull-dereference" // False positive.
-    std::memcpy(m_blockToSendBuffer.data(), &packetSize, sizeof(packetSize));
-#pragma GCC diagnostic pop
-    if (size > 0)
-        std::memcpy(m_blockToSendBuffer.data() + sizeof(packetSize), data, size);
+        // Get the data to send from the packets, and convert their size to network byte order
+        for (std::size_t i = 0; i < batchCount; ++i)
+        {
+            packetData[i]  = static_cast<const std::byte*>(packets[first + i].onSend(dataSizes[i]));
+            packetSizes[i] = htonl(static_cast<std::uint32_t>(dataSizes[i]));
+        }
 
-// These warnings are ignored here for portability, as even on Windows the
-// signature of `send` might change depending on whether Win32 or MinGW is
-// being used.
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wuseless-cast"
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wsign-conversion"
-    // Send the data block
-    std::size_t  sent   = 0;
-    const Status status = send(m_blockToSendBuffer.data() + packet.m_sendPos,
-                               static_cast<priv::SocketImpl::Size>(m_blockToSendBuffer.size() - packet.m_sendPos),
-                               sent);
-#pragma GCC diagnostic pop
-#pragma GCC diagnostic pop
+        // Loop until every byte of the batch has been sent
+        while (true)
+        {
+            // Describe what remains to be sent, starting where the previous calls stopped
+            std::size_t bufferCount = 0;
+            for (std::size_t i = 0; i < batchCount; ++i)
+            {
+                const std::size_t sendPos = packets[first + i].m_sendPos;
+
+                if (sendPos < sizeof(std::uint32_t))
+                {
+                    const auto* header     = reinterpret_cast<const std::byte*>(&packetSizes[i]);
+                    buffers[bufferCount++] = priv::SocketImpl::createBuffer(header + sendPos,
+                                                                            sizeof(std::uint32_t) - sendPos);
+                    if (dataSizes[i] > 0)
+                        buffers[bufferCount++] = priv::SocketImpl::createBuffer(packetData[i], dataSizes[i]);
+                }
+                else if (sendPos < sizeof(std::uint32_t) + dataSizes[i])
+                {
+                    const std::size_t offset = sendPos - sizeof(std::uint32_t);
+                    buffers[bufferCount++]   = priv::SocketImpl::createBuffer(packetData[i] + offset,
+                                                                              dataSizes[i] - offset);
+                }
+            }
 
-    // In the case of a partial send, record the location to resume from
-    if (status == Status::Partial)
-    {
-        packet.m_sendPos += sent;
-    }
-    else if (status == Status::Done)
-    {
-        packet.m_sendPos = 0;
+            if (bufferCount == 0)
+                break;
+
+            // Send the buffers
+            const long result = priv::SocketImpl::sendBuffers(getNativeHandle(), buffers.data(), bufferCount);
+
+            // Check for errors
+            if (result < 0)
+            {
+                const Status status = priv::SocketImpl::getErrorStatus();
+
+                // In the case of a partial send, the send position of each packet records the location to resume from
+                if ((status == Status::NotReady) && sentAny)
+                    return Status::Partial;
+
+                return status;
+            }
+
+            // Advance the send position of the packets by what was sent
+            auto sent = static_cast<std::size_t>(result);
+            sentAny   = sentAny || (sent > 0);
+            for (std::size_t i = 0; (i < batchCount) && (sent > 0); ++i)
+            {
+                std::size_t&      sendPos   = packets[first + i].m_sendPos;
+                const std::size_t remaining = sizeof(std::uint32_t) + dataSizes[i] - sendPos;
+                const std::size_t advance   = std::min(sent, remaining);
+
+                sendPos += advance;
+                sent -= advance;
+            }
+        }
     }
 
-    return status;
+    // Everything was sent, the packets can be sent again from the start
+    for (std::size_t i = 0; i < count; ++i)
+        packets[i].m_sendPos = 0;
+
+    return Status::Done;
 }
 
 
@@ -371,59 +515,174 @@ Socket::Status TcpSocket::receive(Packet& packet)
     // First clear the variables to fill
     packet.clear();
 
-    // We start by getting the size of the incoming packet
-    std::uint32_t packetSize = 0;
-    std::size_t   received   = 0;
-    if (m_pendingPacket.sizeReceived < sizeof(m_pendingPacket.size))
+    // Loop until we've received the entire packet: first its size (even a
+    // 4 byte variable may be received in more than one call), then its data,
+    // directly into the pending packet. Nothing is read beyond the end of the
+    // packet, so that the following packets can still be waited for with a
+    // selector.
+    while (!isPendingPacketComplete())
+    {
+        const auto [data, size] = getPendingSpace();
+
+        std::size_t  received = 0;
+        const Status status   = receive(data, size, received);
+        commitPendingData(received);
+
+        if (status != Status::Done)
+            return status;
+    }
+
+    takePendingPacket(packet);
+
+    return Status::Done;
+}
+
+
+////////////////////////////////////////////////////////////
+Socket::Status TcpSocket::receive(std::vector<Packet>&                         packets,
+                                  Packet::Compression                          compression,
+                                  std::shared_ptr<const CompressionDictionary> dictionary)
+{
+    // First clear the variables to fill
+    packets.clear();
+
+    // The compression must be set before the data is handed to the packet
+    const auto takePacket = [&]
+    {
+        Packet& packet = packets.emplace_back();
+        packet.setCompression(compression, dictionary);
+        takePendingPacket(packet);
+    };
+
+    if (m_receiveBuffer.empty())
+        m_receiveBuffer.resize(receiveBufferSize);
+
+    while (true)
     {
-        // Loop until we've received the entire size of the packet
-        // (even a 4 byte variable may be received in more than one call)
-        while (m_pendingPacket.sizeReceived < sizeof(m_pendingPacket.size))
+        std::size_t received = 0;
+        Status      status   = Status::Done;
+
+        const auto [data, size] = getPendingSpace();
+        if (size >= m_receiveBuffer.size())
         {
-            char*        data   = reinterpret_cast<char*>(&m_pendingPacket.size) + m_pendingPacket.sizeReceived;
-            const Status status = receive(data, sizeof(m_pendingPacket.size) - m_pendingPacket.sizeReceived, received);
-            m_pendingPacket.sizeReceived += received;
+            // The rest of a large packet is received directly into it
+            status = receive(data, size, received);
+            commitPendingData(received);
 
-            if (status != Status::Done)
-                return status;
+            if (isPendingPacketComplete())
+                takePacket();
+        }
+        else
+        {
+            // Receive everything that is available, then split it into packets
+            status = receive(m_receiveBuffer.data(), m_receiveBuffer.size(), received);
+
+            std::size_t offset = 0;
+            while (offset < received)
+            {
+                const auto [destination, space] = getPendingSpace();
+                const std::size_t count         = std::min(space, received - offset);
+                std::memcpy(destination, m_receiveBuffer.data() + offset, count);
+                commitPendingData(count);
+                offset += count;
+
+                if (isPendingPacketComplete())
+                    takePacket();
+            }
         }
 
-        // The packet size has been fully received
-        packetSize = ntohl(m_pendingPacket.size);
+        if (!packets.empty())
+            return Status::Done;
+
+        if (status != Status::Done)
+            return status;
     }
-    else
+}
+
+
+////////////////////////////////////////////////////////////
+std::pair<std::byte*, std::size_t> TcpSocket::getPendingSpace()
+{
+    if (m_pendingPacket.sizeReceived < sizeof(m_pendingPacket.size))
     {
-        // The packet size has already been received in a previous call
-        packetSize = ntohl(m_pendingPacket.size);
+        auto* size = reinterpret_cast<std::byte*>(&m_pendingPacket.size);
+        return {size + m_pendingPacket.sizeReceived, sizeof(m_pendingPacket.size) - m_pendingPacket.sizeReceived};
     }
 
-    // Loop until we receive all the packet data
-    std::array<char, 1024> buffer{};
-    while (m_pendingPacket.data.size() < packetSize)
+    // Grow the data of packets that are larger than what was allocated upfront
+    std::vector<std::byte>& data = m_pendingPacket.data;
+    if (m_pendingPacket.dataReceived == data.size())
+        data.resize(std::min<std::size_t>(ntohl(m_pendingPacket.size), data.size() * 2));
+
+    return {data.data() + m_pendingPacket.dataReceived, data.size() - m_pendingPacket.dataReceived};
+}
+
+
+////////////////////////////////////////////////////////////
+void TcpSocket::applyBufferSizes()
+{
+    if (m_sendBufferSize &&
+        !setSocketOption(getNativeHandle(), SOL_SOCKET, SO_SNDBUF, toBufferSizeOption(*m_sendBufferSize)))
+        err() << "Failed to set the size of the send buffer of a TCP socket" << std::endl;
+
+    if (m_receiveBufferSize &&
+        !setSocketOption(getNativeHandle(), SOL_SOCKET, SO_RCVBUF, toBufferSizeOption(*m_receiveBufferSize)))
+        err() << "Failed to set the size of the receive buffer of a TCP socket" << std::endl;
+}
+
+
+////////////////////////////////////////////////////////////
+void TcpSocket::commitPendingData(std::size_t size)
+{
+    if (m_pendingPacket.sizeReceived < sizeof(m_pendingPacket.size))
     {
-        // Receive a chunk of data
-        const std::size_t sizeToGet = std::min(packetSize - m_pendingPacket.data.size(), buffer.size());
-        const Status      status    = receive(buffer.data(), sizeToGet, received);
-        if (status != Status::Done)
-            return status;
+        m_pendingPacket.sizeReceived += size;
 
-        // Append it into the packet
-        if (received > 0)
+        // The packet size has been fully received: allocate the data once, unless the
+        // announced size is so large that it must be backed by data actually received
+        if (m_pendingPacket.sizeReceived == sizeof(m_pendingPacket.size))
         {
-            m_pendingPacket.data.resize(m_pendingPacket.data.size() + received);
-            std::byte* begin = m_pendingPacket.data.data() + m_pendingPacket.data.size() - received;
-            std::memcpy(begin, buffer.data(), received);
+            if (m_pendingPacket.data.capacity() == 0)
+                m_pendingPacket.data = priv::acquirePacketBuffer();
+
+            m_pendingPacket.data.resize(std::min<std::size_t>(ntohl(m_pendingPacket.size), maxPresize));
         }
     }
+    else
+    {
+        m_pendingPacket.dataReceived += size;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+bool TcpSocket::isPendingPacketComplete() const
+{
+    return (m_pendingPacket.sizeReceived == sizeof(m_pendingPacket.size)) &&
+           (m_pendingPacket.dataReceived == ntohl(m_pendingPacket.size));
+}
+
 
-    // We have received all the packet data: we can copy it to the user packet
-    if (!m_pendingPacket.data.empty())
+////////////////////////////////////////////////////////////
+void TcpSocket::takePendingPacket(Packet& packet)
+{
+    // Plain packets take ownership of the data, while derived and compressed
+    // packets get it through onReceive, which may transform it
+    if ((typeid(packet) == typeid(Packet)) && (packet.getCompression() == Packet::Compression::None))
+    {
+        packet.clear();
+        priv::releasePacketBuffer(packet.m_data);
+        packet.m_data = std::move(m_pendingPacket.data);
+    }
+    else if (!m_pendingPacket.data.empty())
+    {
         packet.onReceive(m_pendingPacket.data.data(), m_pendingPacket.data.size());
+    }
+
+    priv::releasePacketBuffer(m_pendingPacket.data);
 
     // Clear the pending packet data
     m_pendingPacket = PendingPacket();
-
-    return Status::Done;
 }
 
 } // namespace sf
@@ -0,0 +1,1139 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Network/Packet.hpp>
+#include <SFML/Network/PacketView.hpp>
+#include <SFML/Network/UdpConnection.hpp>
+#include <SFML/Network/UdpSocket.hpp>
+
+#include <SFML/System/Err.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <deque>
+#include <ostream>
+#include <random>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace
+{
+namespace UdpConnectionImpl
+{
+using Clock    = std::chrono::steady_clock;
+using Duration = Clock::duration;
+
+// Types of datagrams exchanged by connections
+enum class Type : std::uint8_t
+{
+    Connect = 1,
+    Accept,
+    Data,
+    Disconnect
+};
+
+// Set on the type of data datagrams that acknowledge datagrams of the peer
+constexpr std::uint8_t ackFlag = 0x80;
+
+// Set on the channel of the messages that are fragments of a bigger one
+constexpr std::uint8_t fragmentFlag = 0x80;
+
+// Sent with connection requests, so that unrelated datagrams are not taken for one
+constexpr std::uint32_t protocolId = 0x53465543;
+
+// Maximum size of the datagrams, which fits in the MTU of most network paths
+constexpr std::size_t datagramBudget = 1200;
+
+// Maximum size of a message (or fragment) in a datagram
+constexpr std::size_t fragmentSize = 1024;
+
+// Maximum number of unacknowledged reliable fragments per channel; this keeps the
+// identifiers of the messages in flight within a quarter of their range
+constexpr std::size_t maxUnackedFragments = 16384;
+
+// Distance after which incomplete unreliable messages are dropped
+constexpr std::uint16_t maxAssemblyDistance = 64;
+
+// Number of datagrams whose state is remembered, both sent and received
+constexpr std::size_t historySize = 1024;
+
+// Number of datagrams acknowledged by the bitfield, in addition to the most recent one
+constexpr std::size_t ackBitCount = 32;
+
+// Number of datagrams received with a single call
+constexpr std::size_t receiveBatchSize = 64;
+
+// Size of the buffer of each received datagram: one more byte than the biggest datagram of the
+// protocol, so that a datagram which was truncated can be told
+constexpr std::size_t receiveBufferSize = datagramBudget + 1;
+
+// Timings of the protocol
+constexpr Duration connectInterval             = std::chrono::milliseconds(100);
+constexpr Duration keepAliveInterval           = std::chrono::milliseconds(100);
+constexpr Duration unreliableLifetime          = std::chrono::milliseconds(250);
+constexpr Duration initialRetransmissionTimeout = std::chrono::milliseconds(200);
+constexpr Duration minRetransmissionTimeout    = std::chrono::milliseconds(20);
+constexpr Duration maxRetransmissionTimeout    = std::chrono::seconds(2);
+
+// Bounds of the congestion window
+constexpr std::size_t initialCongestionWindow = 16 * datagramBudget;
+constexpr std::size_t minCongestionWindow     = 2 * datagramBudget;
+constexpr std::size_t maxCongestionWindow     = 1024 * 1024;
+
+// Number of times the disconnection notice is sent, since it is not acknowledged
+constexpr int disconnectRepeats = 3;
+
+
+////////////////////////////////////////////////////////////
+// Is the sequence number a more recent than b, taking wrap-around into account?
+[[nodiscard]] constexpr bool isNewer(std::uint16_t a, std::uint16_t b)
+{
+    const auto distance = static_cast<std::uint16_t>(a - b);
+    return (distance != 0) && (distance < 0x8000);
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] sf::Time toTime(Duration duration)
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(duration);
+}
+
+
+////////////////////////////////////////////////////////////
+struct Fragment
+{
+    std::uint64_t                    serial{};  //!< Unique number, increasing in queue order
+    std::uint8_t                     channel{}; //!< Channel of the message
+    std::uint16_t                    id{};      //!< Identifier of the message in its channel
+    std::uint16_t                    index{};   //!< Index of the fragment in the message
+    std::uint16_t                    count{};   //!< Number of fragments of the message
+    std::vector<std::uint8_t>        data;      //!< Payload of the fragment
+    Clock::time_point                queued;    //!< Time when the message was queued
+    std::optional<Clock::time_point> lastSent;  //!< Time of the last transmission
+    bool                             acked{};   //!< Was the fragment acknowledged by the peer?
+};
+
+
+////////////////////////////////////////////////////////////
+struct SentDatagram
+{
+    std::uint16_t              sequence{}; //!< Sequence number of the datagram
+    bool                       inFlight{}; //!< Is the datagram waiting for an acknowledgement?
+    Clock::time_point          time;       //!< Time when the datagram was sent
+    std::size_t                size{};     //!< Size of the datagram
+    std::vector<std::uint64_t> serials;    //!< Reliable fragments carried by the datagram
+};
+
+
+////////////////////////////////////////////////////////////
+struct Assembly
+{
+    std::vector<std::vector<std::uint8_t>> fragments;  //!< Fragments received so far (empty if missing)
+    std::size_t                            received{}; //!< Number of fragments received so far
+};
+
+
+////////////////////////////////////////////////////////////
+struct Channel
+{
+    std::uint16_t                                                nextSendId{};       //!< Identifier of the next message sent
+    std::size_t                                                  unackedFragments{}; //!< Number of reliable fragments not acknowledged yet
+    std::uint16_t                                                nextReceiveId{};    //!< Identifier of the next reliable message to deliver
+    std::optional<std::uint16_t>                                 lastReceivedId;     //!< Most recent unreliable message
+    std::unordered_map<std::uint16_t, std::vector<std::uint8_t>> pending;            //!< Complete reliable messages received out of order
+    std::unordered_map<std::uint16_t, Assembly>                  assemblies;         //!< Fragmented messages being received
+};
+
+
+////////////////////////////////////////////////////////////
+struct Message
+{
+    std::uint8_t              channel{}; //!< Channel the message was received on
+    std::vector<std::uint8_t> data;      //!< Payload of the message
+};
+
+
+////////////////////////////////////////////////////////////
+struct DelayedDatagram
+{
+    Clock::time_point         time; //!< Time when the datagram must be sent
+    std::vector<std::uint8_t> data; //!< Contents of the datagram
+};
+} // namespace UdpConnectionImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+struct UdpConnection::Impl
+{
+    using Clock           = UdpConnectionImpl::Clock;
+    using Duration        = UdpConnectionImpl::Duration;
+    using Fragment        = UdpConnectionImpl::Fragment;
+    using SentDatagram    = UdpConnectionImpl::SentDatagram;
+    using Channel         = UdpConnectionImpl::Channel;
+    using Message         = UdpConnectionImpl::Message;
+    using DelayedDatagram = UdpConnectionImpl::DelayedDatagram;
+    using ReceiveStorage  = std::array<std::byte,
+                                      UdpConnectionImpl::receiveBatchSize * UdpConnectionImpl::receiveBufferSize>;
+    using ReceiveBuffers  = std::array<UdpSocket::DatagramBuffer, UdpConnectionImpl::receiveBatchSize>;
+
+    Impl()
+    {
+        socket.setBlocking(false);
+        deliveries.fill(Delivery::ReliableOrdered);
+        reset();
+
+        for (std::size_t i = 0; i < buffers.size(); ++i)
+        {
+            buffers[i].data = storage.data() + i * UdpConnectionImpl::receiveBufferSize;
+            buffers[i].size = UdpConnectionImpl::receiveBufferSize;
+        }
+    }
+
+    ////////////////////////////////////////////////////////////
+    void reset()
+    {
+        state = State::Disconnected;
+        remoteAddress.reset();
+        remotePort = 0;
+        session    = 0;
+
+        channels = {};
+        inbox.clear();
+        reliableQueue.clear();
+        unreliableQueue.clear();
+        delayed.clear();
+
+        localSequence = 0;
+        remoteSequence.reset();
+        sentDatagrams = {};
+        receivedSequences.fill(-1);
+        inFlight.clear();
+        unackedSequences.clear();
+
+        smoothedRtt.reset();
+        rttVariance        = {};
+        congestionWindow   = UdpConnectionImpl::initialCongestionWindow;
+        slowStartThreshold = UdpConnectionImpl::maxCongestionWindow;
+        bytesInFlight      = 0;
+        tokens             = static_cast<double>(UdpConnectionImpl::initialCongestionWindow);
+        lastReduction.reset();
+        statistics = {};
+    }
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Duration retransmissionTimeout() const
+    {
+        if (!smoothedRtt)
+            return UdpConnectionImpl::initialRetransmissionTimeout;
+
+        return std::clamp(*smoothedRtt + 4 * rttVariance,
+                          UdpConnectionImpl::minRetransmissionTimeout,
+                          UdpConnectionImpl::maxRetransmissionTimeout);
+    }
+
+    ////////////////////////////////////////////////////////////
+    void sendDatagram(const void* data, std::size_t size, Clock::time_point now)
+    {
+        ++statistics.datagramsSent;
+        lastSent = now;
+
+        const bool simulated = (simulator.packetLoss > 0.f) || (simulator.duplication > 0.f) ||
+                               (simulator.latency != Time::Zero) || (simulator.jitter != Time::Zero);
+        if (!simulated)
+        {
+            // Errors are not reported: the datagram is lost, and reliability takes care of it
+            [[maybe_unused]] const Socket::Status status = socket.send(data, size, *remoteAddress, remotePort);
+            return;
+        }
+
+        std::uniform_real_distribution<float> distribution(0.f, 1.f);
+        if (distribution(random) < simulator.packetLoss)
+            return;
+
+        const int copies = (distribution(random) < simulator.duplication) ? 2 : 1;
+        for (int i = 0; i < copies; ++i)
+        {
+            const Time     variation = simulator.jitter * (distribution(random) * 2.f - 1.f);
+            const Duration delay     = std::max(Duration::zero(),
+                                            Duration((simulator.latency + variation).toDuration()));
+
+            const auto* bytes = static_cast<const std::uint8_t*>(data);
+            delayed.push_back({now + delay, std::vector<std::uint8_t>(bytes, bytes + size)});
+        }
+
+        flushDelayed(now);
+    }
+
+    ////////////////////////////////////////////////////////////
+    void flushDelayed(Clock::time_point now)
+    {
+        std::stable_sort(delayed.begin(),
+                         delayed.end(),
+                         [](const auto& left, const auto& right) { return left.time < right.time; });
+
+        auto it = delayed.begin();
+        for (; (it != delayed.end()) && (it->time <= now); ++it)
+            [[maybe_unused]] const Socket::Status status = socket.send(it->data.data(),
+                                                                       it->data.size(),
+                                                                       *remoteAddress,
+                                                                       remotePort);
+
+        delayed.erase(delayed.begin(), it);
+    }
+
+    ////////////////////////////////////////////////////////////
+    void sendControl(UdpConnectionImpl::Type type, Clock::time_point now)
+    {
+        datagram.clear();
+        datagram << static_cast<std::uint8_t>(type) << session;
+        if (type == UdpConnectionImpl::Type::Connect)
+            datagram << UdpConnectionImpl::protocolId;
+
+        sendDatagram(datagram.getData(), datagram.getDataSize(), now);
+    }
+
+    ////////////////////////////////////////////////////////////
+    void handleDatagram(PacketView& view, IpAddress address, unsigned short port, Clock::time_point now)
+    {
+        std::uint8_t  typeAndFlags = 0;
+        std::uint32_t peerSession  = 0;
+        if (!(view >> typeAndFlags >> peerSession))
+            return;
+
+        const auto type = static_cast<UdpConnectionImpl::Type>(typeAndFlags & ~UdpConnectionImpl::ackFlag);
+
+        // Accept the first peer that sends a valid connection request
+        if (state == State::Listening)
+        {
+            std::uint32_t id = 0;
+            if ((type != UdpConnectionImpl::Type::Connect) || !(view >> id) || (id != UdpConnectionImpl::protocolId))
+                return;
+
+            remoteAddress = address;
+            remotePort    = port;
+            session       = peerSession;
+            state         = State::Connected;
+            lastReceived  = now;
+            lastRefill    = now;
+            ++statistics.datagramsReceived;
+            sendControl(UdpConnectionImpl::Type::Accept, now);
+            return;
+        }
+
+        // Ignore everything that doesn't come from our peer
+        if ((state == State::Disconnected) || (address != *remoteAddress) || (port != remotePort) ||
+            (peerSession != session))
+            return;
+
+        lastReceived = now;
+        ++statistics.datagramsReceived;
+
+        switch (type)
+        {
+            case UdpConnectionImpl::Type::Connect:
+                // Our acceptance was lost
+                sendControl(UdpConnectionImpl::Type::Accept, now);
+                break;
+
+            case UdpConnectionImpl::Type::Accept:
+                if (state == State::Connecting)
+                    state = State::Connected;
+                break;
+
+            case UdpConnectionImpl::Type::Data:
+                // The acceptance may have been lost while data was not
+                state = State::Connected;
+                handleData(view, (typeAndFlags & UdpConnectionImpl::ackFlag) != 0, now);
+                break;
+
+            case UdpConnectionImpl::Type::Disconnect:
+                reset();
+                break;
+        }
+    }
+
+    ////////////////////////////////////////////////////////////
+    void handleData(PacketView& view, bool hasAcks, Clock::time_point now)
+    {
+        std::uint16_t sequence = 0;
+        std::uint16_t ack      = 0;
+        std::uint32_t ackBits  = 0;
+        if (!(view >> sequence >> ack >> ackBits))
+            return;
+
+        if (hasAcks)
+            processAcks(ack, ackBits, now);
+
+        // Skip the messages of datagrams that are duplicated or too old to tell
+        auto& received = receivedSequences[sequence % UdpConnectionImpl::historySize];
+        if (received == sequence)
+            return;
+        if (remoteSequence && !UdpConnectionImpl::isNewer(sequence, *remoteSequence) &&
+            (static_cast<std::uint16_t>(*remoteSequence - sequence) >= UdpConnectionImpl::historySize))
+            return;
+
+        received = sequence;
+        if (!remoteSequence || UdpConnectionImpl::isNewer(sequence, *remoteSequence))
+            remoteSequence = sequence;
+
+        while (!view.endOfPacket())
+        {
+            std::uint8_t  channelAndFlags = 0;
+            std::uint16_t id              = 0;
+            std::uint16_t index           = 0;
+            std::uint16_t count           = 1;
+            std::uint16_t size            = 0;
+
+            view >> channelAndFlags >> id;
+            const bool fragmented = (channelAndFlags & UdpConnectionImpl::fragmentFlag) != 0;
+            if (fragmented)
+                view >> index >> count;
+            view >> size;
+
+            const auto channel = static_cast<std::uint8_t>(channelAndFlags & ~UdpConnectionImpl::fragmentFlag);
+            if (!view || (channel >= ChannelCount) || (size > UdpConnectionImpl::fragmentSize) ||
+                (fragmented && ((count < 2) || (index >= count) || (size == 0) ||
+                                (count > MaxMessageSize / UdpConnectionImpl::fragmentSize))))
+                return;
+
+            std::vector<std::uint8_t> data(size);
+            if (!view.read(data.data(), data.size()))
+                return;
+
+            if (unackedSequences.empty() || (unackedSequences.back() != sequence))
+                unackedSequences.push_back(sequence);
+
+            handleMessage(channel, id, index, count, std::move(data));
+        }
+    }
+
+    ////////////////////////////////////////////////////////////
+    void handleMessage(std::uint8_t              channelIndex,
+                       std::uint16_t             id,
+                       std::uint16_t             index,
+                       std::uint16_t             count,
+                       std::vector<std::uint8_t> data)
+    {
+        Channel& channel = channels[channelIndex];
+
+        switch (deliveries[channelIndex])
+        {
+            case Delivery::ReliableOrdered:
+            {
+                // Ignore the messages already delivered, and the ones too far ahead to be legitimate
+                const auto distance = static_cast<std::uint16_t>(id - channel.nextReceiveId);
+                if ((distance >= UdpConnectionImpl::maxUnackedFragments) || (channel.pending.count(id) != 0))
+                    return;
+
+                if (auto message = assemble(channel, id, index, count, std::move(data)))
+                    channel.pending.emplace(id, std::move(*message));
+
+                // Deliver all the messages that are now in order
+                for (auto it = channel.pending.find(channel.nextReceiveId); it != channel.pending.end();
+                     it      = channel.pending.find(channel.nextReceiveId))
+                {
+                    inbox.push_back({channelIndex, std::move(it->second)});
+                    channel.pending.erase(it);
+                    ++channel.nextReceiveId;
+                }
+                break;
+            }
+
+            case Delivery::UnreliableSequenced:
+            {
+                // Drop the messages older than the last one delivered
+                if (channel.lastReceivedId && !UdpConnectionImpl::isNewer(id, *channel.lastReceivedId))
+                    return;
+
+                if (auto message = assemble(channel, id, index, count, std::move(data)))
+                {
+                    inbox.push_back({channelIndex, std::move(*message)});
+                    channel.lastReceivedId = id;
+
+                    // Incomplete older messages can't be delivered anymore
+                    for (auto it = channel.assemblies.begin(); it != channel.assemblies.end();)
+                        it = UdpConnectionImpl::isNewer(it->first, id) ? std::next(it) : channel.assemblies.erase(it);
+                }
+                break;
+            }
+
+            case Delivery::Unreliable:
+            {
+                if (!channel.lastReceivedId || UdpConnectionImpl::isNewer(id, *channel.lastReceivedId))
+                    channel.lastReceivedId = id;
+
+                if (auto message = assemble(channel, id, index, count, std::move(data)))
+                    inbox.push_back({channelIndex, std::move(*message)});
+
+                // Give up on the incomplete messages that are much older than the last one
+                for (auto it = channel.assemblies.begin(); it != channel.assemblies.end();)
+                {
+                    const auto distance = static_cast<std::uint16_t>(*channel.lastReceivedId - it->first);
+                    it = (distance < UdpConnectionImpl::maxAssemblyDistance) ? std::next(it)
+                                                                             : channel.assemblies.erase(it);
+                }
+                break;
+            }
+        }
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Add a fragment to its message, and return the message once it is complete
+    [[nodiscard]] static std::optional<std::vector<std::uint8_t>> assemble(Channel& channel,
+                                                                           std::uint16_t               id,
+                                                                           std::uint16_t               index,
+                                                                           std::uint16_t               count,
+                                                                           std::vector<std::uint8_t>   data)
+    {
+        if (count == 1)
+            return data;
+
+        UdpConnectionImpl::Assembly& assembly = channel.assemblies[id];
+        if (assembly.fragments.empty())
+            assembly.fragments.resize(count);
+
+        // Ignore duplicated fragments and inconsistent ones
+        if ((assembly.fragments.size() != count) || !assembly.fragments[index].empty())
+            return std::nullopt;
+
+        assembly.fragments[index] = std::move(data);
+        if (++assembly.received < count)
+            return std::nullopt;
+
+        std::vector<std::uint8_t> message;
+        message.reserve(count * UdpConnectionImpl::fragmentSize);
+        for (const auto& fragment : assembly.fragments)
+            message.insert(message.end(), fragment.begin(), fragment.end());
+
+        channel.assemblies.erase(id);
+        return message;
+    }
+
+    ////////////////////////////////////////////////////////////
+    void processAcks(std::uint16_t ack, std::uint32_t ackBits, Clock::time_point now)
+    {
+        bool ackedFragments = false;
+
+        for (std::size_t i = 0; i <= UdpConnectionImpl::ackBitCount; ++i)
+        {
+            if ((i > 0) && ((ackBits & (1u << (i - 1))) == 0))
+                continue;
+
+            const auto sequence = static_cast<std::uint16_t>(ack - i);
+            auto&      sent     = sentDatagrams[sequence % UdpConnectionImpl::historySize];
+            if ((sent.sequence != sequence) || !sent.inFlight)
+                continue;
+
+            sent.inFlight = false;
+            bytesInFlight -= sent.size;
+
+            // Only the most recent datagram gives a sample free of acknowledgement delays
+            if (i == 0)
+                updateRoundTripTime(now - sent.time);
+
+            // Grow the congestion window: exponentially during slow start, then linearly
+            if (congestionWindow < slowStartThreshold)
+                congestionWindow += sent.size;
+            else
+                congestionWindow += std::max(UdpConnectionImpl::datagramBudget * sent.size / congestionWindow,
+                                             std::size_t{1});
+            congestionWindow = std::min(congestionWindow, UdpConnectionImpl::maxCongestionWindow);
+
+            // The queue is sorted by serial, so the fragments can be found with a binary search
+            for (const std::uint64_t serial : sent.serials)
+            {
+                const auto it = std::lower_bound(reliableQueue.begin(),
+                                                 reliableQueue.end(),
+                                                 serial,
+                                                 [](const auto& fragment, std::uint64_t value)
+                                                 { return fragment.serial < value; });
+                if ((it != reliableQueue.end()) && (it->serial == serial) && !it->acked)
+                {
+                    it->acked = true;
+                    --channels[it->channel].unackedFragments;
+                    ackedFragments = true;
+                }
+            }
+        }
+
+        if (ackedFragments)
+            reliableQueue.erase(std::remove_if(reliableQueue.begin(),
+                                               reliableQueue.end(),
+                                               [](const auto& fragment) { return fragment.acked; }),
+                                reliableQueue.end());
+    }
+
+    ////////////////////////////////////////////////////////////
+    void updateRoundTripTime(Duration sample)
+    {
+        // Estimator of RFC 6298
+        if (!smoothedRtt)
+        {
+            smoothedRtt = sample;
+            rttVariance = sample / 2;
+        }
+        else
+        {
+            const Duration deviation = (*smoothedRtt > sample) ? *smoothedRtt - sample : sample - *smoothedRtt;
+            rttVariance              = (rttVariance * 3 + deviation) / 4;
+            smoothedRtt              = (*smoothedRtt * 7 + sample) / 8;
+        }
+    }
+
+    ////////////////////////////////////////////////////////////
+    void onLoss(SentDatagram& sent, Clock::time_point now)
+    {
+        sent.inFlight = false;
+        bytesInFlight -= sent.size;
+        ++statistics.datagramsLost;
+
+        // Halve the congestion window, at most once per round trip
+        if (!lastReduction || (now - *lastReduction >= smoothedRtt.value_or(retransmissionTimeout())))
+        {
+            slowStartThreshold = std::max(congestionWindow / 2, UdpConnectionImpl::minCongestionWindow);
+            congestionWindow   = slowStartThreshold;
+            lastReduction      = now;
+        }
+    }
+
+    ////////////////////////////////////////////////////////////
+    void detectLosses(Clock::time_point now)
+    {
+        // Datagrams are in flight in the order they were sent, so only the oldest ones need to be checked
+        const Duration resendDelay = retransmissionTimeout();
+        while (!inFlight.empty())
+        {
+            auto& sent = sentDatagrams[inFlight.front() % UdpConnectionImpl::historySize];
+            if ((sent.sequence == inFlight.front()) && sent.inFlight)
+            {
+                if (now - sent.time < resendDelay)
+                    break;
+
+                onLoss(sent, now);
+            }
+
+            inFlight.pop_front();
+        }
+    }
+
+    ////////////////////////////////////////////////////////////
+    void sendData(Clock::time_point now)
+    {
+        // Refill the pacing budget, which spreads a congestion window over a round trip
+        using Seconds = std::chrono::duration<double>;
+
+        const Seconds roundTrip = smoothedRtt.value_or(UdpConnectionImpl::initialRetransmissionTimeout);
+        const double  rate      = static_cast<double>(congestionWindow) / std::max(roundTrip.count(), 0.001);
+        const double  burst     = static_cast<double>(
+            std::max(UdpConnectionImpl::minCongestionWindow, congestionWindow / 4));
+
+        tokens     = std::min(burst, tokens + rate * Seconds(now - lastRefill).count());
+        lastRefill = now;
+
+        // Messages that waited too long are not worth sending anymore
+        const auto isStale = [now](const auto& fragment)
+        { return now - fragment.queued > UdpConnectionImpl::unreliableLifetime; };
+        while (!unreliableQueue.empty() && isStale(unreliableQueue.front()))
+            unreliableQueue.pop_front();
+
+        const Duration resendDelay = retransmissionTimeout();
+        std::size_t    next        = 0;
+        bool           sentAny     = false;
+
+        for (;;)
+        {
+            // The first datagram acknowledges the most recent one received; if the peer sent more datagrams
+            // than a bitfield covers since the last update, the following ones acknowledge the older ones
+            std::uint16_t ackBase = remoteSequence.value_or(0);
+            if (sentAny && !unackedSequences.empty())
+                ackBase = *std::max_element(unackedSequences.begin(),
+                                            unackedSequences.end(),
+                                            [](std::uint16_t left, std::uint16_t right)
+                                            { return UdpConnectionImpl::isNewer(right, left); });
+
+            datagram.clear();
+            datagram << static_cast<std::uint8_t>(static_cast<std::uint8_t>(UdpConnectionImpl::Type::Data) |
+                                                  (remoteSequence ? UdpConnectionImpl::ackFlag : 0))
+                     << session << localSequence << ackBase << getAckBits(ackBase);
+
+            std::vector<std::uint64_t> serials;
+            bool                       hasMessages = false;
+
+            if ((bytesInFlight + UdpConnectionImpl::datagramBudget <= congestionWindow) && (tokens > 0.0))
+            {
+                // Reliable fragments that were never sent, or not acknowledged in time
+                for (; next < reliableQueue.size(); ++next)
+                {
+                    Fragment& fragment = reliableQueue[next];
+                    if (fragment.lastSent && (now - *fragment.lastSent < resendDelay))
+                        continue;
+
+                    if (!write(fragment))
+                        break;
+
+                    if (fragment.lastSent)
+                        ++statistics.messagesResent;
+
+                    fragment.lastSent = now;
+                    serials.push_back(fragment.serial);
+                    hasMessages = true;
+                }
+
+                // Unreliable messages are sent once
+                while (!unreliableQueue.empty() && write(unreliableQueue.front()))
+                {
+                    unreliableQueue.pop_front();
+                    hasMessages = true;
+                }
+            }
+
+            // Acknowledge received messages and keep the connection alive even when there's nothing else to send
+            if (!hasMessages && unackedSequences.empty() &&
+                (sentAny || (now - lastSent < UdpConnectionImpl::keepAliveInterval)))
+                break;
+
+            // Remember the datagram, to handle its acknowledgement or loss
+            auto& sent = sentDatagrams[localSequence % UdpConnectionImpl::historySize];
+            if (sent.inFlight)
+                onLoss(sent, now);
+
+            sent.sequence = localSequence;
+            sent.inFlight = hasMessages;
+            sent.time     = now;
+            sent.size     = hasMessages ? datagram.getDataSize() : 0;
+            sent.serials  = std::move(serials);
+
+            if (hasMessages)
+            {
+                inFlight.push_back(localSequence);
+                bytesInFlight += sent.size;
+                tokens -= static_cast<double>(sent.size);
+            }
+
+            sendDatagram(datagram.getData(), datagram.getDataSize(), now);
+            ++localSequence;
+            sentAny = true;
+
+            // Forget the received datagrams that this one acknowledges
+            unackedSequences.erase(std::remove_if(unackedSequences.begin(),
+                                                  unackedSequences.end(),
+                                                  [ackBase](std::uint16_t sequence)
+                                                  {
+                                                      return static_cast<std::uint16_t>(ackBase - sequence) <=
+                                                             UdpConnectionImpl::ackBitCount;
+                                                  }),
+                                   unackedSequences.end());
+
+            if (!hasMessages && unackedSequences.empty())
+                break;
+        }
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Append a fragment to the datagram being built, if it fits
+    [[nodiscard]] bool write(const Fragment& fragment)
+    {
+        const bool        fragmented = fragment.count > 1;
+        const std::size_t size       = datagram.getDataSize() + (fragmented ? 9 : 5) + fragment.data.size();
+        if (size > UdpConnectionImpl::datagramBudget)
+            return false;
+
+        datagram << static_cast<std::uint8_t>(fragment.channel | (fragmented ? UdpConnectionImpl::fragmentFlag : 0))
+                 << fragment.id;
+        if (fragmented)
+            datagram << fragment.index << fragment.count;
+        datagram << static_cast<std::uint16_t>(fragment.data.size());
+        datagram.append(fragment.data.data(), fragment.data.size());
+        return true;
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Get the bitfield acknowledging the datagrams that precede the given one
+    [[nodiscard]] std::uint32_t getAckBits(std::uint16_t ackBase) const
+    {
+        if (!remoteSequence)
+            return 0;
+
+        std::uint32_t bits = 0;
+        for (std::size_t i = 1; i <= UdpConnectionImpl::ackBitCount; ++i)
+        {
+            const auto sequence = static_cast<std::uint16_t>(ackBase - i);
+            if (receivedSequences[sequence % UdpConnectionImpl::historySize] == sequence)
+                bits |= 1u << (i - 1);
+        }
+
+        return bits;
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    UdpSocket                                                socket;                             //!< Socket used to exchange datagrams with the peer
+    State                                                    state{};                            //!< State of the connection
+    std::optional<IpAddress>                                 remoteAddress;                      //!< Address of the peer
+    unsigned short                                           remotePort{};                       //!< Port of the peer
+    std::uint32_t                                            session{};                          //!< Random identifier of the connection, chosen by the connecting peer
+    Duration                                                 timeout{std::chrono::seconds(10)};  //!< Maximum time without hearing from the peer
+    Clock::time_point                                        lastReceived;                       //!< Time of the last datagram received from the peer
+    Clock::time_point                                        lastSent;                           //!< Time of the last datagram sent to the peer
+    Clock::time_point                                        lastConnectSent;                    //!< Time of the last connection request
+    std::array<Delivery, ChannelCount>                       deliveries{};                       //!< Delivery guarantees of each channel
+    std::array<Channel, ChannelCount>                        channels;                           //!< State of each channel
+    std::deque<Message>                                      inbox;                              //!< Messages ready to be taken by receive
+    std::deque<Fragment>                                     reliableQueue;                      //!< Reliable fragments not acknowledged yet
+    std::deque<Fragment>                                     unreliableQueue;                    //!< Unreliable fragments not sent yet
+    std::uint64_t                                            nextSerial{};                       //!< Serial of the next queued fragment
+    std::uint16_t                                            localSequence{};                    //!< Sequence number of the next datagram sent
+    std::optional<std::uint16_t>                             remoteSequence;                     //!< Most recent sequence number received
+    std::array<SentDatagram, UdpConnectionImpl::historySize> sentDatagrams;                      //!< History of sent datagrams
+    std::array<std::int32_t, UdpConnectionImpl::historySize> receivedSequences{};                //!< History of received datagrams (-1 if none)
+    std::deque<std::uint16_t>                                inFlight;                           //!< Sequence numbers of the datagrams in flight, oldest first
+    std::vector<std::uint16_t>                               unackedSequences;                   //!< Received datagrams carrying messages, not acknowledged yet
+    std::optional<Duration>                                  smoothedRtt;                        //!< Smoothed round-trip time
+    Duration                                                 rttVariance{};                      //!< Mean deviation of the round-trip time
+    std::size_t                                              congestionWindow{};                 //!< Number of bytes allowed in flight
+    std::size_t                                              slowStartThreshold{};               //!< Congestion window where slow start ends
+    std::size_t                                              bytesInFlight{};                    //!< Number of bytes in flight
+    double                                                   tokens{};                           //!< Number of bytes that pacing allows to send right now
+    Clock::time_point                                        lastRefill;                         //!< Time of the last refill of the pacing budget
+    std::optional<Clock::time_point>                         lastReduction;                      //!< Time of the last reduction of the congestion window
+    Statistics                                               statistics;                         //!< Counters reported by getStatistics
+    Simulator                                                simulator;                          //!< Degradation applied to outgoing datagrams
+    std::minstd_rand                                         random;                             //!< Random generator of the simulator
+    std::vector<DelayedDatagram>                             delayed;                            //!< Datagrams delayed by the simulator
+    Packet                                                   datagram;                           //!< Datagram being built
+    ReceiveStorage                                           storage{};                          //!< Storage of the receive buffers
+    ReceiveBuffers                                           buffers;                            //!< Buffers receiving datagrams
+};
+
+
+////////////////////////////////////////////////////////////
+UdpConnection::UdpConnection() : m_impl(std::make_unique<Impl>())
+{
+}
+
+
+////////////////////////////////////////////////////////////
+UdpConnection::~UdpConnection() = default;
+
+
+////////////////////////////////////////////////////////////
+UdpConnection::UdpConnection(UdpConnection&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+UdpConnection& UdpConnection::operator=(UdpConnection&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+Socket::Status UdpConnection::bind(unsigned short port, IpAddress address)
+{
+    return m_impl->socket.bind(port, address);
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned short UdpConnection::getLocalPort() const
+{
+    return m_impl->socket.getLocalPort();
+}
+
+
+////////////////////////////////////////////////////////////
+void UdpConnection::listen()
+{
+    disconnect();
+
+    if (getLocalPort() == 0)
+    {
+        err() << "Failed to listen for UDP connections (the connection is not bound to a port)" << std::endl;
+        return;
+    }
+
+    m_impl->state = State::Listening;
+}
+
+
+////////////////////////////////////////////////////////////
+void UdpConnection::connect(IpAddress remoteAddress, unsigned short remotePort)
+{
+    disconnect();
+
+    if ((getLocalPort() == 0) && (bind(Socket::AnyPort) != Socket::Status::Done))
+        return;
+
+    // Both peers identify the connection by a random number, so that late datagrams of a previous one are ignored
+    std::random_device device;
+
+    const auto now          = Impl::Clock::now();
+    m_impl->state           = State::Connecting;
+    m_impl->remoteAddress   = remoteAddress;
+    m_impl->remotePort      = remotePort;
+    m_impl->session         = device();
+    m_impl->lastReceived    = now;
+    m_impl->lastConnectSent = now;
+    m_impl->lastRefill      = now;
+    m_impl->sendControl(UdpConnectionImpl::Type::Connect, now);
+}
+
+
+////////////////////////////////////////////////////////////
+void UdpConnection::disconnect()
+{
+    if ((m_impl->state == State::Connecting) || (m_impl->state == State::Connected))
+    {
+        // Bypass the simulator, so that the notice is not delayed past the reset below
+        m_impl->datagram.clear();
+        m_impl->datagram << static_cast<std::uint8_t>(UdpConnectionImpl::Type::Disconnect) << m_impl->session;
+        for (int i = 0; i < UdpConnectionImpl::disconnectRepeats; ++i)
+            [[maybe_unused]] const Socket::Status status = m_impl->socket.send(m_impl->datagram.getData(),
+                                                                               m_impl->datagram.getDataSize(),
+                                                                               *m_impl->remoteAddress,
+                                                                               m_impl->remotePort);
+    }
+
+    m_impl->reset();
+}
+
+
+////////////////////////////////////////////////////////////
+UdpConnection::State UdpConnection::getState() const
+{
+    return m_impl->state;
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<IpAddress> UdpConnection::getRemoteAddress() const
+{
+    return m_impl->remoteAddress;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned short UdpConnection::getRemotePort() const
+{
+    return m_impl->remotePort;
+}
+
+
+////////////////////////////////////////////////////////////
+void UdpConnection::setDelivery(std::uint8_t channel, Delivery delivery)
+{
+    if (channel >= ChannelCount)
+    {
+        err() << "Invalid UDP connection channel " << int{channel} << std::endl;
+        return;
+    }
+
+    m_impl->deliveries[channel] = delivery;
+}
+
+
+////////////////////////////////////////////////////////////
+UdpConnection::Delivery UdpConnection::getDelivery(std::uint8_t channel) const
+{
+    return m_impl->deliveries[std::min<std::size_t>(channel, ChannelCount - 1)];
+}
+
+
+////////////////////////////////////////////////////////////
+void UdpConnection::setTimeout(Time timeout)
+{
+    m_impl->timeout = timeout.toDuration();
+}
+
+
+////////////////////////////////////////////////////////////
+void UdpConnection::setSimulator(const Simulator& simulator)
+{
+    m_impl->simulator = simulator;
+    m_impl->random.seed(simulator.seed);
+}
+
+
+////////////////////////////////////////////////////////////
+bool UdpConnection::send(std::uint8_t channel, const void* data, std::size_t size)
+{
+    if (channel >= ChannelCount)
+    {
+        err() << "Invalid UDP connection channel " << int{channel} << std::endl;
+        return false;
+    }
+
+    if (size > MaxMessageSize)
+    {
+        err() << "Cannot send message over a UDP connection "
+              << "(the number of bytes to send is greater than sf::UdpConnection::MaxMessageSize)" << std::endl;
+        return false;
+    }
+
+    if (m_impl->state != State::Connected)
+        return false;
+
+    const bool  reliable = m_impl->deliveries[channel] == Delivery::ReliableOrdered;
+    auto&       state    = m_impl->channels[channel];
+    const auto  count    = static_cast<std::uint16_t>(
+        std::max<std::size_t>(1, (size + UdpConnectionImpl::fragmentSize - 1) / UdpConnectionImpl::fragmentSize));
+
+    // Too many reliable messages in flight: the peer is too slow or gone
+    if (reliable && (state.unackedFragments + count > UdpConnectionImpl::maxUnackedFragments))
+        return false;
+
+    const auto  now   = Impl::Clock::now();
+    const auto* bytes = static_cast<const std::uint8_t*>(data);
+    auto&       queue = reliable ? m_impl->reliableQueue : m_impl->unreliableQueue;
+
+    for (std::uint16_t index = 0; index < count; ++index)
+    {
+        const std::size_t offset = index * UdpConnectionImpl::fragmentSize;
+        const std::size_t length = std::min(UdpConnectionImpl::fragmentSize, size - offset);
+
+        Impl::Fragment& fragment = queue.emplace_back();
+        fragment.serial                       = m_impl->nextSerial++;
+        fragment.channel                      = channel;
+        fragment.id                           = state.nextSendId;
+        fragment.index                        = index;
+        fragment.count                        = count;
+        fragment.data.assign(bytes + offset, bytes + offset + length);
+        fragment.queued = now;
+    }
+
+    ++state.nextSendId;
+    if (reliable)
+        state.unackedFragments += count;
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool UdpConnection::send(std::uint8_t channel, Packet& packet)
+{
+    std::size_t size = 0;
+    const void* data = packet.onSend(size);
+
+    return send(channel, data, size);
+}
+
+
+////////////////////////////////////////////////////////////
+bool UdpConnection::receive(Packet& packet, std::uint8_t& channel)
+{
+    if (m_impl->inbox.empty())
+        return false;
+
+    Impl::Message& message = m_impl->inbox.front();
+
+    packet.clear();
+    packet.onReceive(message.data.data(), message.data.size());
+    channel = message.channel;
+
+    m_impl->inbox.pop_front();
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void UdpConnection::update()
+{
+    const auto now = Impl::Clock::now();
+
+    if (m_impl->state != State::Disconnected)
+        m_impl->flushDelayed(now);
+
+    // Handle all the datagrams that arrived since the last update, a batch at a time
+    for (;;)
+    {
+        std::size_t received = 0;
+        if (m_impl->socket.receiveBatch(m_impl->buffers.data(), m_impl->buffers.size(), received) !=
+            Socket::Status::Done)
+            break;
+
+        for (std::size_t i = 0; i < received; ++i)
+        {
+            // A datagram that fills its buffer may have been truncated, and the peer never sends such big ones
+            const UdpSocket::DatagramBuffer& buffer = m_impl->buffers[i];
+            if (buffer.received > UdpConnectionImpl::datagramBudget)
+                continue;
+
+            PacketView view(buffer.data, buffer.received);
+            m_impl->handleDatagram(view, *buffer.remoteAddress, buffer.remotePort, now);
+        }
+
+        // A batch that isn't full means that the queue is empty
+        if (received < m_impl->buffers.size())
+            break;
+    }
+
+    if ((m_impl->state != State::Connecting) && (m_impl->state != State::Connected))
+        return;
+
+    // Give up on a silent peer
+    if (now - m_impl->lastReceived > m_impl->timeout)
+    {
+        m_impl->reset();
+        return;
+    }
+
+    if (m_impl->state == State::Connecting)
+    {
+        if (now - m_impl->lastConnectSent >= UdpConnectionImpl::connectInterval)
+        {
+            m_impl->lastConnectSent = now;
+            m_impl->sendControl(UdpConnectionImpl::Type::Connect, now);
+        }
+        return;
+    }
+
+    m_impl->detectLosses(now);
+    m_impl->sendData(now);
+}
+
+
+////////////////////////////////////////////////////////////
+UdpConnection::Statistics UdpConnection::getStatistics() const
+{
+    Statistics statistics            = m_impl->statistics;
+    statistics.roundTripTime         = UdpConnectionImpl::toTime(m_impl->smoothedRtt.value_or(Impl::Duration::zero()));
+    statistics.roundTripTimeVariance = UdpConnectionImpl::toTime(m_impl->rttVariance);
+    statistics.congestionWindow      = m_impl->congestionWindow;
+    statistics.bytesInFlight         = m_impl->bytesInFlight;
+    return statistics;
+}
+
+} // namespace sf
@@ -32,9 +32,70 @@
 
 #include <SFML/System/Err.hpp>
 
+#include <algorithm>
+#include <array>
 #include <ostream>
 
+#include <cerrno>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#ifdef SFML_SYSTEM_LINUX
+#include <netinet/udp.h>
+
+#ifndef UDP_SEGMENT
+#define UDP_SEGMENT 103 // Not defined by older C libraries, supported since Linux 4.18
+#endif
+#endif
+
+
+namespace
+{
+namespace UdpSocketImpl
+{
+// Maximum number of datagrams handed to the system in a single call
+constexpr std::size_t batchSize = 64;
+
+// Maximum number of segments the system accepts in a single segmentation offload send
+constexpr std::size_t maxSegments = 64;
+
+#ifndef SFML_SYSTEM_LINUX
+// Flag making a receive return immediately when no datagram is queued
+#ifdef SFML_SYSTEM_WINDOWS
+constexpr int dontWait = 0; // Not available: only the first datagram of a batch can be received
+#else
+constexpr int dontWait = MSG_DONTWAIT;
+#endif
+
+// Receive a single datagram into a batch buffer
+sf::Socket::Status receive(sf::SocketHandle handle, sf::UdpSocket::DatagramBuffer& buffer, int flags)
+{
+    sockaddr_in                      address     = sf::priv::SocketImpl::createAddress(INADDR_ANY, 0);
+    sf::priv::SocketImpl::AddrLength addressSize = sizeof(address);
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuseless-cast"
+    const int sizeReceived = static_cast<int>(recvfrom(handle,
+                                                       static_cast<char*>(buffer.data),
+                                                       static_cast<sf::priv::SocketImpl::Size>(buffer.size),
+                                                       flags,
+                                                       reinterpret_cast<sockaddr*>(&address),
+                                                       &addressSize));
+#pragma GCC diagnostic pop
+
+    if (sizeReceived < 0)
+        return sf::priv::SocketImpl::getErrorStatus();
+
+    buffer.received      = static_cast<std::size_t>(sizeReceived);
+    buffer.remoteAddress = sf::IpAddress(ntohl(address.sin_addr.s_addr));
+    buffer.remotePort    = ntohs(address.sin_port);
+
+    return sf::Socket::Status::Done;
+}
+#endif
+} // namespace UdpSocketImpl
+} // namespace
 
 
 namespace sf
@@ -220,4 +281,249 @@ Socket::Status UdpSocket::receive(Packet& packet, std::optional<IpAddress>& remo
 }
 
 
+////////////////////////////////////////////////////////////
+Socket::Status UdpSocket::sendBatch(const Datagram* datagrams, std::size_t count, std::size_t& sent)
+{
+    sent = 0;
+
+    // Create the internal socket if it doesn't exist
+    create();
+
+    // Make sure that all the datagrams are valid before sending any of them
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        if (datagrams[i].size > MaxDatagramSize)
+        {
+            err() << "Cannot send data over the network "
+                  << "(the number of bytes to send is greater than sf::UdpSocket::MaxDatagramSize)" << std::endl;
+            return Status::Error;
+        }
+    }
+
+    while (sent < count)
+    {
+#ifdef SFML_SYSTEM_LINUX
+        // Describe as many datagrams as fit in a batch, and send them with a single system call
+        const std::size_t batch = std::min(count - sent, UdpSocketImpl::batchSize);
+
+        std::array<mmsghdr, UdpSocketImpl::batchSize>                  messages{};
+        std::array<priv::SocketImpl::Buffer, UdpSocketImpl::batchSize> buffers{};
+        std::array<sockaddr_in, UdpSocketImpl::batchSize>              addresses{};
+
+        for (std::size_t i = 0; i < batch; ++i)
+        {
+            const Datagram& datagram = datagrams[sent + i];
+
+            buffers[i]   = priv::SocketImpl::createBuffer(datagram.data, datagram.size);
+            addresses[i] = priv::SocketImpl::createAddress(datagram.remoteAddress.toInteger(), datagram.remotePort);
+
+            messages[i].msg_hdr.msg_name    = &addresses[i];
+            messages[i].msg_hdr.msg_namelen = sizeof(addresses[i]);
+            messages[i].msg_hdr.msg_iov     = &buffers[i];
+            messages[i].msg_hdr.msg_iovlen  = 1;
+        }
+
+        const int result = sendmmsg(getNativeHandle(), messages.data(), static_cast<unsigned int>(batch), 0);
+        if (result < 0)
+            return (sent > 0) ? Status::Partial : priv::SocketImpl::getErrorStatus();
+
+        sent += static_cast<std::size_t>(result);
+#else
+        const Datagram& datagram = datagrams[sent];
+        const Status    status   = send(datagram.data, datagram.size, datagram.remoteAddress, datagram.remotePort);
+        if (status != Status::Done)
+            return (sent > 0) ? Status::Partial : status;
+
+        ++sent;
+#endif
+    }
+
+    return Status::Done;
+}
+
+
+////////////////////////////////////////////////////////////
+Socket::Status UdpSocket::receiveBatch(DatagramBuffer* buffers, std::size_t count, std::size_t& received)
+{
+    // First clear the variables to fill
+    received = 0;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        buffers[i].received      = 0;
+        buffers[i].remoteAddress = std::nullopt;
+        buffers[i].remotePort    = 0;
+
+        // Check the destination buffer
+        if (!buffers[i].data)
+        {
+            err() << "Cannot receive data from the network (the destination buffer is invalid)" << std::endl;
+            return Status::Error;
+        }
+    }
+
+    if (count == 0)
+        return Status::Done;
+
+#ifdef SFML_SYSTEM_LINUX
+    while (received < count)
+    {
+        // Wait for the first datagram only, then take the ones already queued
+        const std::size_t batch = std::min(count - received, UdpSocketImpl::batchSize);
+
+        std::array<mmsghdr, UdpSocketImpl::batchSize>                  messages{};
+        std::array<priv::SocketImpl::Buffer, UdpSocketImpl::batchSize> descriptors{};
+        std::array<sockaddr_in, UdpSocketImpl::batchSize>              addresses{};
+
+        for (std::size_t i = 0; i < batch; ++i)
+        {
+            const DatagramBuffer& buffer = buffers[received + i];
+
+            descriptors[i] = priv::SocketImpl::createBuffer(buffer.data, buffer.size);
+
+            messages[i].msg_hdr.msg_name    = &addresses[i];
+            messages[i].msg_hdr.msg_namelen = sizeof(addresses[i]);
+            messages[i].msg_hdr.msg_iov     = &descriptors[i];
+            messages[i].msg_hdr.msg_iovlen  = 1;
+        }
+
+        const int flags  = (received == 0) ? MSG_WAITFORONE : MSG_DONTWAIT;
+        const int result = recvmmsg(getNativeHandle(),
+                                    messages.data(),
+                                    static_cast<unsigned int>(batch),
+                                    flags,
+                                    nullptr);
+        if (result < 0)
+        {
+            if (received > 0)
+                break;
+
+            return priv::SocketImpl::getErrorStatus();
+        }
+
+        // Fill the sender information
+        for (std::size_t i = 0; i < static_cast<std::size_t>(result); ++i)
+        {
+            DatagramBuffer& buffer = buffers[received + i];
+            buffer.received        = messages[i].msg_len;
+            buffer.remoteAddress   = IpAddress(ntohl(addresses[i].sin_addr.s_addr));
+            buffer.remotePort      = ntohs(addresses[i].sin_port);
+        }
+
+        received += static_cast<std::size_t>(result);
+
+        // Stop as soon as the queue is empty
+        if (static_cast<std::size_t>(result) < batch)
+            break;
+    }
+#else
+#ifdef SFML_SYSTEM_WINDOWS
+    // There's no way to receive without blocking on a blocking socket, so take a single datagram
+    count = 1;
+#endif
+
+    // Wait for the first datagram only, then take the ones already queued
+    for (; received < count; ++received)
+    {
+        const int    flags  = (received == 0) ? 0 : UdpSocketImpl::dontWait;
+        const Status status = UdpSocketImpl::receive(getNativeHandle(), buffers[received], flags);
+        if (status != Status::Done)
+        {
+            if (received > 0)
+                break;
+
+            return status;
+        }
+    }
+#endif
+
+    return Status::Done;
+}
+
+
+////////////////////////////////////////////////////////////
+Socket::Status UdpSocket::sendSegmented(const void*    data,
+                                        std::size_t    size,
+                                        std::size_t    segmentSize,
+                                        IpAddress      remoteAddress,
+                                        unsigned short remotePort)
+{
+    // Create the internal socket if it doesn't exist
+    create();
+
+    // Make sure that each segment will fit in one datagram
+    if ((segmentSize == 0) || (segmentSize > MaxDatagramSize))
+    {
+        err() << "Cannot send data over the network "
+              << "(the segment size is zero or greater than sf::UdpSocket::MaxDatagramSize)" << std::endl;
+        return Status::Error;
+    }
+
+    const auto* bytes = static_cast<const std::byte*>(data);
+
+#ifdef SFML_SYSTEM_LINUX
+    // Let the system split the data if it supports it; the whole data must fit in a single IP packet
+    if (m_segmentationOffload && (size > segmentSize) && (size <= MaxDatagramSize) &&
+        ((size + segmentSize - 1) / segmentSize <= UdpSocketImpl::maxSegments))
+    {
+        sockaddr_in              address = priv::SocketImpl::createAddress(remoteAddress.toInteger(), remotePort);
+        priv::SocketImpl::Buffer buffer  = priv::SocketImpl::createBuffer(data, size);
+
+        alignas(cmsghdr) std::array<char, CMSG_SPACE(sizeof(std::uint16_t))> control{};
+
+        msghdr message{};
+        message.msg_name       = &address;
+        message.msg_namelen    = sizeof(address);
+        message.msg_iov        = &buffer;
+        message.msg_iovlen     = 1;
+        message.msg_control    = control.data();
+        message.msg_controllen = control.size();
+
+        cmsghdr* header    = CMSG_FIRSTHDR(&message);
+        header->cmsg_level = IPPROTO_UDP;
+        header->cmsg_type  = UDP_SEGMENT;
+        header->cmsg_len   = CMSG_LEN(sizeof(std::uint16_t));
+
+        const auto segment = static_cast<std::uint16_t>(segmentSize);
+        std::memcpy(CMSG_DATA(header), &segment, sizeof(segment));
+
+        if (sendmsg(getNativeHandle(), &message, 0) >= 0)
+            return Status::Done;
+
+        // Unsupported by the kernel or the network device: don't try again on this socket
+        if ((errno != EINVAL) && (errno != EIO) && (errno != ENOPROTOOPT) && (errno != EOPNOTSUPP))
+            return priv::SocketImpl::getErrorStatus();
+
+        m_segmentationOffload = false;
+    }
+#endif
+
+    // Send the segments as individual datagrams, one batch at a time
+    std::size_t offset = 0;
+    do
+    {
+        const std::size_t start = offset;
+
+        std::array<Datagram, UdpSocketImpl::batchSize> datagrams;
+        std::size_t                                    count = 0;
+        for (; (count < datagrams.size()) && (offset < size); ++count)
+        {
+            const std::size_t length = std::min(segmentSize, size - offset);
+            datagrams[count]         = {bytes + offset, length, remoteAddress, remotePort};
+            offset += length;
+        }
+
+        // An empty buffer is still sent as one empty datagram
+        if (count == 0)
+            datagrams[count++] = {bytes, 0, remoteAddress, remotePort};
+
+        std::size_t  sent   = 0;
+        const Status status = sendBatch(datagrams.data(), count, sent);
+        if (status != Status::Done)
+            return ((sent > 0) || (start > 0)) ? Status::Partial : status;
+    } while (offset < size);
+
+    return Status::Done;
+}
+
+
 } // namespace sf
@@ -108,4 +108,32 @@ Socket::Status SocketImpl::getErrorStatus()
     // clang-format on
 }
 
+
+////////////////////////////////////////////////////////////
+SocketImpl::Buffer SocketImpl::createBuffer(const void* data, std::size_t size)
+{
+    Buffer buffer{};
+    buffer.iov_base = const_cast<void*>(data);
+    buffer.iov_len  = size;
+    return buffer;
+}
+
+
+////////////////////////////////////////////////////////////
+long SocketImpl::sendBuffers(SocketHandle sock, Buffer* buffers, std::size_t count)
+{
+    msghdr message{};
+    message.msg_iov    = buffers;
+    message.msg_iovlen = static_cast<decltype(message.msg_iovlen)>(count);
+
+    // sendmsg, unlike writev, accepts flags; on Linux, this is how SIGPIPE is disabled on disconnection
+#ifdef SFML_SYSTEM_LINUX
+    constexpr int flags = MSG_NOSIGNAL;
+#else
+    constexpr int flags = 0;
+#endif
+
+    return static_cast<long>(sendmsg(sock, &message, flags));
+}
+
 } // namespace sf::priv
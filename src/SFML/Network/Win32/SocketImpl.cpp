@@ -107,4 +107,26 @@ Socket::Status SocketImpl::getErrorStatus()
     }
     // clang-format on
 }
+
+
+////////////////////////////////////////////////////////////
+SocketImpl::Buffer SocketImpl::createBuffer(const void* data, std::size_t size)
+{
+    Buffer buffer{};
+    buffer.buf = static_cast<CHAR*>(const_cast<void*>(data));
+    buffer.len = static_cast<ULONG>(size);
+    return buffer;
+}
+
+
+////////////////////////////////////////////////////////////
+long SocketImpl::sendBuffers(SocketHandle sock, Buffer* buffers, std::size_t count)
+{
+    DWORD sent = 0;
+    if (WSASend(sock, buffers, static_cast<DWORD>(count), &sent, 0, nullptr, nullptr) != 0)
+        return -1;
+
+    return static_cast<long>(sent);
+}
+
 } // namespace sf::priv
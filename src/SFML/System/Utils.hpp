@@ -32,9 +32,12 @@
 #include <filesystem>
 #include <string>
 #include <string_view>
+#include <type_traits>
 
 #include <cstddef>
+#include <cstdint>
 #include <cstdio>
+#include <cstring>
 
 
 namespace sf
@@ -54,5 +57,41 @@ template <typename IntegerType, typename... Bytes>
     return ((integer |= static_cast<IntegerType>(static_cast<IntegerType>(byte) << 8 * index++)), ...);
 }
 
+// Reverse the order of the bytes of an unsigned integer
+// byteSwap(std::uint32_t{0x12345678}) == 0x78563412
+template <typename IntegerType>
+[[nodiscard]] constexpr IntegerType byteSwap(IntegerType integer)
+{
+    static_assert(std::is_unsigned_v<IntegerType>, "IntegerType must be an unsigned integer type");
+
+    static_assert(sizeof(IntegerType) <= 8, "IntegerType cannot be larger than 64 bits");
+
+    // Swap bytes, then pairs of bytes, then quadruplets; compilers recognize this pattern as a single instruction
+    auto result = static_cast<std::uint64_t>(integer);
+    if constexpr (sizeof(IntegerType) >= 2)
+        result = ((result & 0x00FF00FF00FF00FF) << 8) | ((result >> 8) & 0x00FF00FF00FF00FF);
+    if constexpr (sizeof(IntegerType) >= 4)
+        result = ((result & 0x0000FFFF0000FFFF) << 16) | ((result >> 16) & 0x0000FFFF0000FFFF);
+    if constexpr (sizeof(IntegerType) >= 8)
+        result = (result << 32) | (result >> 32);
+    return static_cast<IntegerType>(result);
+}
+
+// Copy an array of unsigned integers, reversing the order of the bytes of each one
+// The loop is kept simple so that compilers turn it into vectorized byte shuffles
+template <typename IntegerType>
+void copyByteSwapped(void* destination, const void* source, std::size_t count)
+{
+    auto*       output = static_cast<std::byte*>(destination);
+    const auto* input  = static_cast<const std::byte*>(source);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        IntegerType integer = 0;
+        std::memcpy(&integer, input + i * sizeof(IntegerType), sizeof(IntegerType));
+        integer = byteSwap(integer);
+        std::memcpy(output + i * sizeof(IntegerType), &integer, sizeof(IntegerType));
+    }
+}
+
 [[nodiscard]] SFML_SYSTEM_API std::FILE* openFile(const std::filesystem::path& filename, std::string_view mode);
 } // namespace sf
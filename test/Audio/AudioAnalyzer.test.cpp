@@ -0,0 +1,171 @@
+#include <SFML/Audio/AudioAnalyzer.hpp>
+
+// Other 1st party headers
+#include <SFML/Audio/SoundBuffer.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <AudioUtil.hpp>
+#include <SystemUtil.hpp>
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+
+#include <cmath>
+
+namespace
+{
+std::vector<float> makeSine(std::size_t frameCount, float frequency, float amplitude, unsigned int sampleRate)
+{
+    std::vector<float> samples(frameCount);
+    for (std::size_t i = 0; i < frameCount; ++i)
+        samples[i] = amplitude * std::sin(2.f * 3.14159265f * frequency * static_cast<float>(i) / static_cast<float>(sampleRate));
+    return samples;
+}
+} // namespace
+
+TEST_CASE("[Audio] sf::AudioAnalyzer", runAudioDeviceTests())
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::AudioAnalyzer>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::AudioAnalyzer>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::AudioAnalyzer>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::AudioAnalyzer>);
+    }
+
+    SECTION("Construction")
+    {
+        SECTION("Default constructor")
+        {
+            const sf::AudioAnalyzer analyzer;
+            CHECK(analyzer.getFftSize() == 1024);
+            CHECK(analyzer.getWindow() == sf::AudioAnalyzer::Window::Hann);
+            CHECK(analyzer.getSampleRate() == 44100);
+            CHECK(analyzer.getDroppedFrameCount() == 0);
+        }
+
+        SECTION("Size and window constructor")
+        {
+            const sf::AudioAnalyzer analyzer(256, sf::AudioAnalyzer::Window::Blackman);
+            CHECK(analyzer.getFftSize() == 256);
+            CHECK(analyzer.getWindow() == sf::AudioAnalyzer::Window::Blackman);
+        }
+    }
+
+    SECTION("analyze()")
+    {
+        // A sine wave centered on bin 32 of a 1024 points FFT
+        constexpr unsigned int sampleRate = 44100;
+        constexpr float        frequency  = 32.f * sampleRate / 1024.f;
+        const auto             sine       = makeSine(1024, frequency, 0.5f, sampleRate);
+
+        SECTION("Silence")
+        {
+            sf::AudioAnalyzer analyzer;
+            const auto        frame = analyzer.analyze(static_cast<const float*>(nullptr), 0, 1, sampleRate);
+            CHECK(frame.rms == 0.f);
+            CHECK(frame.peak == 0.f);
+            CHECK(frame.magnitudes.size() == 513);
+            CHECK(std::all_of(frame.magnitudes.begin(), frame.magnitudes.end(), [](float value) { return value == 0.f; }));
+        }
+
+        SECTION("Sine wave")
+        {
+            sf::AudioAnalyzer analyzer;
+            const auto        frame = analyzer.analyze(sine.data(), sine.size(), 1, sampleRate);
+            CHECK(frame.sampleRate == sampleRate);
+            CHECK(frame.rms == Approx(0.3535534f));
+            CHECK(frame.peak == Approx(0.5f));
+            CHECK(frame.magnitudes.size() == 513);
+            CHECK(frame.magnitudes[32] == Approx(0.5f));
+            CHECK(std::max_element(frame.magnitudes.begin(), frame.magnitudes.end()) - frame.magnitudes.begin() == 32);
+            CHECK(frame.getBinFrequency(32) == Approx(frequency));
+            CHECK(frame.getBandEnergy(frequency - 100.f, frequency + 100.f) == Approx(0.375f));
+            CHECK(frame.getBandEnergy(5000.f, 20000.f) < 0.001f);
+        }
+
+        SECTION("Stereo 16-bit samples")
+        {
+            std::vector<std::int16_t> samples;
+            for (const float sample : sine)
+            {
+                samples.push_back(static_cast<std::int16_t>(sample * 32768.f));
+                samples.push_back(0);
+            }
+
+            sf::AudioAnalyzer analyzer(1024, sf::AudioAnalyzer::Window::Rectangular);
+            const auto        frame = analyzer.analyze(samples.data(), sine.size(), 2, sampleRate);
+            CHECK(frame.peak == Approx(0.25f));
+            CHECK(frame.magnitudes[32] == Approx(0.25f));
+        }
+
+        SECTION("Sound buffer")
+        {
+            const sf::SoundBuffer soundBuffer("Audio/ding.flac");
+            sf::AudioAnalyzer     analyzer;
+            const auto            frame = analyzer.analyze(soundBuffer, sf::milliseconds(100));
+            CHECK(frame.sampleRate == 44100);
+            CHECK(frame.rms > 0.f);
+            CHECK(frame.peak >= frame.rms);
+            CHECK(frame.peak <= 1.f);
+
+            const auto end = analyzer.analyze(soundBuffer, sf::seconds(10));
+            CHECK(end.rms == 0.f);
+        }
+    }
+
+    SECTION("push()/process()")
+    {
+        sf::AudioAnalyzer        analyzer(64);
+        sf::AudioAnalyzer::Frame frame;
+        const auto               sine = makeSine(1024, 4.f * 44100 / 64.f, 1.f, 44100);
+
+        CHECK(!analyzer.process(frame));
+
+        analyzer.push(sine.data(), 32, 1);
+        CHECK(!analyzer.process(frame));
+
+        analyzer.push(sine.data() + 32, 32, 1);
+        CHECK(analyzer.process(frame));
+        CHECK(frame.magnitudes.size() == 33);
+        CHECK(frame.peak == Approx(1.f));
+        CHECK(frame.magnitudes[4] == Approx(1.f));
+        CHECK(!analyzer.process(frame));
+
+        // The queue holds 8 blocks, the excess is dropped
+        analyzer.push(sine.data(), 1024, 1);
+        CHECK(analyzer.getDroppedFrameCount() == 1024 - 8 * 64);
+
+        int count = 0;
+        while (analyzer.process(frame))
+            ++count;
+        CHECK(count == 8);
+    }
+
+    SECTION("createTap()")
+    {
+        sf::AudioAnalyzer analyzer(64);
+        auto              tap = analyzer.createTap();
+
+        const auto         sine = makeSine(64, 1000.f, 0.5f, 44100);
+        std::vector<float> input;
+        for (const float sample : sine)
+        {
+            input.push_back(sample);
+            input.push_back(sample);
+        }
+
+        std::vector<float> output(input.size());
+        unsigned int       inputFrameCount  = 64;
+        unsigned int       outputFrameCount = 64;
+        tap(input.data(), inputFrameCount, output.data(), outputFrameCount, 2);
+        CHECK(inputFrameCount == 64);
+        CHECK(outputFrameCount == 64);
+        CHECK(output == input);
+
+        sf::AudioAnalyzer::Frame frame;
+        CHECK(analyzer.process(frame));
+        CHECK(frame.peak == Approx(*std::max_element(sine.begin(), sine.end())));
+    }
+}
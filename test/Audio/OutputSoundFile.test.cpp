@@ -1,9 +1,13 @@
 #include <SFML/Audio/OutputSoundFile.hpp>
 
+// Other 1st party headers
+#include <SFML/Audio/InputSoundFile.hpp>
+
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/generators/catch_generators.hpp>
 
 #include <type_traits>
+#include <vector>
 
 TEST_CASE("[Audio] sf::OutputSoundFile")
 {
@@ -40,4 +44,51 @@ TEST_CASE("[Audio] sf::OutputSoundFile")
         outputSoundFile.close();
         CHECK(std::filesystem::remove(filename));
     }
+
+    SECTION("openFromFileAsync()")
+    {
+        const std::vector<std::int16_t> samples(44'100 * 2, 1000);
+
+        SECTION("Block")
+        {
+            sf::OutputSoundFile outputSoundFile;
+            REQUIRE(outputSoundFile.openFromFileAsync(filename,
+                                                      44'100,
+                                                      static_cast<unsigned int>(channelMap.size()),
+                                                      channelMap,
+                                                      4096,
+                                                      sf::OutputSoundFile::OverflowPolicy::Block));
+            CHECK(outputSoundFile.isAsync());
+
+            for (int i = 0; i < 4; ++i)
+                outputSoundFile.write(samples.data(), samples.size());
+
+            CHECK(outputSoundFile.getQueuedSampleCount() <= 4096);
+            CHECK(outputSoundFile.getDroppedSampleCount() == 0);
+            outputSoundFile.close();
+            CHECK(!outputSoundFile.isAsync());
+
+            const sf::InputSoundFile inputSoundFile(filename);
+            CHECK(inputSoundFile.getSampleRate() == 44'100);
+            CHECK(inputSoundFile.getChannelCount() == 2);
+            CHECK(inputSoundFile.getSampleCount() > 0);
+        }
+
+        SECTION("Drop")
+        {
+            sf::OutputSoundFile outputSoundFile;
+            REQUIRE(outputSoundFile.openFromFileAsync(filename,
+                                                      44'100,
+                                                      static_cast<unsigned int>(channelMap.size()),
+                                                      channelMap,
+                                                      64,
+                                                      sf::OutputSoundFile::OverflowPolicy::Drop));
+            outputSoundFile.write(samples.data(), samples.size());
+            CHECK(outputSoundFile.getDroppedSampleCount() > 0);
+            CHECK(outputSoundFile.getDroppedSampleCount() % 2 == 0);
+            CHECK(outputSoundFile.getDroppedSampleCount() < samples.size());
+        }
+
+        CHECK(std::filesystem::remove(filename));
+    }
 }
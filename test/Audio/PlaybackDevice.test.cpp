@@ -0,0 +1,74 @@
+#include <SFML/Audio/PlaybackDevice.hpp>
+
+// Other 1st party headers
+#include <SFML/Audio/SoundRecorder.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <optional>
+#include <string>
+#include <vector>
+
+// None of these checks needs an actual device to be connected
+TEST_CASE("[Audio] sf::PlaybackDevice")
+{
+    SECTION("getAvailableDevices()")
+    {
+        const std::vector<std::string> devices = sf::PlaybackDevice::getAvailableDevices();
+
+        // Consecutive calls return the same list
+        CHECK(sf::PlaybackDevice::getAvailableDevices() == devices);
+
+        std::vector<std::string> sorted = devices;
+        std::sort(sorted.begin(), sorted.end());
+        CHECK(std::adjacent_find(sorted.begin(), sorted.end()) == sorted.end());
+    }
+
+    SECTION("getDefaultDevice()")
+    {
+        const std::vector<std::string>   devices       = sf::PlaybackDevice::getAvailableDevices();
+        const std::optional<std::string> defaultDevice = sf::PlaybackDevice::getDefaultDevice();
+
+        // The default device is at the beginning of the list
+        if (defaultDevice)
+        {
+            REQUIRE(!devices.empty());
+            CHECK(devices.front() == *defaultDevice);
+        }
+
+        CHECK(sf::PlaybackDevice::getDefaultDevice() == defaultDevice);
+    }
+
+    SECTION("refreshAvailableDevices()")
+    {
+        const std::vector<std::string>   devices       = sf::PlaybackDevice::getAvailableDevices();
+        const std::optional<std::string> defaultDevice = sf::PlaybackDevice::getDefaultDevice();
+
+        // Refreshing doesn't change the list, as long as no device is connected or disconnected meanwhile
+        sf::PlaybackDevice::refreshAvailableDevices();
+        CHECK(sf::PlaybackDevice::getAvailableDevices() == devices);
+        CHECK(sf::PlaybackDevice::getDefaultDevice() == defaultDevice);
+    }
+
+    SECTION("setDevice()")
+    {
+        const std::vector<std::string> devices = sf::PlaybackDevice::getAvailableDevices();
+
+        // An unknown device is rejected and the list is left as is
+        CHECK(!sf::PlaybackDevice::setDevice("does not exist"));
+        CHECK(sf::PlaybackDevice::getAvailableDevices() == devices);
+    }
+
+    SECTION("Capture devices")
+    {
+        const std::vector<std::string> playbackDevices = sf::PlaybackDevice::getAvailableDevices();
+        const std::vector<std::string> captureDevices  = sf::SoundRecorder::getAvailableDevices();
+        CHECK(sf::SoundRecorder::getAvailableDevices() == captureDevices);
+
+        // Refreshing the capture devices leaves the playback devices as they are
+        sf::SoundRecorder::refreshAvailableDevices();
+        CHECK(sf::SoundRecorder::getAvailableDevices() == captureDevices);
+        CHECK(sf::PlaybackDevice::getAvailableDevices() == playbackDevices);
+    }
+}
@@ -0,0 +1,132 @@
+#include <SFML/Audio/Resampler.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+
+#include <cmath>
+#include <cstdlib>
+
+namespace
+{
+std::vector<std::int16_t> makeSine(std::size_t frameCount, float frequency, float amplitude, unsigned int sampleRate)
+{
+    std::vector<std::int16_t> samples(frameCount);
+    for (std::size_t i = 0; i < frameCount; ++i)
+        samples[i] = static_cast<std::int16_t>(
+            amplitude * std::sin(2.f * 3.14159265f * frequency * static_cast<float>(i) / static_cast<float>(sampleRate)));
+    return samples;
+}
+
+std::int16_t getPeak(const std::vector<std::int16_t>& samples, std::size_t begin, std::size_t end)
+{
+    std::int16_t peak = 0;
+    for (std::size_t i = begin; i < end; ++i)
+        peak = std::max(peak, static_cast<std::int16_t>(std::abs(samples[i])));
+    return peak;
+}
+} // namespace
+
+TEST_CASE("[Audio] sf::Resampler")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(std::is_copy_constructible_v<sf::Resampler>);
+        STATIC_CHECK(std::is_copy_assignable_v<sf::Resampler>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::Resampler>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::Resampler>);
+    }
+
+    SECTION("Construction")
+    {
+        const sf::Resampler resampler(22'050, 44'100, 2, sf::Resampler::Quality::Fast);
+        CHECK(resampler.getInputSampleRate() == 22'050);
+        CHECK(resampler.getOutputSampleRate() == 44'100);
+        CHECK(resampler.getChannelCount() == 2);
+        CHECK(resampler.getQuality() == sf::Resampler::Quality::Fast);
+    }
+
+    const auto quality = GENERATE(sf::Resampler::Quality::Fast, sf::Resampler::Quality::Medium, sf::Resampler::Quality::Best);
+
+    SECTION("Output length")
+    {
+        const std::vector<std::int16_t> samples(44'100 * 2);
+        std::vector<std::int16_t>       output;
+
+        sf::Resampler resampler(44'100, 48'000, 2, quality);
+        resampler.process(samples.data(), 44'100, output);
+        CHECK(output.size() < 48'000 * 2);
+        resampler.flush(output);
+        CHECK(output.size() == 48'000 * 2);
+
+        // The resampler is reset by flush
+        output.clear();
+        resampler.process(samples.data(), 1'000, output);
+        resampler.flush(output);
+        CHECK(output.size() == 1'089 * 2);
+    }
+
+    SECTION("Block by block")
+    {
+        const auto                samples = makeSine(10'000, 440.f, 10'000.f, 22'050);
+        std::vector<std::int16_t> whole;
+        std::vector<std::int16_t> blocks;
+
+        sf::Resampler resampler(22'050, 44'100, 1, quality);
+        resampler.process(samples.data(), samples.size(), whole);
+        resampler.flush(whole);
+
+        for (std::size_t i = 0; i < samples.size(); i += 333)
+            resampler.process(samples.data() + i, std::min<std::size_t>(333, samples.size() - i), blocks);
+        resampler.flush(blocks);
+
+        CHECK(whole.size() == 20'000);
+        CHECK(blocks == whole);
+    }
+
+    SECTION("Constant signal")
+    {
+        const std::vector<std::int16_t> samples(4'000, 1'000);
+        std::vector<std::int16_t>       output;
+
+        sf::Resampler resampler(48'000, 44'100, 1, quality);
+        resampler.process(samples.data(), samples.size(), output);
+        resampler.flush(output);
+
+        // Away from the edges, where the filter overlaps the implicit silence
+        CHECK(std::all_of(output.begin() + 100,
+                          output.end() - 100,
+                          [](std::int16_t sample) { return std::abs(sample - 1'000) <= 1; }));
+    }
+
+    SECTION("Sine wave")
+    {
+        const auto                samples = makeSine(44'100, 1'000.f, 16'000.f, 44'100);
+        std::vector<std::int16_t> output;
+
+        sf::Resampler resampler(44'100, 48'000, 1, quality);
+        resampler.process(samples.data(), samples.size(), output);
+        resampler.flush(output);
+
+        const auto peak = getPeak(output, 1'000, 47'000);
+        CHECK(peak > 15'800);
+        CHECK(peak < 16'200);
+    }
+
+    SECTION("Aliasing")
+    {
+        // 15 kHz is above the Nyquist frequency of the output and must be filtered out
+        const auto                samples = makeSine(44'100, 15'000.f, 16'000.f, 44'100);
+        std::vector<std::int16_t> output;
+
+        sf::Resampler resampler(44'100, 22'050, 1, quality);
+        resampler.process(samples.data(), samples.size(), output);
+        resampler.flush(output);
+
+        CHECK(output.size() == 22'050);
+        CHECK(getPeak(output, 1'000, 21'000) < 160);
+    }
+}
@@ -1,6 +1,8 @@
 #include <SFML/Audio/Sound.hpp>
 
 // Other 1st party headers
+#include <SFML/Audio/Listener.hpp>
+#include <SFML/Audio/PlaybackDevice.hpp>
 #include <SFML/Audio/SoundBuffer.hpp>
 
 #include <SFML/System/Time.hpp>
@@ -9,6 +11,8 @@
 
 #include <AudioUtil.hpp>
 #include <SystemUtil.hpp>
+#include <chrono>
+#include <thread>
 #include <type_traits>
 
 TEST_CASE("[Audio] sf::Sound", runAudioDeviceTests())
@@ -83,4 +87,55 @@ TEST_CASE("[Audio] sf::Sound", runAudioDeviceTests())
         sound.setPlayingOffset(sf::seconds(10));
         CHECK(sound.getPlayingOffset() == sf::seconds(10));
     }
+
+    SECTION("Scheduled playback")
+    {
+        sf::Sound sound(soundBuffer);
+
+        SECTION("playAt()")
+        {
+            sound.playAt(sf::PlaybackDevice::getEngineTime() + sf::seconds(10));
+            CHECK(sound.getStatus() == sf::Sound::Status::Playing);
+            CHECK(sound.getPlayingOffset() == sf::Time::Zero);
+        }
+
+        SECTION("stopAt()")
+        {
+            sound.play();
+            sound.stopAt(sf::PlaybackDevice::getEngineTime() + sf::seconds(10));
+            CHECK(sound.getStatus() == sf::Sound::Status::Playing);
+            sound.stop();
+            CHECK(sound.getStatus() == sf::Sound::Status::Stopped);
+            sound.play();
+            CHECK(sound.getStatus() == sf::Sound::Status::Playing);
+        }
+    }
+
+    SECTION("updateSpatial()")
+    {
+        sf::Sound sound1(soundBuffer);
+        sf::Sound sound2(soundBuffer);
+
+        const sf::SoundSource::SpatialUpdate updates[] = {
+            {&sound1, sf::Vector3f(1, 2, 3), std::nullopt, sf::Vector3f(4, 5, 6)},
+            {&sound2, std::nullopt, sf::Vector3f(0, 0, 1), std::nullopt},
+            {nullptr, sf::Vector3f(7, 8, 9), std::nullopt, std::nullopt},
+        };
+        const auto listenerPosition = sf::Listener::getPosition();
+
+        sf::SoundSource::updateSpatial(updates, 3, {sf::Vector3f(10, 11, 12), std::nullopt, std::nullopt, std::nullopt});
+        CHECK(sf::Listener::getPosition() == sf::Vector3f(10, 11, 12));
+
+        // The changes are applied by the audio thread before it mixes the next period
+        for (int i = 0; i < 100 && sound2.getDirection() != sf::Vector3f(0, 0, 1); ++i)
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+        CHECK(sound1.getPosition() == sf::Vector3f(1, 2, 3));
+        CHECK(sound1.getVelocity() == sf::Vector3f(4, 5, 6));
+        CHECK(sound1.getDirection() == sf::Vector3f(0, 0, -1));
+        CHECK(sound2.getPosition() == sf::Vector3f(0, 0, 0));
+        CHECK(sound2.getDirection() == sf::Vector3f(0, 0, 1));
+
+        sf::Listener::setPosition(listenerPosition);
+    }
 }
@@ -9,7 +9,9 @@
 
 #include <AudioUtil.hpp>
 #include <SystemUtil.hpp>
+#include <algorithm>
 #include <array>
+#include <filesystem>
 #include <type_traits>
 
 TEST_CASE("[Audio] sf::SoundBuffer", runAudioDeviceTests())
@@ -181,6 +183,108 @@ TEST_CASE("[Audio] sf::SoundBuffer", runAudioDeviceTests())
         }
     }
 
+    SECTION("loadFromFileProgressive()")
+    {
+        sf::SoundBuffer soundBuffer;
+
+        SECTION("Invalid filename")
+        {
+            CHECK(!soundBuffer.loadFromFileProgressive("does/not/exist.wav"));
+            CHECK(!soundBuffer.isLoading());
+        }
+
+        SECTION("Valid file")
+        {
+            REQUIRE(soundBuffer.loadFromFileProgressive("Audio/ding.flac"));
+            CHECK(soundBuffer.getSamples() != nullptr);
+            CHECK(soundBuffer.getSampleCount() == 87798);
+            CHECK(soundBuffer.getSampleRate() == 44100);
+            CHECK(soundBuffer.getChannelCount() == 1);
+            CHECK(soundBuffer.getDuration() == sf::microseconds(1990884));
+            CHECK(soundBuffer.getDecodedSampleCount() <= 87798);
+
+            // Copying waits for the decoder to finish
+            const sf::SoundBuffer soundBufferCopy(soundBuffer);
+            CHECK(!soundBuffer.isLoading());
+            CHECK(soundBuffer.getDecodedSampleCount() == 87798);
+            CHECK(soundBuffer.getUnderrunCount() == 0);
+            CHECK(soundBufferCopy.getDecodedSampleCount() == 87798);
+            CHECK(std::equal(soundBufferCopy.getSamples(),
+                             soundBufferCopy.getSamples() + soundBufferCopy.getSampleCount(),
+                             sf::SoundBuffer("Audio/ding.flac").getSamples()));
+        }
+
+        SECTION("Reload while decoding")
+        {
+            REQUIRE(soundBuffer.loadFromFileProgressive("Audio/ding.flac"));
+            REQUIRE(soundBuffer.loadFromFile("Audio/killdeer.wav"));
+            CHECK(!soundBuffer.isLoading());
+            CHECK(soundBuffer.getSampleCount() == 112941);
+            CHECK(soundBuffer.getDecodedSampleCount() == 112941);
+        }
+
+        SECTION("Truncated file")
+        {
+            const auto filename = std::filesystem::temp_directory_path() / "killdeer-truncated.wav";
+            std::filesystem::copy_file("Audio/killdeer.wav",
+                                       filename,
+                                       std::filesystem::copy_options::overwrite_existing);
+            std::filesystem::resize_file(filename, std::filesystem::file_size(filename) / 2);
+
+            REQUIRE(soundBuffer.loadFromFileProgressive(filename));
+            CHECK(soundBuffer.getSampleCount() == 112941);
+
+            // Copying waits for the decoder and only copies the samples that could be decoded
+            const sf::SoundBuffer soundBufferCopy(soundBuffer);
+            CHECK(!soundBuffer.isLoading());
+            CHECK(soundBuffer.getDecodedSampleCount() < 112941);
+            CHECK(soundBufferCopy.getSampleCount() == soundBuffer.getDecodedSampleCount());
+            CHECK(soundBufferCopy.getDuration() < sf::SoundBuffer("Audio/killdeer.wav").getDuration());
+            CHECK(std::equal(soundBufferCopy.getSamples(),
+                             soundBufferCopy.getSamples() + soundBufferCopy.getSampleCount(),
+                             soundBuffer.getSamples()));
+
+            // Saving only writes the samples that could be decoded, the buffer is left untouched
+            const auto savedFilename = std::filesystem::temp_directory_path() / "killdeer-saved.wav";
+            REQUIRE(soundBuffer.saveToFile(savedFilename));
+            CHECK(sf::SoundBuffer(savedFilename).getSampleCount() == soundBufferCopy.getSampleCount());
+            CHECK(soundBuffer.getSampleCount() == 112941);
+            CHECK(std::filesystem::remove(savedFilename));
+
+            // Modifying the buffer keeps only the samples that could be decoded
+            REQUIRE(soundBuffer.resample(soundBuffer.getSampleRate()));
+            CHECK(soundBuffer.getSampleCount() == soundBufferCopy.getSampleCount());
+            CHECK(soundBuffer.getSampleCount() == soundBuffer.getDecodedSampleCount());
+            CHECK(std::filesystem::remove(filename));
+        }
+    }
+
+    SECTION("resample()")
+    {
+        sf::SoundBuffer soundBuffer("Audio/ding.flac");
+
+        SECTION("Invalid sample rate")
+        {
+            CHECK(!soundBuffer.resample(0));
+            CHECK(soundBuffer.getSampleRate() == 44100);
+        }
+
+        SECTION("Same sample rate")
+        {
+            REQUIRE(soundBuffer.resample(44100));
+            CHECK(soundBuffer.getSampleCount() == 87798);
+        }
+
+        SECTION("Different sample rate")
+        {
+            REQUIRE(soundBuffer.resample(22050, sf::Resampler::Quality::Fast));
+            CHECK(soundBuffer.getSampleCount() == 43899);
+            CHECK(soundBuffer.getSampleRate() == 22050);
+            CHECK(soundBuffer.getChannelCount() == 1);
+            CHECK(soundBuffer.getDuration() == sf::microseconds(1990884));
+        }
+    }
+
     SECTION("saveToFile()")
     {
         const std::u32string stem      = GENERATE(U"tmp", U"tmp-ń", U"tmp-🐌");
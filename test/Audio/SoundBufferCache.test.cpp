@@ -0,0 +1,126 @@
+#include <SFML/Audio/SoundBufferCache.hpp>
+
+// Other 1st party headers
+#include <SFML/Audio/Sound.hpp>
+#include <SFML/Audio/SoundBuffer.hpp>
+
+#include <SFML/System/FileInputStream.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <AudioUtil.hpp>
+#include <type_traits>
+
+TEST_CASE("[Audio] sf::SoundBufferCache", runAudioDeviceTests())
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::SoundBufferCache>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::SoundBufferCache>);
+        STATIC_CHECK(!std::is_nothrow_move_constructible_v<sf::SoundBufferCache>);
+        STATIC_CHECK(!std::is_nothrow_move_assignable_v<sf::SoundBufferCache>);
+    }
+
+    // ding.mp3 contains 87798 16-bit samples
+    constexpr std::size_t dingSize = 87798 * 2;
+
+    SECTION("Construction")
+    {
+        const sf::SoundBufferCache cache;
+        CHECK(cache.getMemoryBudget() == 64 * 1024 * 1024);
+        CHECK(cache.getMemoryUsage() == 0);
+        CHECK(cache.getBufferCount() == 0);
+    }
+
+    SECTION("load()")
+    {
+        sf::SoundBufferCache cache;
+
+        SECTION("Invalid file")
+        {
+            CHECK(cache.load("does/not/exist.wav") == nullptr);
+            CHECK(cache.getBufferCount() == 0);
+        }
+
+        SECTION("Valid file")
+        {
+            const auto buffer = cache.load("Audio/ding.mp3");
+            REQUIRE(buffer != nullptr);
+            CHECK(buffer->getSampleCount() == 87798);
+            CHECK(cache.load("Audio/ding.mp3") == buffer);
+            CHECK(cache.load("Audio/../Audio/ding.mp3") == buffer);
+            CHECK(cache.getMemoryUsage() == dingSize);
+            CHECK(cache.getBufferCount() == 1);
+        }
+
+        SECTION("Stream")
+        {
+            sf::FileInputStream stream("Audio/ding.mp3");
+            const auto          buffer = cache.load(stream);
+            REQUIRE(buffer != nullptr);
+            CHECK(buffer->getSampleCount() == 87798);
+            CHECK(cache.load(stream) == buffer);
+            CHECK(cache.getBufferCount() == 1);
+
+            cache.remove(stream);
+            CHECK(cache.getBufferCount() == 0);
+        }
+    }
+
+    SECTION("loadAsync()")
+    {
+        sf::SoundBufferCache cache(64 * 1024 * 1024, 2);
+
+        SECTION("Invalid file")
+        {
+            const auto handle = cache.loadAsync("does/not/exist.wav");
+            CHECK(handle.get() == nullptr);
+        }
+
+        SECTION("Valid file")
+        {
+            const auto handle = cache.loadAsync("Audio/ding.mp3");
+            CHECK(cache.loadAsync("Audio/ding.mp3").get() == handle.get());
+            REQUIRE(handle.get() != nullptr);
+            CHECK(handle.get()->getSampleCount() == 87798);
+            CHECK(cache.load("Audio/ding.mp3") == handle.get());
+            CHECK(cache.getMemoryUsage() == dingSize);
+        }
+    }
+
+    SECTION("Eviction")
+    {
+        sf::SoundBufferCache cache(dingSize);
+
+        auto buffer = cache.load("Audio/ding.mp3");
+        REQUIRE(buffer != nullptr);
+        CHECK(cache.load("Audio/killdeer.wav") != nullptr);
+        CHECK(cache.getBufferCount() == 2);
+
+        // The next operation that trims the cache evicts the unused buffer
+        cache.setMemoryBudget(dingSize);
+        CHECK(cache.getBufferCount() == 1);
+        CHECK(cache.getMemoryUsage() == dingSize);
+        CHECK(cache.load("Audio/ding.mp3") == buffer);
+
+        SECTION("Buffers in use are kept")
+        {
+            cache.setMemoryBudget(0);
+            CHECK(cache.getMemoryBudget() == 0);
+            CHECK(cache.getBufferCount() == 1);
+
+            const sf::Sound sound(*buffer);
+            buffer.reset();
+            cache.clear();
+            CHECK(cache.getBufferCount() == 1);
+        }
+
+        SECTION("Unused buffers are evicted")
+        {
+            buffer.reset();
+            cache.setMemoryBudget(0);
+            CHECK(cache.getBufferCount() == 0);
+            CHECK(cache.getMemoryUsage() == 0);
+        }
+    }
+}
@@ -0,0 +1,308 @@
+#include <SFML/Network/IpAddress.hpp>
+#include <SFML/Network/Packet.hpp>
+#include <SFML/Network/SocketSelector.hpp>
+#include <SFML/Network/TcpListener.hpp>
+#include <SFML/Network/TcpSocket.hpp>
+#include <SFML/Network/UdpSocket.hpp>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+// Benchmarks of the hot paths of the network module, over the loopback interface.
+// They are not run by ctest; build the runbenchmarks target, or run this executable
+// with "--reporter XML" to get machine-readable results that can be compared
+// between builds. Throughput is the payload size divided by the mean time.
+
+namespace
+{
+// Connect a pair of TCP sockets over the loopback interface
+void connect(sf::TcpSocket& client, sf::TcpSocket& server)
+{
+    sf::TcpListener listener;
+    REQUIRE(listener.listen(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+    REQUIRE(client.connect(sf::IpAddress::LocalHost, listener.getLocalPort()) == sf::Socket::Status::Done);
+    REQUIRE(listener.accept(server) == sf::Socket::Status::Done);
+}
+
+// Receive exactly the given number of bytes from a blocking socket
+void receiveAll(sf::TcpSocket& socket, std::byte* data, std::size_t size)
+{
+    std::size_t total = 0;
+    while (total < size)
+    {
+        std::size_t received = 0;
+        REQUIRE(socket.receive(data + total, size - total, received) == sf::Socket::Status::Done);
+        total += received;
+    }
+}
+
+// Move a block of data from a non-blocking socket to another one, from a single thread
+std::size_t transfer(sf::TcpSocket&                sender,
+                     sf::TcpSocket&                receiver,
+                     const std::vector<std::byte>& data,
+                     std::vector<std::byte>&       buffer)
+{
+    std::size_t sent  = 0;
+    std::size_t total = 0;
+    while (total < data.size())
+    {
+        if (sent < data.size())
+        {
+            std::size_t count = 0;
+            (void)sender.send(data.data() + sent, data.size() - sent, count);
+            sent += count;
+        }
+
+        std::size_t count = 0;
+        if (receiver.receive(buffer.data(), buffer.size(), count) == sf::Socket::Status::Done)
+            total += count;
+    }
+
+    return total;
+}
+
+// Fill a packet with the kind of data a game sends for each entity of its world
+void writeEntity(sf::Packet& packet, std::uint32_t id)
+{
+    packet << id << 12.5f << -3.25f << 100.f << std::string("entity") << std::uint8_t{3};
+    for (std::uint16_t i = 0; i < 16; ++i)
+        packet << i;
+}
+
+// Read back the data written by writeEntity
+std::uint32_t readEntity(sf::Packet& packet)
+{
+    std::uint32_t id    = 0;
+    float         x     = 0.f;
+    float         y     = 0.f;
+    float         z     = 0.f;
+    std::string   name  = {};
+    std::uint8_t  flags = 0;
+    packet >> id >> x >> y >> z >> name >> flags;
+    for (int i = 0; i < 16; ++i)
+    {
+        std::uint16_t value = 0;
+        packet >> value;
+    }
+
+    return id;
+}
+} // namespace
+
+TEST_CASE("[Network] sf::TcpSocket raw data")
+{
+    sf::TcpSocket client;
+    sf::TcpSocket server;
+    connect(client, server);
+
+    std::vector<std::byte> data(1024 * 1024, std::byte{42});
+    std::vector<std::byte> buffer(data.size());
+
+    BENCHMARK("Round trip of 64 bytes")
+    {
+        REQUIRE(client.send(data.data(), 64) == sf::Socket::Status::Done);
+        receiveAll(server, buffer.data(), 64);
+        REQUIRE(server.send(buffer.data(), 64) == sf::Socket::Status::Done);
+        receiveAll(client, buffer.data(), 64);
+        return buffer[0];
+    };
+
+    client.setBlocking(false);
+    server.setBlocking(false);
+
+    BENCHMARK("Transfer of 1 MiB")
+    {
+        return transfer(client, server, data, buffer);
+    };
+}
+
+TEST_CASE("[Network] sf::TcpSocket packets")
+{
+    sf::TcpSocket client;
+    sf::TcpSocket server;
+    connect(client, server);
+
+    sf::Packet message;
+    writeEntity(message, 1);
+
+    BENCHMARK("Round trip of a packet")
+    {
+        sf::Packet packet = message;
+        REQUIRE(client.send(packet) == sf::Socket::Status::Done);
+        REQUIRE(server.receive(packet) == sf::Socket::Status::Done);
+        REQUIRE(server.send(packet) == sf::Socket::Status::Done);
+        REQUIRE(client.receive(packet) == sf::Socket::Status::Done);
+        return packet.getDataSize();
+    };
+
+    std::vector<sf::Packet> batch(64);
+    for (std::uint32_t i = 0; i < batch.size(); ++i)
+        writeEntity(batch[i], i);
+
+    BENCHMARK("Stream of 64 packets")
+    {
+        std::vector<sf::Packet> packets = batch;
+        REQUIRE(client.send(packets.data(), packets.size()) == sf::Socket::Status::Done);
+
+        std::size_t             total = 0;
+        std::vector<sf::Packet> received;
+        while (total < batch.size())
+        {
+            REQUIRE(server.receive(received) == sf::Socket::Status::Done);
+            total += received.size();
+        }
+
+        return total;
+    };
+}
+
+TEST_CASE("[Network] sf::UdpSocket datagrams")
+{
+    sf::UdpSocket first;
+    sf::UdpSocket second;
+    REQUIRE(first.bind(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+    REQUIRE(second.bind(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+
+    std::array<std::byte, 512>   data{};
+    std::array<std::byte, 1024>  buffer{};
+    std::optional<sf::IpAddress> remoteAddress;
+    unsigned short               remotePort = 0;
+    std::size_t                  received   = 0;
+
+    BENCHMARK("Round trip of 512 bytes")
+    {
+        REQUIRE(first.send(data.data(), data.size(), sf::IpAddress::LocalHost, second.getLocalPort()) ==
+                sf::Socket::Status::Done);
+        REQUIRE(second.receive(buffer.data(), buffer.size(), received, remoteAddress, remotePort) ==
+                sf::Socket::Status::Done);
+        REQUIRE(second.send(buffer.data(), received, sf::IpAddress::LocalHost, first.getLocalPort()) ==
+                sf::Socket::Status::Done);
+        REQUIRE(first.receive(buffer.data(), buffer.size(), received, remoteAddress, remotePort) ==
+                sf::Socket::Status::Done);
+        return received;
+    };
+
+    constexpr std::size_t batchSize = 32;
+
+    const sf::UdpSocket::Datagram datagram{data.data(), data.size(), sf::IpAddress::LocalHost, second.getLocalPort()};
+
+    std::vector<sf::UdpSocket::Datagram>       datagrams(batchSize, datagram);
+    std::vector<std::array<std::byte, 1024>>   storage(batchSize);
+    std::vector<sf::UdpSocket::DatagramBuffer> buffers(batchSize);
+    for (std::size_t i = 0; i < batchSize; ++i)
+    {
+        buffers[i].data = storage[i].data();
+        buffers[i].size = storage[i].size();
+    }
+
+    BENCHMARK("Batch of 32 datagrams of 512 bytes")
+    {
+        std::size_t sent = 0;
+        REQUIRE(first.sendBatch(datagrams.data(), datagrams.size(), sent) == sf::Socket::Status::Done);
+
+        std::size_t total = 0;
+        while (total < batchSize)
+        {
+            std::size_t count = 0;
+            REQUIRE(second.receiveBatch(buffers.data() + total, batchSize - total, count) == sf::Socket::Status::Done);
+            total += count;
+        }
+
+        return total;
+    };
+}
+
+TEST_CASE("[Network] sf::SocketSelector")
+{
+    // Many idle sockets and a few active ones, like a server with mostly quiet clients
+    constexpr std::size_t idleCount   = 256;
+    constexpr std::size_t activeCount = 4;
+
+    sf::SocketSelector                          selector;
+    std::vector<std::unique_ptr<sf::UdpSocket>> idle(idleCount);
+    std::vector<std::unique_ptr<sf::UdpSocket>> active(activeCount);
+    for (auto* sockets : {&idle, &active})
+    {
+        for (auto& socket : *sockets)
+        {
+            socket = std::make_unique<sf::UdpSocket>();
+            REQUIRE(socket->bind(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+            selector.add(*socket);
+        }
+    }
+
+    sf::UdpSocket sender;
+    REQUIRE(sender.bind(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+
+    const std::array<std::byte, 64> data{};
+    std::array<std::byte, 64>       buffer{};
+    std::optional<sf::IpAddress>    remoteAddress;
+    unsigned short                  remotePort = 0;
+
+    BENCHMARK("Wait with 256 idle and 4 active sockets")
+    {
+        for (const auto& socket : active)
+            REQUIRE(sender.send(data.data(), data.size(), sf::IpAddress::LocalHost, socket->getLocalPort()) ==
+                    sf::Socket::Status::Done);
+
+        std::size_t total = 0;
+        while (total < activeCount)
+        {
+            REQUIRE(selector.wait());
+            for (sf::Socket* socket : selector.getReadySockets())
+            {
+                std::size_t received = 0;
+                REQUIRE(static_cast<sf::UdpSocket*>(socket)->receive(buffer.data(),
+                                                                     buffer.size(),
+                                                                     received,
+                                                                     remoteAddress,
+                                                                     remotePort) == sf::Socket::Status::Done);
+                ++total;
+            }
+        }
+
+        return total;
+    };
+}
+
+TEST_CASE("[Network] sf::Packet serialization")
+{
+    BENCHMARK("Write 64 entities")
+    {
+        sf::Packet packet;
+        for (std::uint32_t i = 0; i < 64; ++i)
+            writeEntity(packet, i);
+        return packet.getDataSize();
+    };
+
+    sf::Packet entities;
+    for (std::uint32_t i = 0; i < 64; ++i)
+        writeEntity(entities, i);
+
+    BENCHMARK("Read 64 entities")
+    {
+        sf::Packet    packet = entities;
+        std::uint32_t sum    = 0;
+        for (int i = 0; i < 64; ++i)
+            sum += readEntity(packet);
+        return sum;
+    };
+
+    const std::vector<std::byte> blob(16 * 1024, std::byte{7});
+
+    BENCHMARK("Append 16 KiB")
+    {
+        sf::Packet packet;
+        packet.append(blob.data(), blob.size());
+        return packet.getDataSize();
+    };
+}
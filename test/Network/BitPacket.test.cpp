@@ -0,0 +1,339 @@
+#include <SFML/Network/BitPacket.hpp>
+
+// Other 1st party headers
+#include <SFML/System/String.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <limits>
+#include <string>
+#include <type_traits>
+
+#include <cstddef>
+#include <cstdint>
+
+#define CHECK_BIT_PACKET_STREAM_OPERATORS(expected, bitCount) \
+    do                                                        \
+    {                                                         \
+        sf::BitPacket packet;                                 \
+        packet << (expected);                                 \
+        CHECK(packet.getBitCount() == (bitCount));            \
+        CHECK(packet.getDataSize() == ((bitCount) + 7) / 8);  \
+                                                              \
+        std::remove_const_t<decltype(expected)> received{};   \
+        packet >> received;                                   \
+        CHECK(packet.getReadPosition() == (bitCount));        \
+        CHECK(packet.endOfPacket());                          \
+        CHECK(bool{packet});                                  \
+        CHECK((expected) == received);                        \
+    } while (false)
+
+TEST_CASE("[Network] sf::BitPacket")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(std::is_copy_constructible_v<sf::BitPacket>);
+        STATIC_CHECK(std::is_copy_assignable_v<sf::BitPacket>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::BitPacket>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::BitPacket>);
+    }
+
+    SECTION("Default constructor")
+    {
+        const sf::BitPacket packet;
+        CHECK(packet.getReadPosition() == 0);
+        CHECK(packet.getData() == nullptr);
+        CHECK(packet.getDataSize() == 0);
+        CHECK(packet.getBitCount() == 0);
+        CHECK(packet.endOfPacket());
+        CHECK(bool{packet});
+    }
+
+    SECTION("Append and clear")
+    {
+        static constexpr std::array data = {std::byte{0xAB}, std::byte{0xCD}};
+
+        sf::BitPacket packet;
+        packet.append(data.data(), data.size());
+        CHECK(packet.getBitCount() == 16);
+        CHECK(static_cast<const std::byte*>(packet.getData())[0] == std::byte{0xAB});
+
+        // Unaligned bytes are shifted
+        packet.clear();
+        packet << true;
+        packet.append(data.data(), data.size());
+        CHECK(packet.getBitCount() == 17);
+        CHECK(packet.getDataSize() == 3);
+        CHECK(static_cast<const std::byte*>(packet.getData())[0] == std::byte{0x57});
+
+        bool          flag  = false;
+        std::uint64_t value = 0;
+        CHECK(packet >> flag);
+        CHECK(packet.readBits(value, 16));
+        CHECK(flag);
+        CHECK(value == 0xCDAB);
+
+        packet.clear();
+        CHECK(packet.getData() == nullptr);
+        CHECK(packet.getBitCount() == 0);
+        CHECK(packet.getReadPosition() == 0);
+    }
+
+    SECTION("Bits")
+    {
+        sf::BitPacket packet;
+        packet.writeBits(5, 3).writeBits(0, 0).writeBits(1, 1).writeBits(0x3FF, 10).writeBits(
+            std::numeric_limits<std::uint64_t>::max(),
+            64);
+        CHECK(packet.getBitCount() == 78);
+        CHECK(packet.getDataSize() == 10);
+
+        // Bits higher than the requested count are ignored
+        packet.writeBits(0xFF, 2);
+        CHECK(packet.getBitCount() == 80);
+
+        std::uint64_t a = 0;
+        std::uint64_t b = 42;
+        std::uint64_t c = 0;
+        std::uint64_t d = 0;
+        std::uint64_t e = 0;
+        std::uint64_t f = 0;
+        CHECK(packet.readBits(a, 3).readBits(b, 0).readBits(c, 1).readBits(d, 10).readBits(e, 64).readBits(f, 2));
+        CHECK(a == 5);
+        CHECK(b == 0);
+        CHECK(c == 1);
+        CHECK(d == 0x3FF);
+        CHECK(e == std::numeric_limits<std::uint64_t>::max());
+        CHECK(f == 3);
+        CHECK(packet.endOfPacket());
+    }
+
+    SECTION("Quantized floats")
+    {
+        sf::BitPacket packet;
+        packet.writeFloat(0.5f, -1.f, 1.f, 16);
+        packet.writeFloat(-5.f, -1.f, 1.f, 8);
+        packet.writeFloat(5.f, -1.f, 1.f, 8);
+        packet.writeFloat(std::numeric_limits<float>::quiet_NaN(), 0.f, 10.f, 4);
+        CHECK(packet.getBitCount() == 36);
+
+        float a = 0;
+        float b = 0;
+        float c = 0;
+        float d = 42;
+        CHECK(packet.readFloat(a, -1.f, 1.f, 16).readFloat(b, -1.f, 1.f, 8).readFloat(c, -1.f, 1.f, 8));
+        CHECK(packet.readFloat(d, 0.f, 10.f, 4));
+        CHECK(a > 0.4999f);
+        CHECK(a < 0.5001f);
+        CHECK(b == -1.f);
+        CHECK(c == 1.f);
+        CHECK(d == 0.f);
+    }
+
+    SECTION("Stream operators")
+    {
+        SECTION("bool")
+        {
+            CHECK_BIT_PACKET_STREAM_OPERATORS(true, 1u);
+            CHECK_BIT_PACKET_STREAM_OPERATORS(false, 1u);
+        }
+
+        SECTION("std::int8_t")
+        {
+            CHECK_BIT_PACKET_STREAM_OPERATORS(std::int8_t{-128}, 8u);
+            CHECK_BIT_PACKET_STREAM_OPERATORS(std::int8_t{127}, 8u);
+        }
+
+        SECTION("std::uint8_t")
+        {
+            CHECK_BIT_PACKET_STREAM_OPERATORS(std::uint8_t{255}, 8u);
+        }
+
+        SECTION("std::int16_t")
+        {
+            CHECK_BIT_PACKET_STREAM_OPERATORS(std::int16_t{-1}, 8u);
+            CHECK_BIT_PACKET_STREAM_OPERATORS(std::int16_t{63}, 8u);
+            CHECK_BIT_PACKET_STREAM_OPERATORS(std::int16_t{-64}, 8u);
+            CHECK_BIT_PACKET_STREAM_OPERATORS(std::int16_t{64}, 16u);
+            CHECK_BIT_PACKET_STREAM_OPERATORS(std::numeric_limits<std::int16_t>::min(), 24u);
+            CHECK_BIT_PACKET_STREAM_OPERATORS(std::numeric_limits<std::int16_t>::max(), 24u);
+        }
+
+        SECTION("std::uint16_t")
+        {
+            CHECK_BIT_PACKET_STREAM_OPERATORS(std::uint16_t{127}, 8u);
+            CHECK_BIT_PACKET_STREAM_OPERATORS(std::uint16_t{128}, 16u);
+            CHECK_BIT_PACKET_STREAM_OPERATORS(std::numeric_limits<std::uint16_t>::max(), 24u);
+        }
+
+        SECTION("std::int32_t")
+        {
+            CHECK_BIT_PACKET_STREAM_OPERATORS(std::int32_t{0}, 8u);
+            CHECK_BIT_PACKET_STREAM_OPERATORS(std::numeric_limits<std::int32_t>::min(), 40u);
+            CHECK_BIT_PACKET_STREAM_OPERATORS(std::numeric_limits<std::int32_t>::max(), 40u);
+        }
+
+        SECTION("std::uint32_t")
+        {
+            CHECK_BIT_PACKET_STREAM_OPERATORS(std::uint32_t{300}, 16u);
+            CHECK_BIT_PACKET_STREAM_OPERATORS(std::numeric_limits<std::uint32_t>::max(), 40u);
+        }
+
+        SECTION("std::int64_t")
+        {
+            CHECK_BIT_PACKET_STREAM_OPERATORS(std::int64_t{-2}, 8u);
+            CHECK_BIT_PACKET_STREAM_OPERATORS(std::numeric_limits<std::int64_t>::min(), 80u);
+            CHECK_BIT_PACKET_STREAM_OPERATORS(std::numeric_limits<std::int64_t>::max(), 80u);
+        }
+
+        SECTION("std::uint64_t")
+        {
+            CHECK_BIT_PACKET_STREAM_OPERATORS(std::uint64_t{1}, 8u);
+            CHECK_BIT_PACKET_STREAM_OPERATORS(std::numeric_limits<std::uint64_t>::max(), 80u);
+        }
+
+        SECTION("float")
+        {
+            CHECK_BIT_PACKET_STREAM_OPERATORS(1.5f, 32u);
+            CHECK_BIT_PACKET_STREAM_OPERATORS(std::numeric_limits<float>::lowest(), 32u);
+        }
+
+        SECTION("double")
+        {
+            CHECK_BIT_PACKET_STREAM_OPERATORS(-2.25, 64u);
+            CHECK_BIT_PACKET_STREAM_OPERATORS(std::numeric_limits<double>::max(), 64u);
+        }
+
+        SECTION("std::string")
+        {
+            CHECK_BIT_PACKET_STREAM_OPERATORS(std::string("hello"), 48u);
+            CHECK_BIT_PACKET_STREAM_OPERATORS(std::string(), 8u);
+            CHECK_BIT_PACKET_STREAM_OPERATORS(std::string(200, 'x'), 1616u);
+        }
+
+        SECTION("sf::String")
+        {
+            CHECK_BIT_PACKET_STREAM_OPERATORS(sf::String(U"abc"), 32u);
+            CHECK_BIT_PACKET_STREAM_OPERATORS(sf::String(U"\U0001F600"), 32u);
+        }
+
+        SECTION("Unaligned")
+        {
+            sf::BitPacket packet;
+            packet << true << "abc" << std::uint32_t{1000} << false << std::string("def") << 3.f;
+
+            bool          first  = false;
+            std::string   abc;
+            std::uint32_t number = 0;
+            bool          second = true;
+            std::string   def;
+            float         real = 0;
+            CHECK(packet >> first >> abc >> number >> second >> def >> real);
+            CHECK(first);
+            CHECK(abc == "abc");
+            CHECK(number == 1000);
+            CHECK(!second);
+            CHECK(def == "def");
+            CHECK(real == 3.f);
+            CHECK(packet.endOfPacket());
+        }
+
+        SECTION("Empty string at the end")
+        {
+            sf::BitPacket packet;
+            packet << std::uint32_t{42} << std::string("abc") << std::string();
+            CHECK(packet.getBitCount() == 48);
+
+            std::uint32_t number = 0;
+            std::string   abc;
+            std::string   empty = "not empty";
+            CHECK(packet >> number >> abc >> empty);
+            CHECK(number == 42);
+            CHECK(abc == "abc");
+            CHECK(empty.empty());
+            CHECK(packet.endOfPacket());
+        }
+    }
+
+    SECTION("Round trip through bytes")
+    {
+        sf::BitPacket sent;
+        sent << true << std::int32_t{-123456} << sf::String(U"snapshot");
+        sent.writeBits(2, 2);
+
+        sf::BitPacket received;
+        received.append(sent.getData(), sent.getDataSize());
+        CHECK(received.getBitCount() == sent.getDataSize() * 8);
+
+        bool          flag   = false;
+        std::int32_t  number = 0;
+        sf::String    string;
+        std::uint64_t bits = 0;
+        CHECK(received >> flag >> number >> string);
+        CHECK(received.readBits(bits, 2));
+        CHECK(flag);
+        CHECK(number == -123456);
+        CHECK(string == U"snapshot");
+        CHECK(bits == 2);
+        CHECK(received.getBitCount() - received.getReadPosition() < 8);
+    }
+
+    SECTION("Invalid data")
+    {
+        SECTION("Read past the end")
+        {
+            sf::BitPacket packet;
+            packet.writeBits(3, 2);
+
+            std::uint64_t value = 42;
+            CHECK(!packet.readBits(value, 3));
+            CHECK(value == 42);
+
+            // Failure is sticky
+            CHECK(!packet.readBits(value, 1));
+        }
+
+        SECTION("Varint too large for the type")
+        {
+            sf::BitPacket packet;
+            packet << std::uint32_t{70000};
+
+            std::uint16_t value = 0;
+            CHECK(!(packet >> value));
+            CHECK(value == 0);
+        }
+
+        SECTION("Overlong varint")
+        {
+            static constexpr std::array data = {std::byte{0xFF},
+                                                std::byte{0xFF},
+                                                std::byte{0xFF},
+                                                std::byte{0xFF},
+                                                std::byte{0xFF},
+                                                std::byte{0xFF},
+                                                std::byte{0xFF},
+                                                std::byte{0xFF},
+                                                std::byte{0xFF},
+                                                std::byte{0x7F}};
+
+            sf::BitPacket packet;
+            packet.append(data.data(), data.size());
+
+            std::uint64_t value = 0;
+            CHECK(!(packet >> value));
+        }
+
+        SECTION("String longer than the packet")
+        {
+            sf::BitPacket packet;
+            packet << std::uint64_t{1} << std::uint32_t{1000000};
+
+            std::uint64_t one = 0;
+            std::string   string;
+            CHECK(packet >> one);
+            CHECK(!(packet >> string));
+            CHECK(string.empty());
+        }
+    }
+}
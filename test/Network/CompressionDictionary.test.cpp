@@ -0,0 +1,61 @@
+#include <SFML/Network/CompressionDictionary.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include <cstddef>
+#include <cstring>
+
+TEST_CASE("[Network] sf::CompressionDictionary")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_default_constructible_v<sf::CompressionDictionary>);
+        STATIC_CHECK(std::is_copy_constructible_v<sf::CompressionDictionary>);
+        STATIC_CHECK(std::is_copy_assignable_v<sf::CompressionDictionary>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::CompressionDictionary>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::CompressionDictionary>);
+    }
+
+    SECTION("Construction")
+    {
+        SECTION("Empty")
+        {
+            const sf::CompressionDictionary dictionary(nullptr, 0);
+            CHECK(dictionary.getData() == nullptr);
+            CHECK(dictionary.getDataSize() == 0);
+        }
+
+        SECTION("Data")
+        {
+            static constexpr std::string_view sample = "sample data";
+
+            const sf::CompressionDictionary dictionary(sample.data(), sample.size());
+            CHECK(dictionary.getData() != sample.data());
+            REQUIRE(dictionary.getDataSize() == sample.size());
+            CHECK(std::memcmp(dictionary.getData(), sample.data(), sample.size()) == 0);
+        }
+
+        SECTION("Large data")
+        {
+            std::vector<std::byte> sample(100000);
+            sample.back() = std::byte{42};
+
+            const sf::CompressionDictionary dictionary(sample.data(), sample.size());
+            REQUIRE(dictionary.getDataSize() == 65535);
+            CHECK(static_cast<const std::byte*>(dictionary.getData())[65534] == std::byte{42});
+        }
+    }
+
+    SECTION("Identifier")
+    {
+        const sf::CompressionDictionary first("abcdef", 6);
+        const sf::CompressionDictionary same("abcdef", 6);
+        const sf::CompressionDictionary other("abcdeg", 6);
+        CHECK(first.getId() == same.getId());
+        CHECK(first.getId() != other.getId());
+    }
+}
@@ -1,9 +1,162 @@
 #include <SFML/Network/Ftp.hpp>
 
+// Other 1st party headers
+#include <SFML/Network/IpAddress.hpp>
+#include <SFML/Network/TcpListener.hpp>
+#include <SFML/Network/TcpSocket.hpp>
+
 #include <catch2/catch_test_macros.hpp>
 
+#include <array>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <thread>
 #include <type_traits>
 
+#include <cstdint>
+
+namespace
+{
+// Minimal FTP server holding a single file, for one client
+class Server
+{
+public:
+    explicit Server(std::string file) : m_file(std::move(file))
+    {
+        (void)m_listener.listen(sf::Socket::AnyPort, sf::IpAddress::LocalHost);
+        m_thread = std::thread([this] { run(); });
+    }
+
+    ~Server()
+    {
+        m_thread.join();
+    }
+
+    Server(const Server&)            = delete;
+    Server& operator=(const Server&) = delete;
+
+    [[nodiscard]] unsigned short getPort() const
+    {
+        return m_listener.getLocalPort();
+    }
+
+    // Valid once the client disconnected
+    [[nodiscard]] const std::string& getFile() const
+    {
+        return m_file;
+    }
+
+    [[nodiscard]] std::uint64_t getRestartOffset() const
+    {
+        return m_restartOffset;
+    }
+
+    [[nodiscard]] std::size_t getSizeCommandCount() const
+    {
+        return m_sizeCommandCount;
+    }
+
+private:
+    void run()
+    {
+        sf::TcpSocket control;
+        if (m_listener.accept(control) != sf::Socket::Status::Done)
+            return;
+
+        reply(control, "220 Ready");
+
+        sf::TcpListener        dataListener;
+        sf::TcpSocket          data;
+        std::string            received;
+        std::array<char, 1024> buffer{};
+        std::size_t            size = 0;
+        while (control.receive(buffer.data(), buffer.size(), size) == sf::Socket::Status::Done)
+        {
+            received.append(buffer.data(), size);
+            for (auto end = received.find("\r\n"); end != std::string::npos; end = received.find("\r\n"))
+            {
+                std::istringstream line(received.substr(0, end));
+                received.erase(0, end + 2);
+
+                std::string command;
+                line >> command;
+                if (command == "PASV")
+                {
+                    (void)dataListener.listen(sf::Socket::AnyPort, sf::IpAddress::LocalHost);
+                    const unsigned short port = dataListener.getLocalPort();
+                    reply(control,
+                          "227 Entering Passive Mode (127,0,0,1," + std::to_string(port / 256) + "," +
+                              std::to_string(port % 256) + ")");
+                    (void)dataListener.accept(data);
+                }
+                else if (command == "SIZE")
+                {
+                    ++m_sizeCommandCount;
+                    reply(control, m_file.empty() ? "550 No such file" : "213 " + std::to_string(m_file.size()));
+                }
+                else if (command == "REST")
+                {
+                    line >> m_restartOffset;
+                    reply(control, "350 Restarting");
+                }
+                else if (command == "RETR")
+                {
+                    reply(control, "150 Sending");
+                    const std::string rest = m_file.substr(static_cast<std::size_t>(m_restartOffset));
+                    const bool        sent = data.send(rest.data(), rest.size()) == sf::Socket::Status::Done;
+                    data.disconnect();
+                    reply(control, sent ? "226 Done" : "426 Aborted");
+                }
+                else if (command == "STOR")
+                {
+                    reply(control, "150 Receiving");
+                    m_file.resize(static_cast<std::size_t>(m_restartOffset));
+                    while (data.receive(buffer.data(), buffer.size(), size) == sf::Socket::Status::Done)
+                        m_file.append(buffer.data(), size);
+                    data.disconnect();
+                    reply(control, "226 Done");
+                }
+                else if (command == "QUIT")
+                {
+                    reply(control, "221 Bye");
+                    return;
+                }
+                else
+                {
+                    reply(control, "200 Ok");
+                }
+            }
+        }
+    }
+
+    static void reply(sf::TcpSocket& socket, const std::string& line)
+    {
+        const std::string data = line + "\r\n";
+        (void)socket.send(data.data(), data.size());
+    }
+
+    sf::TcpListener m_listener;
+    std::string     m_file;
+    std::uint64_t   m_restartOffset{};
+    std::size_t     m_sizeCommandCount{};
+    std::thread     m_thread;
+};
+
+[[nodiscard]] std::string readFile(const std::filesystem::path& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    return {std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+}
+
+void writeFile(const std::filesystem::path& path, const std::string& content)
+{
+    std::ofstream(path, std::ios::binary).write(content.data(), static_cast<std::streamsize>(content.size()));
+}
+} // namespace
+
 TEST_CASE("[Network] sf::Ftp")
 {
     SECTION("Type traits")
@@ -99,4 +252,123 @@ TEST_CASE("[Network] sf::Ftp")
             CHECK(listingResponse.getListing() == std::vector<std::string>{"foo", "bar"});
         }
     }
+
+    SECTION("File transfers")
+    {
+        std::string content(4'000'000, '\0');
+        for (std::size_t i = 0; i < content.size(); ++i)
+            content[i] = static_cast<char>(i * 7 + i / 251);
+
+        const std::filesystem::path directory = std::filesystem::temp_directory_path();
+        const std::filesystem::path local     = directory / "sfml-ftp-test.bin";
+        std::filesystem::remove(local);
+
+        sf::Ftp ftp;
+        ftp.setTransferBufferSize(64 * 1024);
+        CHECK(ftp.getTransferBufferSize() == 64 * 1024);
+
+        sf::Ftp::Progress lastProgress;
+        std::size_t       reports = 0;
+        ftp.setProgressCallback(
+            [&](const sf::Ftp::Progress& progress)
+            {
+                CHECK(progress.transferred > lastProgress.transferred);
+                lastProgress = progress;
+                ++reports;
+                return true;
+            });
+
+        SECTION("download()")
+        {
+            Server server(content);
+            REQUIRE(ftp.connect(sf::IpAddress::LocalHost, server.getPort()).isOk());
+
+            CHECK(ftp.download("sfml-ftp-test.bin", directory).isOk());
+            CHECK(readFile(local) == content);
+            CHECK(reports > 1);
+            CHECK(lastProgress.transferred == content.size());
+            CHECK(lastProgress.total == content.size());
+            CHECK(lastProgress.throughput > 0);
+
+            CHECK(ftp.disconnect().isOk());
+            CHECK(server.getSizeCommandCount() == 1);
+        }
+
+        SECTION("download() without progress callback")
+        {
+            ftp.setProgressCallback({});
+
+            Server server(content);
+            REQUIRE(ftp.connect(sf::IpAddress::LocalHost, server.getPort()).isOk());
+
+            CHECK(ftp.download("sfml-ftp-test.bin", directory).isOk());
+            CHECK(readFile(local) == content);
+            CHECK(reports == 0);
+
+            // The size of the file is only needed to report the progress
+            CHECK(ftp.disconnect().isOk());
+            CHECK(server.getSizeCommandCount() == 0);
+        }
+
+        SECTION("download() resumed")
+        {
+            writeFile(local, content.substr(0, 1'000'000));
+
+            Server server(content);
+            REQUIRE(ftp.connect(sf::IpAddress::LocalHost, server.getPort()).isOk());
+
+            CHECK(ftp.download("sfml-ftp-test.bin", directory, sf::Ftp::TransferMode::Binary, true).isOk());
+            CHECK(readFile(local) == content);
+            CHECK(lastProgress.transferred == content.size());
+
+            CHECK(ftp.disconnect().isOk());
+            CHECK(server.getRestartOffset() == 1'000'000);
+        }
+
+        SECTION("download() aborted")
+        {
+            ftp.setProgressCallback([](const sf::Ftp::Progress&) { return false; });
+
+            Server server(content);
+            REQUIRE(ftp.connect(sf::IpAddress::LocalHost, server.getPort()).isOk());
+
+            const sf::Ftp::Response response = ftp.download("sfml-ftp-test.bin", directory);
+            CHECK(response.getStatus() == sf::Ftp::Response::Status::TransferAborted);
+            CHECK(!std::filesystem::exists(local));
+
+            CHECK(ftp.disconnect().isOk());
+        }
+
+        SECTION("upload()")
+        {
+            writeFile(local, content);
+
+            Server server("");
+            REQUIRE(ftp.connect(sf::IpAddress::LocalHost, server.getPort()).isOk());
+
+            CHECK(ftp.upload(local, "").isOk());
+            CHECK(lastProgress.transferred == content.size());
+            CHECK(lastProgress.total == content.size());
+
+            CHECK(ftp.disconnect().isOk());
+            CHECK(server.getFile() == content);
+        }
+
+        SECTION("upload() resumed")
+        {
+            writeFile(local, content);
+
+            Server server(content.substr(0, 3'000'000));
+            REQUIRE(ftp.connect(sf::IpAddress::LocalHost, server.getPort()).isOk());
+
+            CHECK(ftp.upload(local, "", sf::Ftp::TransferMode::Binary, false, true).isOk());
+            CHECK(lastProgress.transferred == content.size());
+
+            CHECK(ftp.disconnect().isOk());
+            CHECK(server.getRestartOffset() == 3'000'000);
+            CHECK(server.getFile() == content);
+        }
+
+        std::filesystem::remove(local);
+    }
 }
@@ -1,8 +1,101 @@
 #include <SFML/Network/Http.hpp>
 
+// Other 1st party headers
+#include <SFML/Network/TcpListener.hpp>
+#include <SFML/Network/TcpSocket.hpp>
+
 #include <catch2/catch_test_macros.hpp>
 
+#include <array>
+#include <sstream>
+#include <string>
+#include <thread>
 #include <type_traits>
+#include <vector>
+
+#include <cstddef>
+
+namespace
+{
+// Minimal HTTP server answering the requests of each accepted connection with the given responses, in turn
+class Server
+{
+public:
+    explicit Server(std::vector<std::string> responses, std::size_t connections = 1, bool closeAfterResponse = false) :
+    m_responses(std::move(responses)),
+    m_closeAfterResponse(closeAfterResponse)
+    {
+        (void)m_listener.listen(sf::Socket::AnyPort, sf::IpAddress::LocalHost);
+        m_thread = std::thread([this, connections] { run(connections); });
+    }
+
+    ~Server()
+    {
+        // Idle connections of the client would keep the server waiting for more requests
+        sf::Http::closeIdleConnections();
+        if (m_thread.joinable())
+            m_thread.join();
+    }
+
+    Server(const Server&)            = delete;
+    Server& operator=(const Server&) = delete;
+
+    [[nodiscard]] unsigned short getPort() const
+    {
+        return m_listener.getLocalPort();
+    }
+
+    [[nodiscard]] std::vector<std::size_t> getRequestsPerConnection()
+    {
+        sf::Http::closeIdleConnections();
+        m_thread.join();
+        return m_requestsPerConnection;
+    }
+
+private:
+    void run(std::size_t connections)
+    {
+        std::size_t next = 0;
+        for (std::size_t i = 0; i < connections; ++i)
+        {
+            sf::TcpSocket socket;
+            if (m_listener.accept(socket) != sf::Socket::Status::Done)
+                return;
+
+            std::size_t            requests = 0;
+            std::string            received;
+            std::array<char, 1024> buffer{};
+            std::size_t            size = 0;
+            bool                   closed = false;
+            while (!closed && (socket.receive(buffer.data(), buffer.size(), size) == sf::Socket::Status::Done))
+            {
+                received.append(buffer.data(), size);
+
+                // Requests of the tests have no body: each one ends with an empty line
+                for (auto end = received.find("\r\n\r\n"); end != std::string::npos; end = received.find("\r\n\r\n"))
+                {
+                    received.erase(0, end + 4);
+                    ++requests;
+
+                    const std::string& response = m_responses[next++ % m_responses.size()];
+                    closed = (socket.send(response.data(), response.size()) != sf::Socket::Status::Done) ||
+                             m_closeAfterResponse;
+                    if (closed)
+                        break;
+                }
+            }
+
+            m_requestsPerConnection.push_back(requests);
+        }
+    }
+
+    sf::TcpListener          m_listener;
+    std::vector<std::string> m_responses;
+    bool                     m_closeAfterResponse{};
+    std::vector<std::size_t> m_requestsPerConnection;
+    std::thread              m_thread;
+};
+} // namespace
 
 TEST_CASE("[Network] sf::Http")
 {
@@ -45,4 +138,279 @@ TEST_CASE("[Network] sf::Http")
             CHECK(response.getBody().empty());
         }
     }
+
+    SECTION("Persistent connections")
+    {
+        sf::Http::closeIdleConnections();
+
+        SECTION("Content-Length framing")
+        {
+            Server server({"HTTP/1.1 200 OK\r\nContent-Length: 5\r\n\r\nhello"});
+
+            sf::Http http("127.0.0.1", server.getPort());
+            CHECK(http.getKeepAlive());
+            for (int i = 0; i < 3; ++i)
+            {
+                const sf::Http::Response response = http.sendRequest(sf::Http::Request("/"));
+                CHECK(response.getStatus() == sf::Http::Response::Status::Ok);
+                CHECK(response.getBody() == "hello");
+            }
+
+            // Other clients of the same host share the connection
+            sf::Http other("127.0.0.1", server.getPort());
+            CHECK(other.sendRequest(sf::Http::Request("/")).getBody() == "hello");
+
+            CHECK(server.getRequestsPerConnection() == std::vector<std::size_t>{4});
+        }
+
+        SECTION("Chunked framing")
+        {
+            Server server(
+                {"HTTP/1.1 200 OK\r\nTransfer-Encoding: chunked\r\n\r\n4\r\nWiki\r\n5\r\npedia\r\n0\r\n\r\n"});
+
+            sf::Http http("127.0.0.1", server.getPort());
+            CHECK(http.sendRequest(sf::Http::Request("/")).getBody() == "Wikipedia");
+            CHECK(http.sendRequest(sf::Http::Request("/")).getBody() == "Wikipedia");
+
+            CHECK(server.getRequestsPerConnection() == std::vector<std::size_t>{2});
+        }
+
+        SECTION("HEAD response without body")
+        {
+            Server server({"HTTP/1.1 200 OK\r\nContent-Length: 5\r\n\r\n"});
+
+            sf::Http                http("127.0.0.1", server.getPort());
+            const sf::Http::Request request("/", sf::Http::Request::Method::Head);
+            for (int i = 0; i < 2; ++i)
+            {
+                const sf::Http::Response response = http.sendRequest(request);
+                CHECK(response.getStatus() == sf::Http::Response::Status::Ok);
+                CHECK(response.getField("Content-Length") == "5");
+                CHECK(response.getBody().empty());
+            }
+
+            CHECK(server.getRequestsPerConnection() == std::vector<std::size_t>{2});
+        }
+
+        SECTION("Connection closed by the server")
+        {
+            Server server({"HTTP/1.1 200 OK\r\nConnection: close\r\nContent-Length: 2\r\n\r\nok"}, 2);
+
+            sf::Http http("127.0.0.1", server.getPort());
+            CHECK(http.sendRequest(sf::Http::Request("/")).getBody() == "ok");
+            CHECK(http.sendRequest(sf::Http::Request("/")).getBody() == "ok");
+
+            CHECK(server.getRequestsPerConnection() == std::vector<std::size_t>{1, 1});
+        }
+
+        SECTION("setKeepAlive(false)")
+        {
+            Server server({"HTTP/1.1 200 OK\r\nContent-Length: 2\r\n\r\nok"}, 2);
+
+            sf::Http http("127.0.0.1", server.getPort());
+            http.setKeepAlive(false);
+            CHECK(!http.getKeepAlive());
+            CHECK(http.sendRequest(sf::Http::Request("/")).getBody() == "ok");
+            CHECK(http.sendRequest(sf::Http::Request("/")).getBody() == "ok");
+
+            CHECK(server.getRequestsPerConnection() == std::vector<std::size_t>{1, 1});
+        }
+
+        SECTION("Pipelining")
+        {
+            Server server({"HTTP/1.1 200 OK\r\nContent-Length: 3\r\n\r\none",
+                           "HTTP/1.1 404 Not Found\r\nContent-Length: 3\r\n\r\ntwo",
+                           "HTTP/1.1 200 OK\r\nTransfer-Encoding: chunked\r\n\r\n5\r\nthree\r\n0\r\n\r\n"});
+
+            sf::Http                              http("127.0.0.1", server.getPort());
+            const std::vector<sf::Http::Response> responses = http.sendRequests(std::vector<sf::Http::Request>(3));
+            REQUIRE(responses.size() == 3);
+            CHECK(responses[0].getBody() == "one");
+            CHECK(responses[1].getStatus() == sf::Http::Response::Status::NotFound);
+            CHECK(responses[1].getBody() == "two");
+            CHECK(responses[2].getBody() == "three");
+
+            CHECK(server.getRequestsPerConnection() == std::vector<std::size_t>{3});
+        }
+
+        SECTION("Pipelining interrupted by the server")
+        {
+            Server server({"HTTP/1.1 200 OK\r\nContent-Length: 3\r\n\r\none",
+                           "HTTP/1.1 200 OK\r\nConnection: close\r\nContent-Length: 3\r\n\r\ntwo",
+                           "HTTP/1.1 200 OK\r\nContent-Length: 5\r\n\r\nthree"},
+                          2);
+
+            sf::Http                              http("127.0.0.1", server.getPort());
+            const std::vector<sf::Http::Response> responses = http.sendRequests(std::vector<sf::Http::Request>(3));
+            REQUIRE(responses.size() == 3);
+            CHECK(responses[0].getBody() == "one");
+            CHECK(responses[1].getBody() == "two");
+            CHECK(responses[2].getStatus() == sf::Http::Response::Status::Ok);
+
+            // The server received the three requests on the first connection, but only answered two of them
+            const std::vector<std::size_t> requests = server.getRequestsPerConnection();
+            REQUIRE(requests.size() == 2);
+            CHECK(requests[1] == 1);
+        }
+
+        SECTION("Unanswered POST request")
+        {
+            Server server({"HTTP/1.1 200 OK\r\nContent-Length: 3\r\n\r\none",
+                           "HTTP/1.1 200 OK\r\nConnection: close\r\nContent-Length: 3\r\n\r\ntwo"});
+
+            sf::Http                       http("127.0.0.1", server.getPort());
+            std::vector<sf::Http::Request> requests(4);
+            requests[2].setMethod(sf::Http::Request::Method::Post);
+            const std::vector<sf::Http::Response> responses = http.sendRequests(requests);
+            REQUIRE(responses.size() == 4);
+            CHECK(responses[1].getBody() == "two");
+
+            // The POST request may have been processed by the server, it must not be sent twice
+            CHECK(responses[2].getStatus() == sf::Http::Response::Status::ConnectionFailed);
+            CHECK(responses[3].getStatus() == sf::Http::Response::Status::ConnectionFailed);
+            CHECK(server.getRequestsPerConnection() == std::vector<std::size_t>{4});
+        }
+
+        SECTION("Stale idle connection")
+        {
+            Server server({"HTTP/1.1 200 OK\r\nContent-Length: 2\r\n\r\nok"}, 2);
+
+            sf::Http http("127.0.0.1", server.getPort());
+            CHECK(http.sendRequest(sf::Http::Request("/")).getBody() == "ok");
+
+            // Close the idle connection behind the back of the client
+            sf::Http::setMaxIdleConnections(0);
+            sf::Http::setMaxIdleConnections(8);
+            CHECK(http.sendRequest(sf::Http::Request("/")).getBody() == "ok");
+
+            CHECK(server.getRequestsPerConnection() == std::vector<std::size_t>{1, 1});
+        }
+    }
+
+    SECTION("Streamed responses")
+    {
+        sf::Http::closeIdleConnections();
+
+        // Big enough to arrive in many pieces
+        std::string body(1'000'000, '\0');
+        for (std::size_t i = 0; i < body.size(); ++i)
+            body[i] = static_cast<char>('a' + i % 26);
+
+        SECTION("Content-Length framing")
+        {
+            Server server({"HTTP/1.1 200 OK\r\nContent-Length: " + std::to_string(body.size()) + "\r\n\r\n" + body});
+
+            sf::Http    http("127.0.0.1", server.getPort());
+            std::string received;
+            std::size_t pieces      = 0;
+            bool        headerFirst = false;
+
+            const sf::Http::Response response = http.sendRequest(
+                sf::Http::Request("/"),
+                [&](const char* data, std::size_t size)
+                {
+                    received.append(data, size);
+                    ++pieces;
+                    return true;
+                },
+                [&](const sf::Http::Response& header)
+                {
+                    headerFirst = received.empty() && (header.getStatus() == sf::Http::Response::Status::Ok);
+                    return true;
+                });
+            CHECK(headerFirst);
+            CHECK(response.getStatus() == sf::Http::Response::Status::Ok);
+            CHECK(response.getField("Content-Length") == std::to_string(body.size()));
+            CHECK(response.getBody().empty());
+            CHECK(received == body);
+            CHECK(pieces > 1);
+
+            // The connection is still usable
+            CHECK(http.sendRequest(sf::Http::Request("/")).getBody() == body);
+            CHECK(server.getRequestsPerConnection() == std::vector<std::size_t>{2});
+        }
+
+        SECTION("Chunked framing to an output stream")
+        {
+            std::string chunked = "HTTP/1.1 200 OK\r\nTransfer-Encoding: chunked\r\n\r\n";
+            for (std::size_t i = 0; i < body.size(); i += 100'000)
+                chunked += "186a0;name=value\r\n" + body.substr(i, 100'000) + "\r\n";
+            chunked += "0\r\nChecksum: 1234\r\n\r\n";
+            Server server({chunked});
+
+            sf::Http                 http("127.0.0.1", server.getPort());
+            std::ostringstream       stream;
+            const sf::Http::Response response = http.sendRequest(sf::Http::Request("/"), stream);
+            CHECK(response.getStatus() == sf::Http::Response::Status::Ok);
+            CHECK(response.getField("Checksum") == "1234");
+            CHECK(stream.str() == body);
+
+            CHECK(http.sendRequest(sf::Http::Request("/")).getBody() == body);
+            CHECK(server.getRequestsPerConnection() == std::vector<std::size_t>{2});
+        }
+
+        SECTION("Truncated body")
+        {
+            const std::string half = body.substr(0, body.size() / 2);
+
+            SECTION("Content-Length framing")
+            {
+                Server server({"HTTP/1.1 200 OK\r\nContent-Length: " + std::to_string(body.size()) + "\r\n\r\n" + half},
+                              1,
+                              true);
+
+                sf::Http           http("127.0.0.1", server.getPort());
+                std::ostringstream stream;
+                CHECK(http.sendRequest(sf::Http::Request("/"), stream).getStatus() ==
+                      sf::Http::Response::Status::ConnectionFailed);
+                CHECK(stream.str() == half);
+            }
+
+            SECTION("Chunked framing")
+            {
+                Server server({"HTTP/1.1 200 OK\r\nTransfer-Encoding: chunked\r\n\r\nf4240\r\n" + half}, 1, true);
+
+                sf::Http   http("127.0.0.1", server.getPort());
+                const auto onBody = [](const char*, std::size_t) { return true; };
+                CHECK(http.sendRequest(sf::Http::Request("/"), onBody).getStatus() ==
+                      sf::Http::Response::Status::ConnectionFailed);
+            }
+
+            SECTION("Malformed chunk size")
+            {
+                Server server({"HTTP/1.1 200 OK\r\nTransfer-Encoding: chunked\r\n\r\nxyz\r\n\r\n"}, 1, true);
+
+                sf::Http           http("127.0.0.1", server.getPort());
+                std::ostringstream stream;
+                CHECK(http.sendRequest(sf::Http::Request("/"), stream).getStatus() ==
+                      sf::Http::Response::Status::InvalidResponse);
+            }
+        }
+
+        SECTION("Stopped transfer")
+        {
+            const std::string response = "HTTP/1.1 404 Not Found\r\nContent-Length: " + std::to_string(body.size()) +
+                                         "\r\n\r\n" + body;
+            Server server({response}, 2);
+
+            // The body of an error isn't wanted: stop before it
+            sf::Http   http("127.0.0.1", server.getPort());
+            bool       bodyReceived = false;
+            const auto onBody       = [&](const char*, std::size_t)
+            {
+                bodyReceived = true;
+                return true;
+            };
+            const auto onHeader = [](const sf::Http::Response& header)
+            { return header.getStatus() == sf::Http::Response::Status::Ok; };
+
+            const auto status = http.sendRequest(sf::Http::Request("/"), onBody, onHeader).getStatus();
+            CHECK(status == sf::Http::Response::Status::NotFound);
+            CHECK(!bodyReceived);
+
+            // The connection can't be reused, since the rest of the response is still pending
+            CHECK(http.sendRequest(sf::Http::Request("/")).getBody() == body);
+            CHECK(server.getRequestsPerConnection() == std::vector<std::size_t>{1, 1});
+        }
+    }
 }
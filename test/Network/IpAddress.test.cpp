@@ -2,9 +2,12 @@
 
 #include <catch2/catch_test_macros.hpp>
 
+#include <chrono>
+#include <future>
 #include <sstream>
 #include <string_view>
 #include <type_traits>
+#include <vector>
 
 using namespace std::string_literals;
 using namespace std::string_view_literals;
@@ -54,6 +57,49 @@ TEST_CASE("[Network] sf::IpAddress")
             CHECK(!sf::IpAddress::resolve("").has_value());
         }
 
+        SECTION("resolveAll()")
+        {
+            CHECK(sf::IpAddress::resolveAll("203.0.113.2"sv) == std::vector{sf::IpAddress(203, 0, 113, 2)});
+            CHECK(sf::IpAddress::resolveAll("255.255.255.255"sv) == std::vector{sf::IpAddress::Broadcast});
+            CHECK(sf::IpAddress::resolveAll("").empty());
+
+            const std::vector<sf::IpAddress> localHost = sf::IpAddress::resolveAll("LocalHost"sv);
+            REQUIRE(!localHost.empty());
+            CHECK(localHost.front() == sf::IpAddress::LocalHost);
+            CHECK(sf::IpAddress::resolveAll("localhost"sv) == localHost);
+        }
+
+        SECTION("resolveAsync()")
+        {
+            // Addresses don't need a resolution
+            std::future<std::vector<sf::IpAddress>> address = sf::IpAddress::resolveAsync("198.51.100.234"sv);
+            REQUIRE(address.wait_for(std::chrono::seconds(0)) == std::future_status::ready);
+            CHECK(address.get() == std::vector{sf::IpAddress(198, 51, 100, 234)});
+
+            sf::IpAddress::clearResolverCache();
+            std::future<std::vector<sf::IpAddress>> localHost = sf::IpAddress::resolveAsync("localhost"sv);
+            REQUIRE(localHost.wait_for(std::chrono::seconds(10)) == std::future_status::ready);
+            const std::vector<sf::IpAddress> addresses = localHost.get();
+            REQUIRE(!addresses.empty());
+            CHECK(addresses.front() == sf::IpAddress::LocalHost);
+
+            // The name is cached now
+            std::future<std::vector<sf::IpAddress>> cached = sf::IpAddress::resolveAsync("localhost"sv);
+            REQUIRE(cached.wait_for(std::chrono::seconds(0)) == std::future_status::ready);
+            CHECK(cached.get() == addresses);
+
+            // Several resolutions run at once
+            std::vector<std::future<std::vector<sf::IpAddress>>> futures;
+            sf::IpAddress::setResolverCacheDuration(sf::Time::Zero, sf::Time::Zero);
+            for (int i = 0; i < 8; ++i)
+                futures.push_back(sf::IpAddress::resolveAsync("localhost"sv));
+            for (std::future<std::vector<sf::IpAddress>>& future : futures)
+                CHECK(future.get() == addresses);
+            sf::IpAddress::setResolverCacheDuration(sf::seconds(60), sf::seconds(10));
+
+            CHECK(sf::IpAddress::resolveAsync("").get().empty());
+        }
+
         SECTION("Byte constructor")
         {
             const sf::IpAddress ipAddress(198, 51, 100, 234);
@@ -0,0 +1,248 @@
+#include <SFML/Network/NetworkReactor.hpp>
+
+// Other 1st party headers
+#include <SFML/Network/Packet.hpp>
+#include <SFML/Network/TcpListener.hpp>
+#include <SFML/Network/TcpSocket.hpp>
+#include <SFML/Network/UdpSocket.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <atomic>
+#include <functional>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <cstddef>
+
+TEST_CASE("[Network] sf::NetworkReactor")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::NetworkReactor>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::NetworkReactor>);
+    }
+
+    sf::NetworkReactor reactor;
+
+    SECTION("run() without work")
+    {
+        reactor.run();
+        CHECK(reactor.poll() == 0);
+    }
+
+    SECTION("post()")
+    {
+        int calls = 0;
+        reactor.post([&] { reactor.post([&] { ++calls; }); });
+        CHECK(calls == 0);
+
+        reactor.run();
+        CHECK(calls == 1);
+    }
+
+    SECTION("poll()")
+    {
+        int calls = 0;
+        reactor.post([&] { ++calls; });
+        CHECK(reactor.poll() == 1);
+        CHECK(calls == 1);
+    }
+
+    SECTION("Timers")
+    {
+        std::vector<int> order;
+        reactor.addTimer(sf::milliseconds(20), [&] { order.push_back(2); });
+        reactor.addTimer(sf::milliseconds(5), [&] { order.push_back(1); });
+        const auto cancelled = reactor.addTimer(sf::milliseconds(10), [&] { order.push_back(3); });
+
+        CHECK(reactor.cancelTimer(cancelled));
+        CHECK(!reactor.cancelTimer(cancelled));
+
+        reactor.run();
+        CHECK(order == std::vector<int>{1, 2});
+    }
+
+    SECTION("stop()")
+    {
+        const sf::NetworkReactor::TimerId timer = reactor.addTimer(sf::seconds(3600), [] {});
+        reactor.post([&] { reactor.stop(); });
+        reactor.run(2);
+
+        // The reactor can run again after being stopped
+        int calls = 0;
+        reactor.post([&] { ++calls; });
+        CHECK(reactor.cancelTimer(timer));
+        reactor.run();
+        CHECK(calls == 1);
+    }
+
+    SECTION("TCP")
+    {
+        sf::TcpListener listener;
+        REQUIRE(listener.listen(0, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+
+        sf::TcpSocket server;
+        sf::TcpSocket client;
+
+        sf::Socket::Status acceptStatus  = sf::Socket::Status::Error;
+        sf::Socket::Status connectStatus = sf::Socket::Status::Error;
+        reactor.asyncAccept(listener, server, [&](sf::Socket::Status status) { acceptStatus = status; });
+        reactor.asyncConnect(client,
+                             sf::IpAddress::LocalHost,
+                             listener.getLocalPort(),
+                             [&](sf::Socket::Status status) { connectStatus = status; });
+        reactor.run();
+
+        CHECK(acceptStatus == sf::Socket::Status::Done);
+        CHECK(connectStatus == sf::Socket::Status::Done);
+        CHECK(!client.isBlocking());
+
+        SECTION("Packets")
+        {
+            sf::Packet first;
+            first << std::string("Hello") << 42;
+            sf::Packet second;
+            second << 3.5f;
+
+            std::vector<sf::Socket::Status> sendStatuses;
+            reactor.asyncSend(client, first, [&](sf::Socket::Status status) { sendStatuses.push_back(status); });
+            reactor.asyncSend(client, second, [&](sf::Socket::Status status) { sendStatuses.push_back(status); });
+
+            sf::Packet   received;
+            std::string  text;
+            int          number = 0;
+            float        real   = 0;
+            reactor.asyncReceive(server,
+                                 received,
+                                 [&](sf::Socket::Status status)
+                                 {
+                                     REQUIRE(status == sf::Socket::Status::Done);
+                                     CHECK((received >> text >> number));
+
+                                     // Received packets are delivered in order
+                                     reactor.asyncReceive(server,
+                                                          received,
+                                                          [&](sf::Socket::Status secondStatus)
+                                                          {
+                                                              REQUIRE(secondStatus == sf::Socket::Status::Done);
+                                                              CHECK((received >> real));
+                                                          });
+                                 });
+            reactor.run();
+
+            CHECK(sendStatuses == std::vector{sf::Socket::Status::Done, sf::Socket::Status::Done});
+            CHECK(text == "Hello");
+            CHECK(number == 42);
+            CHECK(real == 3.5f);
+        }
+
+        SECTION("Partial sends")
+        {
+            // Much larger than the socket buffers, so that the send has to be resumed many times
+            std::vector<std::byte> data(16 * 1024 * 1024);
+            for (std::size_t i = 0; i < data.size(); ++i)
+                data[i] = static_cast<std::byte>(i * 7);
+
+            sf::Socket::Status sendStatus = sf::Socket::Status::Error;
+            reactor.asyncSend(client,
+                              data.data(),
+                              data.size(),
+                              [&](sf::Socket::Status status) { sendStatus = status; });
+
+            std::vector<std::byte> received;
+            std::vector<std::byte> buffer(65536);
+            std::function<void()>  receive;
+            std::atomic<bool>      failed{};
+            receive = [&]
+            {
+                reactor.asyncReceive(server,
+                                     buffer.data(),
+                                     buffer.size(),
+                                     [&](sf::Socket::Status status, std::size_t size)
+                                     {
+                                         if (status != sf::Socket::Status::Done)
+                                         {
+                                             failed = true;
+                                             return;
+                                         }
+
+                                         const auto end = buffer.begin() + static_cast<std::ptrdiff_t>(size);
+                                         received.insert(received.end(), buffer.begin(), end);
+                                         if (received.size() < data.size())
+                                             receive();
+                                     });
+            };
+            receive();
+            reactor.run(2);
+
+            CHECK(sendStatus == sf::Socket::Status::Done);
+            CHECK(!failed);
+            CHECK(received == data);
+        }
+
+        SECTION("cancel()")
+        {
+            bool called = false;
+            char buffer[16];
+            reactor.asyncReceive(server,
+                                 buffer,
+                                 sizeof(buffer),
+                                 [&](sf::Socket::Status, std::size_t) { called = true; });
+            reactor.cancel(server);
+
+            // Nothing is left to do
+            reactor.run();
+            CHECK(!called);
+        }
+
+        SECTION("Disconnection")
+        {
+            sf::Socket::Status receiveStatus = sf::Socket::Status::Done;
+            char               buffer[16];
+            reactor.asyncReceive(server,
+                                 buffer,
+                                 sizeof(buffer),
+                                 [&](sf::Socket::Status status, std::size_t) { receiveStatus = status; });
+            reactor.post([&] { client.disconnect(); });
+            reactor.run();
+            CHECK(receiveStatus == sf::Socket::Status::Disconnected);
+        }
+    }
+
+    SECTION("UDP")
+    {
+        sf::UdpSocket receiver;
+        REQUIRE(receiver.bind(0, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+
+        sf::UdpSocket                sender;
+        const char                   message[] = "datagram";
+        char                         buffer[sizeof(message)]{};
+        std::size_t                  received = 0;
+        std::optional<sf::IpAddress> remoteAddress;
+        unsigned short               remotePort = 0;
+
+        reactor.asyncReceive(receiver,
+                             buffer,
+                             sizeof(buffer),
+                             [&](sf::Socket::Status           status,
+                                 std::size_t                  size,
+                                 std::optional<sf::IpAddress> address,
+                                 unsigned short               port)
+                             {
+                                 CHECK(status == sf::Socket::Status::Done);
+                                 received      = size;
+                                 remoteAddress = address;
+                                 remotePort    = port;
+                             });
+        reactor.asyncSend(sender, message, sizeof(message), sf::IpAddress::LocalHost, receiver.getLocalPort(), nullptr);
+        reactor.run();
+
+        CHECK(received == sizeof(message));
+        CHECK(std::string(buffer) == message);
+        CHECK(remoteAddress == sf::IpAddress::LocalHost);
+        CHECK(remotePort == sender.getLocalPort());
+    }
+}
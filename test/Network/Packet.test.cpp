@@ -1,16 +1,22 @@
 #include <SFML/Network/Packet.hpp>
 
 // Other 1st party headers
+#include <SFML/Network/CompressionDictionary.hpp>
+
+#include <SFML/System/Err.hpp>
 #include <SFML/System/String.hpp>
 
 #include <catch2/catch_test_macros.hpp>
 
 #include <array>
 #include <limits>
+#include <memory>
+#include <sstream>
 #include <type_traits>
 #include <vector>
 
 #include <cstddef>
+#include <cstring>
 #include <cwchar>
 
 #define CHECK_PACKET_STREAM_OPERATORS(expected)              \
@@ -268,6 +274,287 @@ TEST_CASE("[Network] sf::Packet")
         }
     }
 
+    SECTION("Arrays")
+    {
+        SECTION("Same format as stream operators")
+        {
+            static constexpr std::array<std::int16_t, 3>  shorts  = {-1, 0x1234, 42};
+            static constexpr std::array<std::uint32_t, 3> ints    = {0x12345678, 0, 0xFFFFFFFF};
+            static constexpr std::array<std::int64_t, 2>  longs   = {-2, 0x0102030405060708};
+            static constexpr std::array<double, 2>        doubles = {1.5, -0.25};
+
+            sf::Packet bulk;
+            bulk.write(shorts.data(), shorts.size())
+                .write(ints.data(), ints.size())
+                .write(longs.data(), longs.size())
+                .write(doubles.data(), doubles.size());
+
+            sf::Packet packet;
+            for (const auto value : shorts)
+                packet << value;
+            for (const auto value : ints)
+                packet << value;
+            for (const auto value : longs)
+                packet << value;
+            for (const auto value : doubles)
+                packet << value;
+
+            REQUIRE(bulk.getDataSize() == packet.getDataSize());
+            CHECK(std::memcmp(bulk.getData(), packet.getData(), packet.getDataSize()) == 0);
+
+            std::array<std::int16_t, 3>  readShorts{};
+            std::array<std::uint32_t, 3> readInts{};
+            std::array<std::int64_t, 2>  readLongs{};
+            std::array<double, 2>        readDoubles{};
+            CHECK(packet.read(readShorts.data(), readShorts.size())
+                      .read(readInts.data(), readInts.size())
+                      .read(readLongs.data(), readLongs.size())
+                      .read(readDoubles.data(), readDoubles.size()));
+            CHECK(readShorts == shorts);
+            CHECK(readInts == ints);
+            CHECK(readLongs == longs);
+            CHECK(readDoubles == doubles);
+            CHECK(packet.endOfPacket());
+        }
+
+        SECTION("All types")
+        {
+            std::vector<float> floats(1000);
+            for (std::size_t i = 0; i < floats.size(); ++i)
+                floats[i] = static_cast<float>(i) * 0.5f;
+            static constexpr std::array<std::int8_t, 2>   int8s   = {-1, 1};
+            static constexpr std::array<std::uint8_t, 2>  uint8s  = {255, 1};
+            static constexpr std::array<std::uint16_t, 2> uint16s = {0xABCD, 1};
+            static constexpr std::array<std::int32_t, 2>  int32s  = {-100000, 1};
+            static constexpr std::array<std::uint64_t, 2> uint64s = {0xFFFFFFFFFFFFFFFF, 1};
+
+            sf::Packet packet;
+            packet.write(floats.data(), floats.size())
+                .write(int8s.data(), int8s.size())
+                .write(uint8s.data(), uint8s.size())
+                .write(uint16s.data(), uint16s.size())
+                .write(int32s.data(), int32s.size())
+                .write(uint64s.data(), uint64s.size());
+            CHECK(packet.getDataSize() == 4000 + 2 + 2 + 4 + 8 + 16);
+
+            std::vector<float>           readFloats(floats.size());
+            std::array<std::int8_t, 2>   readInt8s{};
+            std::array<std::uint8_t, 2>  readUint8s{};
+            std::array<std::uint16_t, 2> readUint16s{};
+            std::array<std::int32_t, 2>  readInt32s{};
+            std::array<std::uint64_t, 2> readUint64s{};
+            CHECK(packet.read(readFloats.data(), readFloats.size())
+                      .read(readInt8s.data(), readInt8s.size())
+                      .read(readUint8s.data(), readUint8s.size())
+                      .read(readUint16s.data(), readUint16s.size())
+                      .read(readInt32s.data(), readInt32s.size())
+                      .read(readUint64s.data(), readUint64s.size()));
+            CHECK(readFloats == floats);
+            CHECK(readInt8s == int8s);
+            CHECK(readUint8s == uint8s);
+            CHECK(readUint16s == uint16s);
+            CHECK(readInt32s == int32s);
+            CHECK(readUint64s == uint64s);
+            CHECK(packet.endOfPacket());
+        }
+
+        SECTION("Empty arrays")
+        {
+            sf::Packet packet;
+            packet.write(static_cast<const std::uint32_t*>(nullptr), 0);
+            CHECK(packet.getDataSize() == 0);
+            CHECK(packet.read(static_cast<std::uint32_t*>(nullptr), 0));
+        }
+
+        SECTION("Not enough data")
+        {
+            static constexpr std::array<std::uint16_t, 3> values = {1, 2, 3};
+
+            sf::Packet packet;
+            packet.write(values.data(), values.size());
+
+            std::array<std::uint16_t, 4> readValues{};
+            CHECK(!packet.read(readValues.data(), readValues.size()));
+            CHECK(packet.getReadPosition() == 0);
+            CHECK(readValues == std::array<std::uint16_t, 4>{});
+        }
+
+        SECTION("Overflowing count")
+        {
+            static constexpr std::array<std::uint32_t, 2> values = {1, 2};
+
+            sf::Packet packet;
+            packet.write(values.data(), values.size());
+            packet.write(values.data(), std::numeric_limits<std::size_t>::max() / sizeof(std::uint32_t) + 1);
+            packet.write(values.data(), std::numeric_limits<std::size_t>::max() / sizeof(std::uint32_t));
+            CHECK(packet.getDataSize() == sizeof(values));
+        }
+    }
+
+    SECTION("Compression")
+    {
+        // Send the data of a packet to another one, as sockets do
+        const auto transfer = [](Packet& sender, Packet& receiver)
+        {
+            std::size_t size = 0;
+            const void* sent = sender.onSend(size);
+            receiver.onReceive(sent, size);
+            return size;
+        };
+
+        SECTION("Default")
+        {
+            const sf::Packet packet;
+            CHECK(packet.getCompression() == sf::Packet::Compression::None);
+        }
+
+        SECTION("Compressible data")
+        {
+            Packet sender;
+            sender.setCompression(sf::Packet::Compression::Fast);
+            CHECK(sender.getCompression() == sf::Packet::Compression::Fast);
+            for (std::uint32_t i = 0; i < 1000; ++i)
+                sender << i % 10 << "repeated text";
+
+            Packet receiver;
+            receiver.setCompression(sf::Packet::Compression::Fast);
+            CHECK(transfer(sender, receiver) < sender.getDataSize() / 10);
+            REQUIRE(receiver.getDataSize() == sender.getDataSize());
+            CHECK(std::memcmp(receiver.getData(), sender.getData(), sender.getDataSize()) == 0);
+            CHECK(bool{receiver});
+
+            // The data of the packet itself is left untouched
+            std::uint32_t value = 42;
+            CHECK(sender >> value);
+            CHECK(value == 0);
+        }
+
+        SECTION("Long and overlapping matches")
+        {
+            Packet sender;
+            sender.setCompression(sf::Packet::Compression::Fast);
+            const std::vector<std::byte> zeros(100000);
+            sender.append(zeros.data(), zeros.size());
+            sender << "abcabcabcabcabcabcabcabcabcabc" << std::string(5000, 'x') << "end";
+
+            Packet receiver;
+            receiver.setCompression(sf::Packet::Compression::Fast);
+            CHECK(transfer(sender, receiver) < 1000);
+            REQUIRE(receiver.getDataSize() == sender.getDataSize());
+            CHECK(std::memcmp(receiver.getData(), sender.getData(), sender.getDataSize()) == 0);
+        }
+
+        SECTION("Incompressible data")
+        {
+            Packet sender;
+            sender.setCompression(sf::Packet::Compression::Fast);
+            std::uint32_t state = 12345;
+            for (int i = 0; i < 1000; ++i)
+            {
+                state = state * 1664525 + 1013904223;
+                sender << static_cast<std::uint8_t>(state >> 24);
+            }
+
+            Packet receiver;
+            receiver.setCompression(sf::Packet::Compression::Fast);
+            CHECK(transfer(sender, receiver) == sender.getDataSize() + 1);
+            REQUIRE(receiver.getDataSize() == sender.getDataSize());
+            CHECK(std::memcmp(receiver.getData(), sender.getData(), sender.getDataSize()) == 0);
+        }
+
+        SECTION("Empty packet")
+        {
+            Packet sender;
+            sender.setCompression(sf::Packet::Compression::Fast);
+
+            Packet receiver;
+            receiver.setCompression(sf::Packet::Compression::Fast);
+            CHECK(transfer(sender, receiver) == 0);
+            CHECK(receiver.getDataSize() == 0);
+            CHECK(bool{receiver});
+        }
+
+        SECTION("Dictionary")
+        {
+            sf::Packet sample;
+            sample << "position" << 0.f << 0.f << "velocity" << 0.f << 0.f << "state" << "running";
+            const auto dictionary = std::make_shared<sf::CompressionDictionary>(sample.getData(), sample.getDataSize());
+
+            Packet withoutDictionary;
+            withoutDictionary.setCompression(sf::Packet::Compression::Fast);
+            withoutDictionary << "position" << 1.f << 2.f << "velocity" << 3.f << 4.f << "state" << "running";
+
+            Packet withDictionary;
+            withDictionary.setCompression(sf::Packet::Compression::Fast, dictionary);
+            withDictionary << "position" << 1.f << 2.f << "velocity" << 3.f << 4.f << "state" << "running";
+
+            std::size_t sizeWithoutDictionary = 0;
+            std::size_t sizeWithDictionary    = 0;
+            (void)withoutDictionary.onSend(sizeWithoutDictionary);
+            const void* sent = withDictionary.onSend(sizeWithDictionary);
+            CHECK(sizeWithDictionary < sizeWithoutDictionary * 3 / 4);
+
+            Packet receiver;
+            receiver.setCompression(sf::Packet::Compression::Fast, dictionary);
+            receiver.onReceive(sent, sizeWithDictionary);
+            REQUIRE(receiver.getDataSize() == withDictionary.getDataSize());
+            CHECK(std::memcmp(receiver.getData(), withDictionary.getData(), withDictionary.getDataSize()) == 0);
+
+            // Receivers with another dictionary, or none, reject the data
+            Packet otherReceiver;
+            otherReceiver.setCompression(sf::Packet::Compression::Fast,
+                                         std::make_shared<sf::CompressionDictionary>("other", 5));
+            otherReceiver.onReceive(sent, sizeWithDictionary);
+            CHECK(otherReceiver.getDataSize() == 0);
+            CHECK(!otherReceiver);
+
+            Packet noDictionaryReceiver;
+            noDictionaryReceiver.setCompression(sf::Packet::Compression::Fast);
+            noDictionaryReceiver.onReceive(sent, sizeWithDictionary);
+            CHECK(noDictionaryReceiver.getDataSize() == 0);
+            CHECK(!noDictionaryReceiver);
+        }
+
+        SECTION("Corrupted data")
+        {
+            // Silence the errors reported for each corrupted packet
+            std::ostringstream errors;
+            auto* const        defaultStreamBuffer = sf::err().rdbuf(errors.rdbuf());
+
+            Packet sender;
+            sender.setCompression(sf::Packet::Compression::Fast);
+            sender << std::string(1000, 'a') << std::string(1000, 'b');
+
+            std::size_t size = 0;
+            const auto* sent = static_cast<const std::byte*>(sender.onSend(size));
+            std::vector<std::byte> corrupted(sent, sent + size);
+
+            // Truncated data, then garbage, must be rejected without reading or writing out of bounds
+            Packet truncated;
+            truncated.setCompression(sf::Packet::Compression::Fast);
+            truncated.onReceive(corrupted.data(), corrupted.size() - 1);
+            CHECK(truncated.getDataSize() == 0);
+            CHECK(!truncated);
+
+            std::uint32_t state = 1;
+            for (int i = 0; i < 1000; ++i)
+            {
+                for (std::size_t j = 1; j < corrupted.size(); ++j)
+                {
+                    state        = state * 1664525 + 1013904223;
+                    corrupted[j] = static_cast<std::byte>(state >> 24);
+                }
+
+                Packet receiver;
+                receiver.setCompression(sf::Packet::Compression::Fast);
+                receiver.onReceive(corrupted.data(), corrupted.size());
+            }
+
+            sf::err().rdbuf(defaultStreamBuffer);
+            CHECK(!errors.str().empty());
+        }
+    }
+
     SECTION("onSend")
     {
         Packet      packet;
@@ -0,0 +1,173 @@
+#include <SFML/Network/PacketPool.hpp>
+
+// Other 1st party headers
+#include <SFML/Network/Packet.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <thread>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+TEST_CASE("[Network] sf::PacketPool")
+{
+    // Start from an empty pool in this thread
+    sf::PacketPool::trim();
+    sf::PacketPool::resetStatistics();
+
+    const std::vector<std::byte> data(100);
+
+    SECTION("Default settings")
+    {
+        CHECK(sf::PacketPool::getMaxBuffers() == 64);
+        CHECK(sf::PacketPool::getMaxBufferSize() == 64 * 1024);
+    }
+
+    SECTION("Reuse memory")
+    {
+        const void* address = nullptr;
+        {
+            sf::Packet packet;
+            packet.append(data.data(), data.size());
+            address = packet.getData();
+        }
+
+        const sf::PacketPool::Statistics released = sf::PacketPool::getStatistics();
+        CHECK(released.misses == 1);
+        CHECK(released.hits == 0);
+        CHECK(released.pooledBuffers == 1);
+        CHECK(released.pooledBytes >= data.size());
+        CHECK(released.peakPooledBytes == released.pooledBytes);
+
+        sf::Packet packet;
+        packet << std::uint32_t{42};
+        CHECK(packet.getData() == address);
+        CHECK(packet.getDataSize() == sizeof(std::uint32_t));
+
+        const sf::PacketPool::Statistics reused = sf::PacketPool::getStatistics();
+        CHECK(reused.misses == 1);
+        CHECK(reused.hits == 1);
+        CHECK(reused.pooledBuffers == 0);
+        CHECK(reused.pooledBytes == 0);
+        CHECK(reused.peakPooledBytes == released.peakPooledBytes);
+    }
+
+    SECTION("Array writes")
+    {
+        {
+            sf::Packet packet;
+            packet.append(data.data(), data.size());
+        }
+
+        const std::vector<std::uint16_t> values(10);
+        sf::Packet                       packet;
+        packet.write(values.data(), values.size());
+        CHECK(sf::PacketPool::getStatistics().hits == 1);
+    }
+
+    SECTION("Limits")
+    {
+        SECTION("Maximum number of buffers")
+        {
+            sf::PacketPool::setMaxBuffers(2);
+            {
+                std::vector<sf::Packet> packets(3);
+                for (sf::Packet& packet : packets)
+                    packet.append(data.data(), data.size());
+            }
+            sf::PacketPool::setMaxBuffers(64);
+
+            const sf::PacketPool::Statistics statistics = sf::PacketPool::getStatistics();
+            CHECK(statistics.pooledBuffers == 2);
+            CHECK(statistics.discarded == 1);
+        }
+
+        SECTION("Lowered maximum number of buffers")
+        {
+            {
+                std::vector<sf::Packet> packets(3);
+                for (sf::Packet& packet : packets)
+                    packet.append(data.data(), data.size());
+            }
+            CHECK(sf::PacketPool::getStatistics().pooledBuffers == 3);
+
+            sf::PacketPool::setMaxBuffers(1);
+            {
+                sf::Packet packet;
+                packet.append(data.data(), data.size());
+            }
+            sf::PacketPool::setMaxBuffers(64);
+
+            const sf::PacketPool::Statistics statistics = sf::PacketPool::getStatistics();
+            CHECK(statistics.pooledBuffers == 1);
+            CHECK(statistics.discarded == 2);
+        }
+
+        SECTION("Disabled pool")
+        {
+            sf::PacketPool::setMaxBuffers(0);
+            {
+                sf::Packet packet;
+                packet.append(data.data(), data.size());
+            }
+            sf::PacketPool::setMaxBuffers(64);
+
+            const sf::PacketPool::Statistics statistics = sf::PacketPool::getStatistics();
+            CHECK(statistics.pooledBuffers == 0);
+            CHECK(statistics.discarded == 1);
+        }
+
+        SECTION("Maximum buffer size")
+        {
+            sf::PacketPool::setMaxBufferSize(50);
+            CHECK(sf::PacketPool::getMaxBufferSize() == 50);
+            {
+                sf::Packet packet;
+                packet.append(data.data(), data.size());
+            }
+            sf::PacketPool::setMaxBufferSize(64 * 1024);
+
+            const sf::PacketPool::Statistics statistics = sf::PacketPool::getStatistics();
+            CHECK(statistics.pooledBuffers == 0);
+            CHECK(statistics.discarded == 1);
+        }
+    }
+
+    SECTION("Trim")
+    {
+        {
+            sf::Packet packet;
+            packet.append(data.data(), data.size());
+        }
+        CHECK(sf::PacketPool::getStatistics().pooledBuffers == 1);
+
+        sf::PacketPool::trim();
+        const sf::PacketPool::Statistics statistics = sf::PacketPool::getStatistics();
+        CHECK(statistics.pooledBuffers == 0);
+        CHECK(statistics.pooledBytes == 0);
+        CHECK(statistics.peakPooledBytes >= data.size());
+
+        sf::PacketPool::resetStatistics();
+        CHECK(sf::PacketPool::getStatistics().peakPooledBytes == 0);
+    }
+
+    SECTION("Thread exit")
+    {
+        std::thread thread(
+            [&data]
+            {
+                sf::Packet packet;
+                packet.append(data.data(), data.size());
+            });
+        thread.join();
+
+        const sf::PacketPool::Statistics statistics = sf::PacketPool::getStatistics();
+        CHECK(statistics.misses == 1);
+        CHECK(statistics.pooledBuffers == 0);
+        CHECK(statistics.pooledBytes == 0);
+    }
+
+    sf::PacketPool::trim();
+}
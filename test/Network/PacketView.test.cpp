@@ -0,0 +1,211 @@
+#include <SFML/Network/PacketView.hpp>
+
+// Other 1st party headers
+#include <SFML/Network/Packet.hpp>
+
+#include <SFML/System/String.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include <cstddef>
+#include <cstdint>
+
+TEST_CASE("[Network] sf::PacketView")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(std::is_copy_constructible_v<sf::PacketView>);
+        STATIC_CHECK(std::is_copy_assignable_v<sf::PacketView>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::PacketView>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::PacketView>);
+        STATIC_CHECK(std::is_convertible_v<const sf::Packet&, sf::PacketView>);
+    }
+
+    SECTION("Construction")
+    {
+        SECTION("Default constructor")
+        {
+            const sf::PacketView view;
+            CHECK(view.getReadPosition() == 0);
+            CHECK(view.getData() == nullptr);
+            CHECK(view.getDataSize() == 0);
+            CHECK(view.endOfPacket());
+            CHECK(bool{view});
+        }
+
+        SECTION("Data constructor")
+        {
+            static constexpr std::array data = {std::byte{1}, std::byte{2}, std::byte{3}};
+            const sf::PacketView        view(data.data(), data.size());
+            CHECK(view.getReadPosition() == 0);
+            CHECK(view.getData() == data.data());
+            CHECK(view.getDataSize() == data.size());
+            CHECK(!view.endOfPacket());
+            CHECK(bool{view});
+        }
+
+        SECTION("Null data")
+        {
+            const sf::PacketView view(nullptr, 42);
+            CHECK(view.getData() == nullptr);
+            CHECK(view.getDataSize() == 0);
+            CHECK(view.endOfPacket());
+        }
+
+        SECTION("Packet constructor")
+        {
+            sf::Packet packet;
+            packet << std::uint32_t{12} << std::uint32_t{34};
+            std::uint32_t first = 0;
+            packet >> first;
+
+            sf::PacketView view(packet);
+            CHECK(view.getData() == packet.getData());
+            CHECK(view.getDataSize() == packet.getDataSize());
+            CHECK(view.getReadPosition() == 0);
+
+            std::uint32_t value = 0;
+            CHECK(view >> value);
+            CHECK(value == 12);
+            CHECK(packet.getReadPosition() == sizeof(std::uint32_t));
+        }
+    }
+
+    SECTION("Stream operators")
+    {
+        sf::Packet packet;
+        packet << true << std::int8_t{-1} << std::uint8_t{2} << std::int16_t{-3} << std::uint16_t{4} << std::int32_t{-5}
+               << std::uint32_t{6} << std::numeric_limits<std::int64_t>::min()
+               << std::numeric_limits<std::uint64_t>::max() << 7.5f << 8.25 << "char*" << std::string("std::string")
+               << L"wchar_t*" << std::wstring(L"std::wstring") << sf::String(U"sf::String");
+
+        sf::PacketView view(packet);
+
+        bool          b{};
+        std::int8_t   i8{};
+        std::uint8_t  u8{};
+        std::int16_t  i16{};
+        std::uint16_t u16{};
+        std::int32_t  i32{};
+        std::uint32_t u32{};
+        std::int64_t  i64{};
+        std::uint64_t u64{};
+        float         f{};
+        double        d{};
+        CHECK(view >> b >> i8 >> u8 >> i16 >> u16 >> i32 >> u32 >> i64 >> u64 >> f >> d);
+        CHECK(b);
+        CHECK(i8 == -1);
+        CHECK(u8 == 2);
+        CHECK(i16 == -3);
+        CHECK(u16 == 4);
+        CHECK(i32 == -5);
+        CHECK(u32 == 6);
+        CHECK(i64 == std::numeric_limits<std::int64_t>::min());
+        CHECK(u64 == std::numeric_limits<std::uint64_t>::max());
+        CHECK(f == 7.5f);
+        CHECK(d == 8.25);
+
+        std::array<char, 16>    charBuffer{};
+        std::string             string;
+        std::array<wchar_t, 16> wcharBuffer{};
+        std::wstring            wstring;
+        sf::String              sfString;
+        CHECK(view >> charBuffer.data() >> string >> wcharBuffer.data() >> wstring >> sfString);
+        CHECK(std::string(charBuffer.data()) == "char*");
+        CHECK(string == "std::string");
+        CHECK(std::wstring(wcharBuffer.data()) == L"wchar_t*");
+        CHECK(wstring == L"std::wstring");
+        CHECK(sfString == U"sf::String");
+        CHECK(view.getReadPosition() == packet.getDataSize());
+        CHECK(view.endOfPacket());
+        CHECK(bool{view});
+    }
+
+    SECTION("std::string_view")
+    {
+        sf::Packet packet;
+        packet << std::string("hello") << std::string() << std::string("world");
+
+        sf::PacketView   view(packet);
+        std::string_view hello;
+        std::string_view empty = "not empty";
+        std::string_view world;
+        CHECK(view >> hello >> empty >> world);
+        CHECK(hello == "hello");
+        CHECK(empty.empty());
+        CHECK(world == "world");
+        CHECK(view.endOfPacket());
+
+        // The characters are not copied
+        const auto* begin = static_cast<const char*>(packet.getData());
+        const auto* end   = begin + packet.getDataSize();
+        CHECK(hello.data() > begin);
+        CHECK(world.data() + world.size() == end);
+    }
+
+    SECTION("Same behavior as sf::Packet")
+    {
+        sf::Packet packet;
+        packet << std::uint16_t{0x1234} << std::string("abc");
+
+        sf::PacketView view(packet);
+        std::string    fromPacket;
+        std::string    fromView;
+        std::uint16_t  shortFromPacket = 0;
+        std::uint16_t  shortFromView   = 0;
+        CHECK(packet >> shortFromPacket >> fromPacket);
+        CHECK(view >> shortFromView >> fromView);
+        CHECK(shortFromPacket == shortFromView);
+        CHECK(fromPacket == fromView);
+        CHECK(packet.getReadPosition() == view.getReadPosition());
+    }
+
+    SECTION("Arrays")
+    {
+        static constexpr std::array<std::int32_t, 4> values = {-1, 0x12345678, 0, 42};
+
+        sf::Packet packet;
+        packet.write(values.data(), values.size());
+
+        sf::PacketView              view(packet);
+        std::array<std::int32_t, 4> readValues{};
+        CHECK(view.read(readValues.data(), readValues.size()));
+        CHECK(readValues == values);
+        CHECK(view.endOfPacket());
+
+        // Overflowing sizes are rejected
+        sf::PacketView overflowView(packet);
+        CHECK(!overflowView.read(readValues.data(), std::numeric_limits<std::size_t>::max() / 2));
+    }
+
+    SECTION("Attempt overflow")
+    {
+        sf::Packet packet;
+        packet << std::uint32_t{std::numeric_limits<std::uint32_t>::max()};
+
+        sf::PacketView   view(packet);
+        std::string_view string = "unchanged";
+        CHECK(!(view >> string));
+        CHECK(string.empty());
+
+        // Failure is sticky, like with sf::Packet
+        std::uint8_t value = 0;
+        CHECK(!(view >> value));
+    }
+
+    SECTION("Read past the end")
+    {
+        static constexpr std::array data = {std::byte{1}, std::byte{2}, std::byte{3}};
+        sf::PacketView              view(data.data(), data.size());
+
+        std::uint32_t value = 0;
+        CHECK(!(view >> value));
+        CHECK(view.getReadPosition() == 0);
+    }
+}
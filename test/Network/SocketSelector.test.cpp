@@ -1,11 +1,16 @@
 #include <SFML/Network/SocketSelector.hpp>
 
 // Other 1st party headers
+#include <SFML/Network/IpAddress.hpp>
+#include <SFML/Network/TcpListener.hpp>
+#include <SFML/Network/TcpSocket.hpp>
 #include <SFML/Network/UdpSocket.hpp>
 
 #include <catch2/catch_test_macros.hpp>
 
+#include <algorithm>
 #include <type_traits>
+#include <vector>
 
 TEST_CASE("[Network] sf::SocketSelector")
 {
@@ -24,4 +29,70 @@ TEST_CASE("[Network] sf::SocketSelector")
         const sf::SocketSelector socketSelector;
         CHECK(!socketSelector.isReady(socket));
     }
+
+    SECTION("wait()")
+    {
+        sf::TcpListener listener;
+        REQUIRE(listener.listen(0, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+
+        sf::SocketSelector socketSelector;
+        socketSelector.add(listener);
+        CHECK(!socketSelector.wait(sf::milliseconds(1)));
+        CHECK(socketSelector.getReadySockets().empty());
+
+        sf::TcpSocket client;
+        REQUIRE(client.connect(sf::IpAddress::LocalHost, listener.getLocalPort()) == sf::Socket::Status::Done);
+
+        SECTION("Read readiness")
+        {
+            REQUIRE(socketSelector.wait(sf::seconds(5)));
+            CHECK(socketSelector.isReady(listener));
+            CHECK(!socketSelector.isReadyToWrite(listener));
+            CHECK(socketSelector.getReadySockets() == std::vector<sf::Socket*>{&listener});
+
+            sf::TcpSocket server;
+            REQUIRE(listener.accept(server) == sf::Socket::Status::Done);
+            socketSelector.add(server);
+            CHECK(!socketSelector.wait(sf::milliseconds(1)));
+            CHECK(!socketSelector.isReady(listener));
+
+            const char data[] = "ping";
+            REQUIRE(client.send(data, sizeof(data)) == sf::Socket::Status::Done);
+            REQUIRE(socketSelector.wait(sf::seconds(5)));
+            CHECK(socketSelector.isReady(server));
+            CHECK(socketSelector.getReadySockets() == std::vector<sf::Socket*>{&server});
+
+            socketSelector.remove(server);
+            CHECK(socketSelector.getReadySockets().empty());
+            CHECK(!socketSelector.isReady(server));
+        }
+
+        SECTION("Write readiness")
+        {
+            socketSelector.add(client, sf::SocketSelector::Readiness::Write);
+            REQUIRE(socketSelector.wait(sf::seconds(5)));
+            CHECK(socketSelector.isReadyToWrite(client));
+            CHECK(!socketSelector.isReady(client));
+
+            const auto& readySockets = socketSelector.getReadySockets();
+            CHECK(std::find(readySockets.begin(), readySockets.end(), &client) != readySockets.end());
+
+            // Watching for reading only again
+            socketSelector.add(client);
+            socketSelector.remove(listener);
+            CHECK(!socketSelector.wait(sf::milliseconds(1)));
+            CHECK(!socketSelector.isReadyToWrite(client));
+        }
+
+        SECTION("Copy")
+        {
+            const sf::SocketSelector copy(socketSelector);
+            socketSelector.clear();
+            CHECK(!socketSelector.wait(sf::milliseconds(1)));
+
+            sf::SocketSelector other(copy);
+            REQUIRE(other.wait(sf::seconds(5)));
+            CHECK(other.isReady(listener));
+        }
+    }
 }
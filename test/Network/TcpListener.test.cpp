@@ -6,6 +6,7 @@
 #include <catch2/catch_test_macros.hpp>
 
 #include <type_traits>
+#include <vector>
 
 TEST_CASE("[Network] sf::TcpListener")
 {
@@ -21,6 +22,10 @@ TEST_CASE("[Network] sf::TcpListener")
     {
         const sf::TcpListener tcpListener;
         CHECK(tcpListener.getLocalPort() == 0);
+        CHECK(!tcpListener.getReusePort());
+        CHECK(tcpListener.getDeferAccept() == sf::Time::Zero);
+        CHECK(tcpListener.getSendBufferSize() == 0);
+        CHECK(tcpListener.getReceiveBufferSize() == 0);
     }
 
     SECTION("listen()")
@@ -40,6 +45,50 @@ TEST_CASE("[Network] sf::TcpListener")
         }
     }
 
+    SECTION("setReusePort()")
+    {
+        sf::TcpListener first;
+        first.setReusePort(true);
+        CHECK(first.getReusePort());
+
+#ifndef SFML_SYSTEM_WINDOWS
+        REQUIRE(first.listen(0, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+
+        sf::TcpListener second;
+        second.setReusePort(true);
+        CHECK(second.listen(first.getLocalPort(), sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+
+        sf::TcpListener third;
+        CHECK(third.listen(first.getLocalPort(), sf::IpAddress::LocalHost) == sf::Socket::Status::Error);
+#endif
+    }
+
+    SECTION("setDeferAccept()")
+    {
+        sf::TcpListener tcpListener;
+        tcpListener.setDeferAccept(sf::milliseconds(1500));
+        CHECK(tcpListener.getDeferAccept() == sf::milliseconds(1500));
+        CHECK(tcpListener.listen(0, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+    }
+
+    SECTION("setSendBufferSize() and setReceiveBufferSize()")
+    {
+        sf::TcpListener tcpListener;
+        tcpListener.setSendBufferSize(128 * 1024);
+        tcpListener.setReceiveBufferSize(128 * 1024);
+        CHECK(tcpListener.getSendBufferSize() == 128 * 1024);
+        CHECK(tcpListener.getReceiveBufferSize() == 128 * 1024);
+        REQUIRE(tcpListener.listen(0, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+
+        // The accepted sockets inherit the buffer sizes of the listener
+        sf::TcpSocket client;
+        sf::TcpSocket server;
+        REQUIRE(client.connect(sf::IpAddress::LocalHost, tcpListener.getLocalPort()) == sf::Socket::Status::Done);
+        REQUIRE(tcpListener.accept(server) == sf::Socket::Status::Done);
+        CHECK(server.getSendBufferSize() >= 128 * 1024);
+        CHECK(server.getReceiveBufferSize() >= 128 * 1024);
+    }
+
     SECTION("close()")
     {
         sf::TcpListener tcpListener;
@@ -55,4 +104,29 @@ TEST_CASE("[Network] sf::TcpListener")
         sf::TcpSocket   tcpSocket;
         CHECK(tcpListener.accept(tcpSocket) == sf::Socket::Status::Error);
     }
+    SECTION("accept(std::vector<TcpSocket>&)")
+    {
+        sf::TcpListener            tcpListener;
+        std::vector<sf::TcpSocket> sockets;
+        CHECK(tcpListener.accept(sockets) == sf::Socket::Status::Error);
+        CHECK(sockets.empty());
+
+        REQUIRE(tcpListener.listen(0, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+        tcpListener.setBlocking(false);
+        CHECK(tcpListener.accept(sockets) == sf::Socket::Status::NotReady);
+        CHECK(sockets.empty());
+        tcpListener.setBlocking(true);
+
+        std::vector<sf::TcpSocket> clients(5);
+        for (sf::TcpSocket& client : clients)
+            REQUIRE(client.connect(sf::IpAddress::LocalHost, tcpListener.getLocalPort()) == sf::Socket::Status::Done);
+
+        CHECK(tcpListener.accept(sockets, 2) == sf::Socket::Status::Done);
+        CHECK(sockets.size() == 2);
+        CHECK(tcpListener.accept(sockets) == sf::Socket::Status::Done);
+        CHECK(sockets.size() == clients.size());
+        CHECK(tcpListener.isBlocking());
+        for (const sf::TcpSocket& socket : sockets)
+            CHECK(socket.isBlocking());
+    }
 }
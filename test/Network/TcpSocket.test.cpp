@@ -1,11 +1,23 @@
 #include <SFML/Network/TcpSocket.hpp>
 
 // Other 1st party headers
+#include <SFML/Network/CompressionDictionary.hpp>
 #include <SFML/Network/IpAddress.hpp>
+#include <SFML/Network/Packet.hpp>
+#include <SFML/Network/TcpListener.hpp>
 
 #include <catch2/catch_test_macros.hpp>
 
+#include <array>
+#include <memory>
+#include <string>
+#include <thread>
 #include <type_traits>
+#include <vector>
+
+#include <cctype>
+#include <cstdint>
+#include <cstring>
 
 TEST_CASE("[Network] sf::TcpSocket")
 {
@@ -24,4 +36,239 @@ TEST_CASE("[Network] sf::TcpSocket")
         CHECK(!tcpSocket.getRemoteAddress().has_value());
         CHECK(tcpSocket.getRemotePort() == 0);
     }
+
+    SECTION("Packets")
+    {
+        sf::TcpListener listener;
+        REQUIRE(listener.listen(0, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+
+        sf::TcpSocket client;
+        REQUIRE(client.connect(sf::IpAddress::LocalHost, listener.getLocalPort()) == sf::Socket::Status::Done);
+
+        sf::TcpSocket server;
+        REQUIRE(listener.accept(server) == sf::Socket::Status::Done);
+
+        SECTION("send(Packet&)")
+        {
+            sf::Packet packet;
+            packet << std::string("Hello") << std::uint32_t{42};
+            REQUIRE(client.send(packet) == sf::Socket::Status::Done);
+
+            sf::Packet    received;
+            std::string   text;
+            std::uint32_t number = 0;
+            REQUIRE(server.receive(received) == sf::Socket::Status::Done);
+            CHECK((received >> text >> number));
+            CHECK(text == "Hello");
+            CHECK(number == 42);
+        }
+
+        SECTION("send(Packet*, std::size_t)")
+        {
+            // More packets than a single system call gathers, including an empty one
+            std::vector<sf::Packet> packets(150);
+            for (std::size_t i = 1; i < packets.size(); ++i)
+                packets[i] << static_cast<std::uint32_t>(i) << std::string(i, 'x');
+
+            REQUIRE(client.send(packets.data(), packets.size()) == sf::Socket::Status::Done);
+
+            sf::Packet received;
+            REQUIRE(server.receive(received) == sf::Socket::Status::Done);
+            CHECK(received.getDataSize() == 0);
+
+            for (std::size_t i = 1; i < packets.size(); ++i)
+            {
+                std::uint32_t index = 0;
+                std::string   text;
+                REQUIRE(server.receive(received) == sf::Socket::Status::Done);
+                CHECK((received >> index >> text));
+                CHECK(index == i);
+                CHECK(text.size() == i);
+            }
+        }
+
+        SECTION("receive(std::vector<Packet>&)")
+        {
+            std::vector<sf::Packet> packets(150);
+            for (std::size_t i = 0; i < packets.size(); ++i)
+                packets[i] << static_cast<std::uint32_t>(i);
+
+            // Larger than the receive buffer and than what is allocated upfront
+            packets[100].clear();
+            const std::vector<std::uint8_t> large(3 * 1024 * 1024, 7);
+            packets[100].append(large.data(), large.size());
+
+            sf::Socket::Status sendStatus = sf::Socket::Status::Error;
+            std::thread        sender([&] { sendStatus = client.send(packets.data(), packets.size()); });
+
+            std::vector<sf::Packet> received;
+            std::vector<sf::Packet> all;
+            while (all.size() < packets.size())
+            {
+                REQUIRE(server.receive(received) == sf::Socket::Status::Done);
+                CHECK(!received.empty());
+                all.insert(all.end(), received.begin(), received.end());
+            }
+            sender.join();
+
+            CHECK(sendStatus == sf::Socket::Status::Done);
+            REQUIRE(all.size() == packets.size());
+            for (std::size_t i = 0; i < all.size(); ++i)
+            {
+                REQUIRE(all[i].getDataSize() == packets[i].getDataSize());
+                CHECK(std::memcmp(all[i].getData(), packets[i].getData(), all[i].getDataSize()) == 0);
+            }
+        }
+
+        SECTION("Derived packets")
+        {
+            class UppercasePacket : public sf::Packet
+            {
+                void onReceive(const void* data, std::size_t size) override
+                {
+                    std::string text(static_cast<const char*>(data), size);
+                    for (char& character : text)
+                        character = static_cast<char>(std::toupper(character));
+                    append(text.data(), text.size());
+                }
+            };
+
+            sf::Packet packet;
+            packet.append("hello", 5);
+            REQUIRE(client.send(packet) == sf::Socket::Status::Done);
+
+            UppercasePacket received;
+            REQUIRE(server.receive(received) == sf::Socket::Status::Done);
+            REQUIRE(received.getDataSize() == 5);
+            CHECK(std::memcmp(received.getData(), "HELLO", 5) == 0);
+        }
+
+        SECTION("Compressed packets")
+        {
+            sf::Packet packet;
+            packet.setCompression(sf::Packet::Compression::Fast);
+            packet << std::string(1000, 'a') << std::uint32_t{42};
+            REQUIRE(client.send(packet) == sf::Socket::Status::Done);
+
+            sf::Packet received;
+            received.setCompression(sf::Packet::Compression::Fast);
+            std::string   text;
+            std::uint32_t number = 0;
+            REQUIRE(server.receive(received) == sf::Socket::Status::Done);
+            CHECK((received >> text >> number));
+            CHECK(text == std::string(1000, 'a'));
+            CHECK(number == 42);
+        }
+
+        SECTION("Compressed packets received at once")
+        {
+            sf::Packet sample;
+            sample << std::string("position") << std::string("velocity");
+            const auto dictionary = std::make_shared<sf::CompressionDictionary>(sample.getData(), sample.getDataSize());
+
+            std::vector<sf::Packet> packets(50);
+            for (std::size_t i = 0; i < packets.size(); ++i)
+            {
+                packets[i].setCompression(sf::Packet::Compression::Fast, dictionary);
+                packets[i] << std::string("position") << static_cast<std::uint32_t>(i) << std::string(100, 'a');
+            }
+
+            REQUIRE(client.send(packets.data(), packets.size()) == sf::Socket::Status::Done);
+
+            std::vector<sf::Packet> received;
+            std::vector<sf::Packet> all;
+            while (all.size() < packets.size())
+            {
+                const sf::Socket::Status status = server.receive(received, sf::Packet::Compression::Fast, dictionary);
+                REQUIRE(status == sf::Socket::Status::Done);
+                all.insert(all.end(), received.begin(), received.end());
+            }
+
+            REQUIRE(all.size() == packets.size());
+            for (std::size_t i = 0; i < all.size(); ++i)
+            {
+                std::string   name;
+                std::uint32_t index = 0;
+                std::string   text;
+                CHECK(all[i].getCompression() == sf::Packet::Compression::Fast);
+                CHECK((all[i] >> name >> index >> text));
+                CHECK(name == "position");
+                CHECK(index == i);
+                CHECK(text == std::string(100, 'a'));
+                CHECK(all[i].endOfPacket());
+            }
+        }
+
+        SECTION("Partial sends")
+        {
+            // Much larger than the socket buffers
+            std::array<sf::Packet, 3> packets;
+            for (std::size_t i = 0; i < packets.size(); ++i)
+            {
+                const std::vector<std::uint8_t> data(4 * 1024 * 1024, static_cast<std::uint8_t>(i));
+                packets[i].append(data.data(), data.size());
+            }
+
+            std::vector<std::size_t> receivedSizes;
+            std::vector<bool>        receivedContents;
+
+            std::thread receiver(
+                [&]
+                {
+                    for (std::size_t i = 0; i < packets.size(); ++i)
+                    {
+                        sf::Packet received;
+                        if (server.receive(received) != sf::Socket::Status::Done)
+                            return;
+
+                        const auto* data = static_cast<const std::uint8_t*>(received.getData());
+                        receivedSizes.push_back(received.getDataSize());
+                        receivedContents.push_back(data[0] == i && data[received.getDataSize() - 1] == i);
+                    }
+                });
+
+            client.setBlocking(false);
+            sf::Socket::Status status  = sf::Socket::Status::Partial;
+            bool               partial = false;
+            while ((status == sf::Socket::Status::Partial) || (status == sf::Socket::Status::NotReady))
+            {
+                status  = client.send(packets.data(), packets.size());
+                partial = partial || (status == sf::Socket::Status::Partial);
+            }
+            receiver.join();
+
+            CHECK(status == sf::Socket::Status::Done);
+            CHECK(partial);
+            CHECK(receivedSizes == std::vector<std::size_t>(3, 4 * 1024 * 1024));
+            CHECK(receivedContents == std::vector<bool>(3, true));
+        }
+    }
+    SECTION("Socket options")
+    {
+        sf::TcpSocket tcpSocket;
+        CHECK(!tcpSocket.setNoDelay(false));
+        CHECK(tcpSocket.getSendBufferSize() == 0);
+        CHECK(tcpSocket.getReceiveBufferSize() == 0);
+
+        // The buffer sizes can be set before connecting, and are kept by the connection
+        CHECK(tcpSocket.setSendBufferSize(128 * 1024));
+        CHECK(tcpSocket.setReceiveBufferSize(128 * 1024));
+        CHECK(tcpSocket.getReceiveBufferSize() >= 128 * 1024);
+
+        sf::TcpListener listener;
+        REQUIRE(listener.listen(0, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+        REQUIRE(tcpSocket.connect(sf::IpAddress::LocalHost, listener.getLocalPort()) == sf::Socket::Status::Done);
+        CHECK(tcpSocket.getSendBufferSize() >= 128 * 1024);
+        CHECK(tcpSocket.getReceiveBufferSize() >= 128 * 1024);
+
+        CHECK(tcpSocket.setNoDelay(false));
+        CHECK(tcpSocket.setNoDelay(true));
+        CHECK(tcpSocket.setSendBufferSize(64 * 1024));
+        CHECK(tcpSocket.getSendBufferSize() >= 64 * 1024);
+        CHECK(tcpSocket.setReceiveBufferSize(64 * 1024));
+        CHECK(tcpSocket.getReceiveBufferSize() >= 64 * 1024);
+#ifdef SFML_SYSTEM_LINUX
+        CHECK(tcpSocket.setQuickAck(true));
+#endif
+    }
 }
@@ -0,0 +1,283 @@
+#include <SFML/Network/UdpConnection.hpp>
+
+// Other 1st party headers
+#include <SFML/Network/Packet.hpp>
+
+#include <SFML/System/Clock.hpp>
+#include <SFML/System/Sleep.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <type_traits>
+#include <vector>
+
+#include <cstdint>
+
+namespace
+{
+// Update both connections until the condition is met, or give up after a few seconds
+[[nodiscard]] bool pump(sf::UdpConnection& first, sf::UdpConnection& second, const std::function<bool()>& condition)
+{
+    const sf::Clock clock;
+    while (clock.getElapsedTime() < sf::seconds(10))
+    {
+        first.update();
+        second.update();
+        if (condition())
+            return true;
+
+        sf::sleep(sf::milliseconds(1));
+    }
+
+    return false;
+}
+
+// Connect a client to a server over the loopback interface
+[[nodiscard]] bool connect(sf::UdpConnection& server, sf::UdpConnection& client)
+{
+    if (server.bind(sf::Socket::AnyPort, sf::IpAddress::LocalHost) != sf::Socket::Status::Done)
+        return false;
+
+    server.listen();
+    client.connect(sf::IpAddress::LocalHost, server.getLocalPort());
+
+    return pump(server,
+                client,
+                [&]
+                {
+                    return (server.getState() == sf::UdpConnection::State::Connected) &&
+                           (client.getState() == sf::UdpConnection::State::Connected);
+                });
+}
+} // namespace
+
+TEST_CASE("[Network] sf::UdpConnection")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::UdpConnection>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::UdpConnection>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::UdpConnection>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::UdpConnection>);
+    }
+
+    SECTION("Construction")
+    {
+        const sf::UdpConnection connection;
+        CHECK(connection.getState() == sf::UdpConnection::State::Disconnected);
+        CHECK(connection.getLocalPort() == 0);
+        CHECK(!connection.getRemoteAddress().has_value());
+        CHECK(connection.getRemotePort() == 0);
+        for (std::uint8_t channel = 0; channel < sf::UdpConnection::ChannelCount; ++channel)
+            CHECK(connection.getDelivery(channel) == sf::UdpConnection::Delivery::ReliableOrdered);
+
+        const sf::UdpConnection::Statistics statistics = connection.getStatistics();
+        CHECK(statistics.roundTripTime == sf::Time::Zero);
+        CHECK(statistics.bytesInFlight == 0);
+        CHECK(statistics.datagramsSent == 0);
+    }
+
+    SECTION("send() while disconnected")
+    {
+        sf::UdpConnection connection;
+        const char        message[] = "message";
+        CHECK(!connection.send(0, message, sizeof(message)));
+
+        sf::Packet   packet;
+        std::uint8_t channel = 0;
+        connection.update();
+        CHECK(!connection.receive(packet, channel));
+    }
+
+    sf::UdpConnection server;
+    sf::UdpConnection client;
+
+    SECTION("Connection")
+    {
+        REQUIRE(connect(server, client));
+        CHECK(client.getRemoteAddress() == sf::IpAddress::LocalHost);
+        CHECK(client.getRemotePort() == server.getLocalPort());
+        CHECK(server.getRemoteAddress() == sf::IpAddress::LocalHost);
+        CHECK(server.getRemotePort() == client.getLocalPort());
+
+        const char message[] = "message";
+        CHECK(!client.send(sf::UdpConnection::ChannelCount, message, sizeof(message)));
+        CHECK(!client.send(0, message, sf::UdpConnection::MaxMessageSize + 1));
+
+        SECTION("disconnect()")
+        {
+            client.disconnect();
+            CHECK(client.getState() == sf::UdpConnection::State::Disconnected);
+            CHECK(pump(server, client, [&] { return server.getState() == sf::UdpConnection::State::Disconnected; }));
+        }
+
+        SECTION("Timeout")
+        {
+            server.setTimeout(sf::milliseconds(200));
+            const sf::Clock clock;
+            while (server.getState() == sf::UdpConnection::State::Connected && clock.getElapsedTime() < sf::seconds(5))
+            {
+                server.update();
+                sf::sleep(sf::milliseconds(1));
+            }
+            CHECK(server.getState() == sf::UdpConnection::State::Disconnected);
+        }
+
+        SECTION("Keep-alive")
+        {
+            server.setTimeout(sf::milliseconds(300));
+            client.setTimeout(sf::milliseconds(300));
+            const sf::Clock clock;
+            CHECK(pump(server, client, [&] { return clock.getElapsedTime() > sf::seconds(1); }));
+            CHECK(server.getState() == sf::UdpConnection::State::Connected);
+            CHECK(client.getState() == sf::UdpConnection::State::Connected);
+        }
+    }
+
+    SECTION("Reliable delivery over a lossy network")
+    {
+        sf::UdpConnection::Simulator simulator;
+        simulator.packetLoss  = 0.3f;
+        simulator.duplication = 0.1f;
+        simulator.latency     = sf::milliseconds(10);
+        simulator.jitter      = sf::milliseconds(5);
+        simulator.seed        = 42;
+
+        REQUIRE(connect(server, client));
+        server.setSimulator(simulator);
+        client.setSimulator(simulator);
+
+        // Small messages, and a big one that is split into many fragments
+        constexpr std::uint32_t messageCount = 200;
+        for (std::uint32_t i = 0; i < messageCount; ++i)
+        {
+            sf::Packet packet;
+            packet << i;
+            REQUIRE(client.send(0, packet));
+        }
+
+        std::vector<std::uint8_t> big(100'000);
+        for (std::size_t i = 0; i < big.size(); ++i)
+            big[i] = static_cast<std::uint8_t>(i * 7);
+        REQUIRE(client.send(1, big.data(), big.size()));
+
+        std::vector<std::uint32_t> received;
+        std::vector<std::uint8_t>  receivedBig;
+        CHECK(pump(server,
+                   client,
+                   [&]
+                   {
+                       sf::Packet   packet;
+                       std::uint8_t channel = 0;
+                       while (server.receive(packet, channel))
+                       {
+                           if (channel == 0)
+                           {
+                               std::uint32_t value = 0;
+                               packet >> value;
+                               received.push_back(value);
+                           }
+                           else
+                           {
+                               const auto* data = static_cast<const std::uint8_t*>(packet.getData());
+                               receivedBig.assign(data, data + packet.getDataSize());
+                           }
+                       }
+                       return (received.size() == messageCount) && !receivedBig.empty();
+                   }));
+
+        std::vector<std::uint32_t> expected(messageCount);
+        for (std::uint32_t i = 0; i < messageCount; ++i)
+            expected[i] = i;
+        CHECK(received == expected);
+        CHECK(receivedBig == big);
+
+        const sf::UdpConnection::Statistics statistics = client.getStatistics();
+        CHECK(statistics.roundTripTime >= sf::milliseconds(10));
+        CHECK(statistics.datagramsLost > 0);
+        CHECK(statistics.messagesResent > 0);
+        CHECK(statistics.congestionWindow >= 2400);
+    }
+
+    SECTION("Acknowledgement of bursts")
+    {
+        REQUIRE(connect(server, client));
+
+        // Enough data for the congestion window to grow until many datagrams are sent in a single update
+        const std::vector<std::uint8_t> message(1000, 42);
+        constexpr std::size_t           messageCount = 500;
+        for (std::size_t i = 0; i < messageCount; ++i)
+            REQUIRE(client.send(0, message.data(), message.size()));
+
+        std::size_t   received     = 0;
+        std::uint64_t sent         = client.getStatistics().datagramsSent;
+        std::uint64_t biggestBurst = 0;
+        CHECK(pump(client,
+                   server,
+                   [&]
+                   {
+                       const std::uint64_t total = client.getStatistics().datagramsSent;
+                       biggestBurst              = std::max(biggestBurst, total - sent);
+                       sent                      = total;
+
+                       sf::Packet   packet;
+                       std::uint8_t channel = 0;
+                       while (server.receive(packet, channel))
+                           ++received;
+                       return received == messageCount;
+                   }));
+
+        // Every datagram must be acknowledged, rather than given up on as lost after a timeout
+        CHECK(pump(client, server, [&] { return client.getStatistics().bytesInFlight == 0; }));
+
+        const sf::UdpConnection::Statistics statistics = client.getStatistics();
+        CHECK(biggestBurst > 64);
+        CHECK(statistics.datagramsLost == 0);
+        CHECK(statistics.messagesResent == 0);
+    }
+
+    SECTION("Unreliable sequenced delivery")
+    {
+        server.setDelivery(2, sf::UdpConnection::Delivery::UnreliableSequenced);
+        client.setDelivery(2, sf::UdpConnection::Delivery::UnreliableSequenced);
+
+        sf::UdpConnection::Simulator simulator;
+        simulator.latency = sf::milliseconds(5);
+        simulator.jitter  = sf::milliseconds(5);
+        simulator.seed    = 7;
+
+        REQUIRE(connect(server, client));
+        client.setSimulator(simulator);
+
+        // Send one message per update, so that they travel in different datagrams that may be reordered
+        std::vector<std::uint32_t> received;
+        std::uint32_t              next = 0;
+        CHECK(pump(server,
+                   client,
+                   [&]
+                   {
+                       if (next < 100)
+                       {
+                           sf::Packet packet;
+                           packet << next++;
+                           REQUIRE(client.send(2, packet));
+                       }
+
+                       sf::Packet   packet;
+                       std::uint8_t channel = 0;
+                       while (server.receive(packet, channel))
+                       {
+                           CHECK(channel == 2);
+                           std::uint32_t value = 0;
+                           packet >> value;
+                           received.push_back(value);
+                       }
+                       return !received.empty() && (received.back() == 99);
+                   }));
+
+        for (std::size_t i = 1; i < received.size(); ++i)
+            CHECK(received[i] > received[i - 1]);
+    }
+}
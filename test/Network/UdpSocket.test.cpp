@@ -2,7 +2,14 @@
 
 #include <catch2/catch_test_macros.hpp>
 
+#include <array>
+#include <optional>
+#include <string_view>
 #include <type_traits>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
 
 TEST_CASE("[Network] sf::UdpSocket")
 {
@@ -35,4 +42,95 @@ TEST_CASE("[Network] sf::UdpSocket")
         udpSocket.unbind();
         CHECK(udpSocket.getLocalPort() == 0);
     }
+
+    SECTION("sendBatch()/receiveBatch()")
+    {
+        sf::UdpSocket receiver;
+        REQUIRE(receiver.bind(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+        const unsigned short port = receiver.getLocalPort();
+
+        sf::UdpSocket sender;
+
+        constexpr std::array<std::string_view, 3> messages{"first", "second", "third"};
+        std::vector<sf::UdpSocket::Datagram>      datagrams;
+        for (const auto message : messages)
+            datagrams.push_back({message.data(), message.size(), sf::IpAddress::LocalHost, port});
+
+        std::size_t sent = 0;
+        CHECK(sender.sendBatch(datagrams.data(), datagrams.size(), sent) == sf::Socket::Status::Done);
+        CHECK(sent == messages.size());
+
+        std::array<std::array<char, 16>, 4>          storage{};
+        std::array<sf::UdpSocket::DatagramBuffer, 4> buffers;
+        for (std::size_t i = 0; i < buffers.size(); ++i)
+        {
+            buffers[i].data = storage[i].data();
+            buffers[i].size = storage[i].size();
+        }
+
+        // Platforms without batched receive may deliver the datagrams over several calls
+        std::vector<std::string_view> received;
+        while (received.size() < messages.size())
+        {
+            std::size_t count = 0;
+            REQUIRE(receiver.receiveBatch(buffers.data(), buffers.size(), count) == sf::Socket::Status::Done);
+            REQUIRE(count > 0);
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                CHECK(buffers[i].remoteAddress == sf::IpAddress::LocalHost);
+                CHECK(buffers[i].remotePort == sender.getLocalPort());
+                received.emplace_back(static_cast<const char*>(buffers[i].data), buffers[i].received);
+            }
+        }
+        CHECK(received == std::vector<std::string_view>(messages.begin(), messages.end()));
+
+        // Nothing left to receive
+        receiver.setBlocking(false);
+        std::size_t count = 1;
+        CHECK(receiver.receiveBatch(buffers.data(), buffers.size(), count) == sf::Socket::Status::NotReady);
+        CHECK(count == 0);
+        CHECK(!buffers[0].remoteAddress.has_value());
+
+        // Oversized datagrams are rejected before anything is sent
+        datagrams.push_back({messages[0].data(), sf::UdpSocket::MaxDatagramSize + 1, sf::IpAddress::LocalHost, port});
+        CHECK(sender.sendBatch(datagrams.data(), datagrams.size(), sent) == sf::Socket::Status::Error);
+        CHECK(sent == 0);
+        CHECK(receiver.receiveBatch(buffers.data(), buffers.size(), count) == sf::Socket::Status::NotReady);
+    }
+
+    SECTION("sendSegmented()")
+    {
+        sf::UdpSocket receiver;
+        REQUIRE(receiver.bind(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+        const unsigned short port = receiver.getLocalPort();
+
+        std::vector<std::uint8_t> data(10'500);
+        for (std::size_t i = 0; i < data.size(); ++i)
+            data[i] = static_cast<std::uint8_t>(i);
+
+        sf::UdpSocket sender;
+        CHECK(sender.sendSegmented(data.data(), data.size(), 0, sf::IpAddress::LocalHost, port) ==
+              sf::Socket::Status::Error);
+        CHECK(sender.sendSegmented(data.data(), data.size(), 1000, sf::IpAddress::LocalHost, port) ==
+              sf::Socket::Status::Done);
+
+        // Each segment arrives as an independent datagram
+        std::vector<std::uint8_t> received;
+        std::vector<std::size_t>  sizes;
+        while (received.size() < data.size())
+        {
+            std::array<std::uint8_t, 2000> buffer{};
+            std::size_t                    size = 0;
+            std::optional<sf::IpAddress>   remoteAddress;
+            unsigned short                 remotePort = 0;
+            REQUIRE(receiver.receive(buffer.data(), buffer.size(), size, remoteAddress, remotePort) ==
+                    sf::Socket::Status::Done);
+            received.insert(received.end(), buffer.begin(), buffer.begin() + static_cast<std::ptrdiff_t>(size));
+            sizes.push_back(size);
+        }
+        CHECK(received == data);
+        CHECK(sizes.size() == 11);
+        CHECK(sizes.front() == 1000);
+        CHECK(sizes.back() == 500);
+    }
 }